@@ -211,6 +211,57 @@ dart_ret_t dart_reduce(
   dart_team_unit_t    root,
   dart_team_t         team);
 
+/**
+ * DART Equivalent to MPI scan, an inclusive prefix reduction over the
+ * units in the team in the order of their ids.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ * \param recvbuf Buffer of size \c nelem to store the result of \c op
+ *                applied to the values of units \c 0 to \c myid in.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and \c recvbuf.
+ * \param dtype   The data type of values stored in \c sendbuf and \c recvbuf.
+ * \param op      The reduce operation to perform.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_scan(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team);
+
+/**
+ * DART Equivalent to MPI exscan, an exclusive prefix reduction over the
+ * units in the team in the order of their ids.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ * \param recvbuf Buffer of size \c nelem to store the result of \c op
+ *                applied to the values of units \c 0 to \c myid-1 in.
+ *                The content of \c recvbuf is undefined at unit \c 0.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and \c recvbuf.
+ * \param dtype   The data type of values stored in \c sendbuf and \c recvbuf.
+ * \param op      The reduce operation to perform.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_exscan(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team);
+
 /**
  * DART Equivalent to MPI_Accumulate.
  *
@@ -261,6 +312,35 @@ dart_ret_t dart_fetch_and_op(
   dart_operation_t op,
   dart_team_t      team);
 
+/**
+ * DART Equivalent to MPI_Compare_and_swap.
+ *
+ * \param gptr    A global pointer determining the target of the
+ *                compare-and-swap operation.
+ * \param value   Pointer to an element of type \c dtype to be written to
+ *                the element referenced by \c gptr if it is equal to
+ *                \c compare.
+ * \param compare Pointer to an element of type \c dtype to be compared
+ *                with the element referenced by \c gptr.
+ * \param result  Pointer to an element of type \c dtype to hold the value
+ *                of the element referenced by \c gptr before the
+ *                operation.
+ * \param dtype   The data type of the elements, must be an integral type.
+ * \param team    The team to participate in the operation.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_compare_and_swap(
+  dart_gptr_t      gptr,
+  const void     * value,
+  const void     * compare,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_team_t      team);
+
 
 /** \} */
 
@@ -415,6 +495,8 @@ typedef struct dart_handle_struct * dart_handle_t;
  * \param nelem  The number of elements of \c dtype in buffer \c dest.
  * \param dtype  The data type of the values in buffer \c dest.
  * \param[out] handle Pointer to DART handle to instantiate for later use with \c dart_wait, \c dart_wait_all etc.
+ *                    Set to \c NULL if the operation already completed,
+ *                    e.g. on memory shared with the target unit.
  *
  * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
  *
@@ -439,6 +521,8 @@ dart_ret_t dart_get_handle(
  * \param nelem  The number of elements of type \c dtype to transfer.
  * \param dtype  The data type of the values in buffer \c dest.
  * \param[out] handle Pointer to DART handle to instantiate for later use with \c dart_wait, \c dart_wait_all etc.
+ *                    Set to \c NULL if the operation already completed,
+ *                    e.g. on memory shared with the target unit.
  *
  * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
  *
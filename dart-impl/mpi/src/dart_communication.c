@@ -82,6 +82,36 @@ static dart_ret_t get_shared_mem(dart_team_data_t * team_data,
   memcpy((char*)dest, baseptr, nelem * dart_mpi_sizeof_datatype(dtype));
   return DART_OK;
 }
+
+static dart_ret_t put_shared_mem(dart_team_data_t * team_data,
+                          dart_gptr_t        gptr,
+                          const void       * src,
+                          size_t             nelem,
+                          dart_datatype_t    dtype)
+{
+  int16_t      seg_id            = gptr.segid;
+  uint64_t     offset            = gptr.addr_or_offs.offset;
+  dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
+  char * baseptr;
+  /*
+   * Use memcpy if the target is in the same node as the calling unit:
+   */
+  DART_LOG_DEBUG("dart_put: shared memory segment, seg_id:%d",
+                 seg_id);
+  if (seg_id) {
+    if (dart_segment_get_baseptr(seg_id, luid, &baseptr) != DART_OK) {
+      DART_LOG_ERROR("dart_put ! "
+                     "dart_adapt_transtable_get_baseptr failed");
+      return DART_ERR_INVAL;
+    }
+  } else {
+    baseptr = dart_sharedmem_local_baseptr_set[luid.id];
+  }
+  baseptr += offset;
+  DART_LOG_DEBUG("dart_put: memcpy %zu bytes", nelem * dart_mpi_sizeof_datatype(dtype));
+  memcpy(baseptr, (const char*)src, nelem * dart_mpi_sizeof_datatype(dtype));
+  return DART_OK;
+}
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
 dart_ret_t dart_get(
@@ -411,6 +441,86 @@ dart_ret_t dart_fetch_and_op(
   return DART_OK;
 }
 
+dart_ret_t dart_compare_and_swap(
+  dart_gptr_t      gptr,
+  const void     * value,
+  const void     * compare,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_team_t      team)
+{
+  MPI_Aint     disp_s,
+               disp_rel;
+  MPI_Win      win;
+  MPI_Datatype mpi_dtype;
+  dart_global_unit_t  target_unitid_abs = DART_GLOBAL_UNIT_ID(gptr.unitid);
+  uint64_t offset   = gptr.addr_or_offs.offset;
+  int16_t  seg_id   = gptr.segid;
+  mpi_dtype         = dart_mpi_datatype(dtype);
+
+  (void)(team); // To prevent compiler warning from unused parameter.
+
+  DART_LOG_DEBUG("dart_compare_and_swap() dtype:%d unit:%d",
+                 dtype, target_unitid_abs.id);
+  if (dtype == DART_TYPE_UNDEFINED || dtype > DART_TYPE_LONGLONG) {
+    DART_LOG_ERROR("dart_compare_and_swap ! failed: "
+                   "only valid on integral types");
+    return DART_ERR_INVAL;
+  }
+  if (seg_id) {
+    dart_team_unit_t target_unitid_rel;
+
+    uint16_t index;
+    if (dart_segment_get_teamidx(seg_id, &index) != DART_OK) {
+      DART_LOG_ERROR("dart_compare_and_swap ! failed: Unknown segment %i!",
+                     seg_id);
+      return DART_ERR_INVAL;
+    }
+
+    unit_g2l(index,
+             target_unitid_abs,
+             &target_unitid_rel);
+    if (dart_segment_get_disp(
+          seg_id,
+          target_unitid_rel,
+          &disp_s) != DART_OK) {
+      DART_LOG_ERROR("dart_compare_and_swap ! "
+                     "dart_adapt_transtable_get_disp failed");
+      return DART_ERR_INVAL;
+    }
+    disp_rel = disp_s + offset;
+    win = dart_team_data[index].window;
+    MPI_Compare_and_swap(
+      value,             // Origin address
+      compare,           // Compare address
+      result,            // Result address
+      mpi_dtype,         // Data type of each buffer entry
+      target_unitid_rel.id, // Rank of target
+      disp_rel,          // Displacement from start of window to beginning
+                         // of target buffer
+      win);
+    DART_LOG_TRACE("dart_compare_and_swap:  (from coll. allocation) "
+                   "target unit: %d offset: %"PRIu64"",
+                   target_unitid_abs.id, offset);
+  } else {
+    win = dart_win_local_alloc;
+    MPI_Compare_and_swap(
+      value,             // Origin address
+      compare,           // Compare address
+      result,            // Result address
+      mpi_dtype,         // Data type of each buffer entry
+      target_unitid_abs.id, // Rank of target
+      offset,            // Displacement from start of window to beginning
+                         // of target buffer
+      win);
+    DART_LOG_TRACE("dart_compare_and_swap:  (from local allocation) "
+                   "target unit: %d offset: %"PRIu64"",
+                   target_unitid_abs.id, offset);
+  }
+  DART_LOG_DEBUG("dart_compare_and_swap > finished");
+  return DART_OK;
+}
+
 /* -- Non-blocking dart one-sided operations -- */
 
 dart_ret_t dart_get_handle(
@@ -449,8 +559,6 @@ dart_ret_t dart_get_handle(
 
   dart_team_data_t *team_data = &dart_team_data[index];
 
-  *handle = (dart_handle_t) malloc(sizeof(struct dart_handle_struct));
-
   if (seg_id > 0) {
     unit_g2l(index, target_unitid_abs, &target_unitid_rel);
   }
@@ -458,30 +566,23 @@ dart_ret_t dart_get_handle(
                  "o:%"PRIu64" s:%d i:%d, nelem:%zu",
                  target_unitid_abs, target_unitid_rel,
                  offset, seg_id, index, nelem);
-  DART_LOG_TRACE("dart_get_handle:  allocated handle:%p", (void *)(*handle));
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   DART_LOG_DEBUG("dart_get_handle: shared windows enabled");
 
   if (seg_id >= 0 && team_data->sharedmem_tab[gptr.unitid].id >= 0) {
-    dart_ret_t ret = get_shared_mem(team_data, dest, gptr, nelem, dtype);
-
     /*
-     * Mark request as completed:
+     * The transfer is completed by memcpy, no handle is returned as
+     * there is nothing to wait for:
      */
-    (*handle)->request = MPI_REQUEST_NULL;
-    if (seg_id != 0) {
-      (*handle)->dest = target_unitid_rel.id;
-      (*handle)->win = team_data->window;
-    } else {
-      (*handle)->dest = target_unitid_abs.id;
-      (*handle)->win  = dart_win_local_alloc;
-    }
-    return ret;
+    return get_shared_mem(team_data, dest, gptr, nelem, dtype);
   }
 #else
   DART_LOG_DEBUG("dart_get_handle: shared windows disabled");
 #endif /* !defined(DART_MPI_DISABLE_SHARED_WINDOWS) */
+
+  *handle = (dart_handle_t) malloc(sizeof(struct dart_handle_struct));
+  DART_LOG_TRACE("dart_get_handle:  allocated handle:%p", (void *)(*handle));
   /*
    * MPI shared windows disabled or target and calling unit are on different
    * nodes, use MPI_RGet:
@@ -597,16 +698,30 @@ dart_ret_t dart_put_handle(
     return DART_ERR_INVAL;
   }
 
+  uint16_t index;
+  if (dart_segment_get_teamidx(seg_id, &index) != DART_OK) {
+    DART_LOG_ERROR("dart_put_handle ! failed: Unknown segment %i!", seg_id);
+    return DART_ERR_INVAL;
+  }
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  DART_LOG_DEBUG("dart_put_handle: shared windows enabled");
+  if (seg_id >= 0 &&
+      dart_team_data[index].sharedmem_tab[gptr.unitid].id >= 0) {
+    /*
+     * The transfer is completed by memcpy, no handle is returned as
+     * there is nothing to wait for:
+     */
+    return put_shared_mem(&dart_team_data[index], gptr, src, nelem, dtype);
+  }
+#else
+  DART_LOG_DEBUG("dart_put_handle: shared windows disabled");
+#endif /* !defined(DART_MPI_DISABLE_SHARED_WINDOWS) */
+
   *handle = (dart_handle_t) malloc(sizeof(struct dart_handle_struct));
 
   if (seg_id != 0) {
 
-    uint16_t index;
-    if (dart_segment_get_teamidx(seg_id, &index) != DART_OK) {
-      DART_LOG_ERROR("dart_put_handle ! failed: Unknown segment %i!", seg_id);
-      return DART_ERR_INVAL;
-    }
-
     dart_team_unit_t target_unitid_rel;
     win = dart_team_data[index].window;
     unit_g2l(index, target_unitid_abs, &target_unitid_rel);
@@ -1141,7 +1256,10 @@ dart_ret_t dart_waitall_local(
     mpi_req = (MPI_Request *) malloc(num_handles * sizeof(MPI_Request));
     mpi_sta = (MPI_Status  *) malloc(num_handles * sizeof(MPI_Status));
     for (i = 0; i < num_handles; i++)  {
-      if (handle[i] != NULL && handle[i]->request != MPI_REQUEST_NULL) {
+      /* Requests of handles that already completed in dart_test*_local
+       * are MPI_REQUEST_NULL which is accepted by MPI_Waitall, keep them
+       * in the request array so handles and requests stay aligned: */
+      if (handle[i] != NULL) {
         DART_LOG_TRACE("dart_waitall_local: -- handle[%"PRIu64"]: %p)",
                        i, (void*)handle[i]);
         DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->dest: %d",
@@ -1172,8 +1290,7 @@ dart_ret_t dart_waitall_local(
         return DART_ERR_INVAL;
       }
     } else {
-      DART_LOG_DEBUG("dart_waitall_local > number of requests = 0");
-      return DART_OK;
+      DART_LOG_DEBUG("dart_waitall_local: number of requests = 0");
     }
     /*
      * copy MPI requests back to DART handles:
@@ -1319,10 +1436,15 @@ dart_ret_t dart_waitall(
      * wait for completion of MPI requests at origins and targets:
      */
     DART_LOG_DEBUG("dart_waitall: waiting for remote completion");
+    /* MPI_Waitall releases non-persistent requests and sets them to
+     * MPI_REQUEST_NULL, remote completion requires flushing the target
+     * window regardless of the request state: */
     for (i = 0; i < n; i++) {
       if (handle[i]) {
-        if (handle[i]->request == MPI_REQUEST_NULL) {
-          DART_LOG_TRACE("dart_waitall: -- handle[%zu] done (MPI_REQUEST_NULL)",
+        if (i > 0 && handle[i-1] != NULL &&
+            handle[i-1]->dest == handle[i]->dest &&
+            handle[i-1]->win  == handle[i]->win) {
+          DART_LOG_TRACE("dart_waitall: -- handle[%zu] target already flushed",
                          i);
         } else {
           DART_LOG_DEBUG("dart_waitall: -- MPI_Win_flush(handle[%zu]: %p))",
@@ -1331,8 +1453,6 @@ dart_ret_t dart_waitall(
                          i, handle[i]->dest);
           DART_LOG_TRACE("dart_waitall:      handle[%zu]->win:  %"PRIu64"",
                          i, (unsigned long)handle[i]->win);
-          DART_LOG_TRACE("dart_waitall:      handle[%zu]->req:  %"PRIu64"",
-                         i, (unsigned long)handle[i]->request);
           /*
            * MPI_Win_flush to wait for remote completion:
            */
@@ -1344,6 +1464,8 @@ dart_ret_t dart_waitall(
             free(mpi_sta);
             return DART_ERR_INVAL;
           }
+        }
+        if (handle[i]->request != MPI_REQUEST_NULL) {
           DART_LOG_TRACE("dart_waitall: -- MPI_Request_free");
           if (MPI_Request_free(&handle[i]->request) != MPI_SUCCESS) {
             DART_LOG_ERROR("dart_waitall: MPI_Request_free failed");
@@ -1771,6 +1893,82 @@ dart_ret_t dart_reduce(
   return DART_OK;
 }
 
+dart_ret_t dart_scan(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team)
+{
+  uint16_t     index;
+  MPI_Comm     comm;
+  MPI_Op       mpi_op    = dart_mpi_op(op);
+  MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_scan ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  int result = dart_adapt_teamlist_convert(team, &index);
+  if (result == -1) {
+    return DART_ERR_INVAL;
+  }
+  comm = dart_team_data[index].comm;
+  if (MPI_Scan(
+           sendbuf,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           mpi_op,
+           comm) != MPI_SUCCESS) {
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_exscan(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team)
+{
+  uint16_t     index;
+  MPI_Comm     comm;
+  MPI_Op       mpi_op    = dart_mpi_op(op);
+  MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_exscan ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  int result = dart_adapt_teamlist_convert(team, &index);
+  if (result == -1) {
+    return DART_ERR_INVAL;
+  }
+  comm = dart_team_data[index].comm;
+  if (MPI_Exscan(
+           sendbuf,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           mpi_op,
+           comm) != MPI_SUCCESS) {
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
 dart_ret_t dart_send(
   const void         * sendbuf,
   size_t              nelem,
@@ -16,6 +16,7 @@
 #include <stdint.h>
 
 #include <iostream>
+#include <vector>
 
 #include <libdash.h>
 
@@ -44,6 +45,7 @@ typedef struct benchmark_params_t {
   size_t size_base;
   size_t num_updates;
   size_t rep_base;
+  size_t batch_size;
   bool   verify;
 } benchmark_params;
 
@@ -109,6 +111,35 @@ void RandomAccessUpdate(const benchmark_params & params)
   }
 }
 
+/**
+ * Variant of RandomAccessUpdate collecting updates in batches that are
+ * applied as aggregated accumulate operations per unit.
+ */
+void RandomAccessUpdateBatched(const benchmark_params & params)
+{
+  uint64_t i;
+  uint64_t ran = starts(params.num_updates / dash::size() * dash::myid());
+  auto     table_size = params.size_base;
+
+  std::vector<index_t> indices;
+  std::vector<value_t> values;
+  indices.reserve(params.batch_size);
+  values.reserve(params.batch_size);
+  for (i = dash::myid(); i < params.num_updates; i += dash::size()) {
+    ran           = (ran << 1) ^ (((int64_t) ran < 0) ? POLY : 0);
+    int64_t g_idx = static_cast<int64_t>(ran & (table_size-1));
+    indices.push_back(g_idx);
+    values.push_back(ran);
+    if (indices.size() == params.batch_size) {
+      Table.scatter(indices, values.data(), dash::bit_xor<value_t>())
+           .wait();
+      indices.clear();
+      values.clear();
+    }
+  }
+  Table.scatter(indices, values.data(), dash::bit_xor<value_t>()).wait();
+}
+
 uint64_t RandomAccessVerify(const benchmark_params & params)
 {
   uint64_t i, localerrors, errors;
@@ -232,7 +263,11 @@ void perform_test(const benchmark_params & params)
   MPI_Pcontrol(0, "clear");
 #endif
   ts_start    = Timer::Now();
-  RandomAccessUpdate(params);
+  if (params.batch_size > 0) {
+    RandomAccessUpdateBatched(params);
+  } else {
+    RandomAccessUpdate(params);
+  }
   dash::barrier();
   duration_us = Timer::ElapsedSince(ts_start);
 #ifdef DASH_ENABLE_IPM
@@ -253,7 +288,11 @@ void perform_test(const benchmark_params & params)
   // Verification:
   if (params.verify) {
     // do it again
-    RandomAccessUpdate(params);
+    if (params.batch_size > 0) {
+      RandomAccessUpdateBatched(params);
+    } else {
+      RandomAccessUpdate(params);
+    }
     dash::barrier();
     uint64_t errors = RandomAccessVerify(params);
     if (dash::myid() == 0) {
@@ -282,6 +321,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.size_base   = TableSize;
   params.num_updates = NUPDATE;
   params.rep_base    = 1;
+  params.batch_size  = 0;
   params.verify      = false;
 
   for (auto i = 1; i < argc; i += 2) {
@@ -290,6 +330,8 @@ benchmark_params parse_args(int argc, char * argv[])
       params.size_base = atoi(argv[i+1]);
     } else if (flag == "-rb") {
       params.rep_base  = atoi(argv[i+1]);
+    } else if (flag == "-batch") {
+      params.batch_size = atoi(argv[i+1]);
     } else if (flag == "-verify") {
       params.verify    = true;
       --i;
@@ -309,6 +351,7 @@ void print_params(
   bench_cfg.print_section_start("Runtime arguments");
   bench_cfg.print_param("-sb",     "size base",    params.size_base);
   bench_cfg.print_param("-rb",     "rep. base",    params.rep_base);
+  bench_cfg.print_param("-batch",  "batch size",   params.batch_size);
   bench_cfg.print_param("-verify", "verification", params.verify);
   bench_cfg.print_section_end();
 }
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 using std::cout;
 using std::cerr;
@@ -81,8 +82,10 @@ int main(int argc, char **argv)
 
   // input, global array of keys
   dash::Array<int> key_array(TOTAL_KEYS, dash::BLOCKED);
-  // result histograms, one per unit
-  dash::Array<int> key_histo(MAX_KEY * num_units, dash::BLOCKED);
+  // result histogram, distributed
+  dash::Array<int> key_histo(MAX_KEY, dash::BLOCKED);
+  // result histogram, replicated at every unit
+  std::vector<int> key_histo_all(MAX_KEY);
 
   // PROCEDURE STEP 1 ----------------------------------------------------
   // "In a scalar sequential manner and using the key generation algorithm
@@ -143,30 +146,12 @@ int main(int argc, char **argv)
   // "Compute the rank of each key."
   //
 
-  // Compute the histogram for the values in local range:
-  for (size_t i = 0; i < key_array.lsize(); i++) {
-    int value = key_array.local[i];
-    ++key_histo.local[value];
-  }
+  // Compute the histogram of all keys:
+  dash::histogram(key_array.begin(), key_array.end(), key_histo,
+                  [](int key) { return key; });
 
-  if (dash::myid() != 0) {
-    // Add local histogram values to result histogram at unit 0:
-    dash::transform<int>(key_histo.lbegin(), // A begin
-                         key_histo.lend(),   // A end
-                         key_histo.begin(),  // B
-                         key_histo.begin(),  // C = plus(A,B)
-                         dash::plus<int>());
-  }
-  // Wait for all units to accumulate their local results to local
-  // histogram of unit 0:
-  dash::barrier();
-
-  if (dash::myid() != 0) {
-    // Overwrite local histogram result with result histogram from unit 0:
-    dash::copy(key_histo.begin(),           // Begin of block at unit 0
-               key_histo.begin() + MAX_KEY, // End of block at unit 0
-               key_histo.lbegin());
-  }
+  // Every unit obtains the result histogram:
+  dash::copy(key_histo.begin(), key_histo.end(), key_histo_all.data());
 
   // Wait for all units to obtain the result histogram:
   dash::barrier();
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <utility>
 #include <libdash.h>
 
 #include "../bench.h"
@@ -23,18 +24,11 @@ int main(int argc, char **argv)
   dash::init(&argc, &argv);
 
   int myid = dash::myid();
-  int size = dash::size();
 
   // global array of keys and histogram
   dash::Array<int> key_array(NUM_KEYS, dash::BLOCKED);
   dash::Array<int> key_histo(MAX_KEY,  dash::BLOCKED);
   
-  dash::Array<dash::GlobPtr<int>> work_buffers(size, dash::CYCLIC);
-  work_buffers[myid] = dash::memalloc<int>(MAX_KEY);
-  
-  dash::GlobPtr<int> gptr = work_buffers[myid];
-  int* work_buf = (int*) gptr;
-  
   if(myid==0) {
     for(int i=0; i<key_array.size(); i++ ) {
       key_array[i]=rand() % MAX_KEY;
@@ -50,40 +44,27 @@ int main(int argc, char **argv)
   }
   
   dash::barrier();
-  TIMESTAMP(tstart);
-
-  // compute the histogram for the local keys
-  for(int i=0; i<key_array.lsize(); i++) {
-    work_buf[ key_array.local[i] ]++; 
-  }
-
-  // turn it into a cumulative histogram
-  for(int i=0; i<MAX_KEY-1; i++ ) {
-    //work_buf[i+1] += work_buf[i];
-  }
-
-  // compute the offset of this unit's local part in 
-  // the global key_histo array
-  auto& pat = key_histo.pattern();
-  int goffs = pat.global(0);
 
-  for(int i=0; i<key_histo.lsize(); i++ ) { 
-    key_histo.local[i] = work_buf[goffs+i];
-  }
-
-  for(int unit=1; unit<size; unit++ ) {
-    dash::GlobPtr<int> remote = work_buffers[(myid+unit)%size];
-    
-    for(int i=0; i<key_histo.lsize(); i++ ) { 
-      key_histo.local[i] += remote[goffs+i];
+  // compute the histogram with privatized local histograms reduced to
+  // the owners of the bins (dense), with aggregated updates of the bins
+  // (sparse), and with the strategy selected by dash::histogram
+  std::pair<const char *, dash::HistogramStrategy> strategies[] = {
+    { "dense",     dash::HistogramStrategy::dense     },
+    { "sparse",    dash::HistogramStrategy::sparse    },
+    { "automatic", dash::HistogramStrategy::automatic }
+  };
+  for (const auto & strategy : strategies) {
+    TIMESTAMP(tstart);
+    dash::histogram(key_array.begin(), key_array.end(), key_histo,
+                    [](int key) { return key; },
+                    strategy.second);
+    TIMESTAMP(tstop);
+
+    if(myid==0) {
+      cout<<"MKeys/sec ("<<strategy.first<<"): "
+          <<(NUM_KEYS*1.0e-6)/(tstop-tstart)<<endl;
     }
   }
-  dash::barrier();
-  TIMESTAMP(tstop);
-
-  if(myid==0) {
-    cout<<"MKeys/sec: "<<(NUM_KEYS*1.0e-6)/(tstop-tstart)<<endl;
-  }
 
 #ifdef DBGOUT
   dash::barrier();
@@ -59,6 +59,9 @@ void init_values(Iter begin, Iter end, unsigned);
 template<class ArrayType>
 double test_pattern_gups(ArrayType & a, unsigned, unsigned);
 
+template<class ArrayType>
+double test_globiter_gups(ArrayType & a, unsigned, unsigned);
+
 template<class ArrayType>
 double test_raw_gups(ArrayType & a, unsigned, unsigned);
 
@@ -132,6 +135,12 @@ void perform_test(
            << "tiled"
            << ", "
            << std::setw(11)
+           << "iter-irreg"
+           << ", "
+           << std::setw(11)
+           << "iter-tiled"
+           << ", "
+           << std::setw(11)
            << "raw"
            << endl;
     }
@@ -168,6 +177,8 @@ void perform_test(
   double t_mock  = test_pattern_gups(arr_mock_dist,  ELEM_PER_UNIT, REPEAT);
   double t_irreg = test_pattern_gups(arr_irreg_dist, ELEM_PER_UNIT, REPEAT);
   double t_tiled = test_pattern_gups(arr_tiled_dist, ELEM_PER_UNIT, REPEAT);
+  double t_iirr  = test_globiter_gups(arr_irreg_dist, ELEM_PER_UNIT, REPEAT);
+  double t_itil  = test_globiter_gups(arr_tiled_dist, ELEM_PER_UNIT, REPEAT);
   double t_raw   = test_raw_gups(    arr_tiled_dist, ELEM_PER_UNIT, REPEAT);
 
   dash::barrier();
@@ -176,6 +187,8 @@ void perform_test(
     double gups_mock  = gups(num_units, t_mock,  ELEM_PER_UNIT, REPEAT);
     double gups_irreg = gups(num_units, t_irreg, ELEM_PER_UNIT, REPEAT);
     double gups_tiled = gups(num_units, t_tiled, ELEM_PER_UNIT, REPEAT);
+    double gups_iirr  = gups(num_units, t_iirr,  ELEM_PER_UNIT, REPEAT);
+    double gups_itil  = gups(num_units, t_itil,  ELEM_PER_UNIT, REPEAT);
     double gups_raw   = gups(num_units, t_raw,   ELEM_PER_UNIT, REPEAT);
 
     cout << std::setw(10)
@@ -197,6 +210,12 @@ void perform_test(
          << gups_tiled
          << ", "
          << std::setw(11) << std::fixed << std::setprecision(4)
+         << gups_iirr
+         << ", "
+         << std::setw(11) << std::fixed << std::setprecision(4)
+         << gups_itil
+         << ", "
+         << std::setw(11) << std::fixed << std::setprecision(4)
          << gups_raw
          << endl;
   }
@@ -243,6 +262,28 @@ double test_pattern_gups(
   return Timer::ElapsedSince(ts_start);
 }
 
+template <class ArrayType>
+double test_globiter_gups(
+  ArrayType & a,
+  unsigned ELEM_PER_UNIT,
+  unsigned REPEAT)
+{
+  init_values(a.lbegin(), a.lend(), ELEM_PER_UNIT);
+
+  auto a_begin  = a.begin();
+  auto a_end    = a.end();
+  auto ts_start = Timer::Now();
+  for (auto i = 0; i < REPEAT; ++i) {
+    for (auto it = a_begin; it != a_end; ++it) {
+      auto l_ptr = it.local();
+      if (l_ptr != nullptr) {
+        ++(*l_ptr);
+      }
+    }
+  }
+  return Timer::ElapsedSince(ts_start);
+}
+
 template <class ArrayType>
 double test_raw_gups(
   ArrayType & a,
@@ -57,6 +57,7 @@ typedef struct measurement_t
     double time_med_us;
     double time_sdv_us;
     double mkeys_per_s;
+    int    num_cores;
   }
   measurement;
 
@@ -326,6 +327,14 @@ measurement perform_test(
   DASH_LOG_DEBUG("perform_test", "Waiting for completion of all units");
   dash::barrier();
 
+  // Total number of threads of all units in the local phase:
+  dash::Array<int> unit_threads(dash::size());
+  unit_threads.local[0] = dash::internal::local_num_threads(
+                            dash::execution::par, arr.lsize());
+  unit_threads.barrier();
+  result.num_cores   = dash::accumulate(unit_threads.begin(),
+                                        unit_threads.end(), 0);
+
   double mkeys       = static_cast<double>(NELEM * REPEAT)
                        / 1024.0 / 1024.0;
 
@@ -358,7 +367,9 @@ void print_measurement_header()
         << std::setw(12) << "time.max.us" << ","
         << std::setw(12) << "time.sdv.us" << ","
         << std::setw( 8) << "total.s"     << ","
-        << std::setw(10) << "mkeys/s"
+        << std::setw( 6) << "cores"       << ","
+        << std::setw(10) << "mkeys/s"     << ","
+        << std::setw(12) << "mkeys/s/core"
         << endl;
     std::cout << oss.str();
   }
@@ -396,7 +407,10 @@ void print_measurement_record(
       << std::fixed << setprecision(2) << setw(12) << time_max_us << ","
       << std::fixed << setprecision(2) << setw(12) << time_sdv_us << ","
       << std::fixed << setprecision(2) << setw( 8) << secs        << ","
-      << std::fixed << setprecision(2) << setw(10) << mkps
+      << std::setw( 6) << measurement.num_cores                   << ","
+      << std::fixed << setprecision(2) << setw(10) << mkps        << ","
+      << std::fixed << setprecision(2) << setw(12)
+      << mkps / measurement.num_cores
       << endl;
   std::cout << oss.str();
 }
@@ -1,7 +1,9 @@
 #include <libdash.h>
 
+#include <array>
 #include <iostream>
 #include <iomanip>
+#include <string>
 
 using std::cout;
 using std::cerr;
@@ -67,11 +69,13 @@ typedef struct measurement_t
 measurement perform_test(
   size_t                   NELEM,
   size_t                   REPEAT,
+  const std::string      & testcase,
   const benchmark_params & params);
 
 void print_measurement_header();
 void print_measurement_record(
   const bench_cfg_params & cfg_params,
+  const std::string      & testcase,
   size_t                   size,
   int                      num_repeats,
   double                   secs,
@@ -137,6 +141,21 @@ int main(int argc, char **argv)
 
   print_measurement_header();
 
+  // c = a + b in owner-computes transform of aligned ranges, with input
+  // range b shifted by one element so units fetch elements from their
+  // neighbor, and c += a as atomic accumulate.
+  // c = a * b + c with three input ranges, and sum of a * b in fused
+  // transform_reduce compared to transform followed by accumulate.
+  std::array<std::string, 7> testcases {{
+                                          "dash::transform",
+                                          "dash::transform.par",
+                                          "dash::transform.shift",
+                                          "dash::transform.accumulate",
+                                          "dash::zip_transform",
+                                          "dash::transform_reduce",
+                                          "transform+accumulate"
+                                        }};
+
   dash::barrier();
 
   num_repeats = params.num_repeats;
@@ -149,24 +168,26 @@ int main(int argc, char **argv)
 
     num_repeats = std::max<size_t>(num_repeats, params.min_repeats);
 
-    dash::util::TraceStore::on();
-    dash::util::TraceStore::clear();
+    for (auto testcase : testcases) {
+      dash::util::TraceStore::on();
+      dash::util::TraceStore::clear();
 
-    ts_start = Timer::Now();
-    res      = perform_test(size, num_repeats, params);
-    time_s   = Timer::ElapsedSince(ts_start) * 1.0e-06;
+      ts_start = Timer::Now();
+      res      = perform_test(size, num_repeats, testcase, params);
+      time_s   = Timer::ElapsedSince(ts_start) * 1.0e-06;
 
-    dash::barrier();
+      dash::barrier();
 
-    std::ostringstream ss;
-    ss << "transform.iteration-" << i;
+      std::ostringstream ss;
+      ss << "transform.iteration-" << i << "." << testcase;
 
-    dash::util::TraceStore::write(ss.str());
-    dash::util::TraceStore::clear();
-    dash::util::TraceStore::off();
+      dash::util::TraceStore::write(ss.str());
+      dash::util::TraceStore::clear();
+      dash::util::TraceStore::off();
 
-    print_measurement_record(bench_cfg, size, num_repeats,
-                             time_s, res, params);
+      print_measurement_record(bench_cfg, testcase, size, num_repeats,
+                               time_s, res, params);
+    }
   }
 
   dash::finalize();
@@ -177,6 +198,7 @@ int main(int argc, char **argv)
 measurement perform_test(
   size_t                   NELEM,
   size_t                   REPEAT,
+  const std::string      & testcase,
   const benchmark_params & params)
 {
   measurement result;
@@ -234,10 +256,51 @@ measurement perform_test(
     }
 
     auto ts_start = Timer::Now();
-    auto min_git  = dash::transform(arr_a.begin(), arr_a.end(),
-                                    arr_b.begin(),
-                                    arr_c.begin(),
-                                    dash::plus<ElementType>());
+    if (testcase == "dash::transform") {
+      dash::transform(arr_a.begin(), arr_a.end(),
+                      arr_b.begin(),
+                      arr_c.begin(),
+                      dash::plus<ElementType>());
+    } else if (testcase == "dash::transform.par") {
+      dash::transform(dash::execution::par,
+                      arr_a.begin(), arr_a.end(),
+                      arr_b.begin(),
+                      arr_c.begin(),
+                      [](ElementType a, ElementType b) { return a + b; });
+    } else if (testcase == "dash::transform.shift") {
+      dash::transform(dash::execution::par,
+                      arr_a.begin(), arr_a.end() - 1,
+                      arr_b.begin() + 1,
+                      arr_c.begin(),
+                      dash::plus<ElementType>());
+    } else if (testcase == "dash::transform.accumulate") {
+      dash::transform(arr_a.begin(), arr_a.end(),
+                      arr_c.begin(),
+                      arr_c.begin(),
+                      dash::plus<ElementType>());
+    } else if (testcase == "dash::zip_transform") {
+      dash::zip_transform(dash::execution::par,
+                          arr_c.begin(), arr_c.end(),
+                          [](ElementType a, ElementType b, ElementType c) {
+                            return a * b + c;
+                          },
+                          arr_a.begin(), arr_b.begin(), arr_c.begin());
+    } else if (testcase == "dash::transform_reduce") {
+      dash::transform_reduce(dash::execution::par,
+                             arr_a.begin(), arr_a.end(),
+                             arr_b.begin(),
+                             ElementType(0),
+                             dash::plus<ElementType>(),
+                             dash::multiply<ElementType>());
+    } else if (testcase == "transform+accumulate") {
+      dash::transform(dash::execution::par,
+                      arr_a.begin(), arr_a.end(),
+                      arr_b.begin(),
+                      arr_c.begin(),
+                      dash::multiply<ElementType>());
+      dash::barrier();
+      dash::accumulate(arr_c.begin(), arr_c.end(), ElementType(0));
+    }
     auto time_us  = Timer::ElapsedSince(ts_start);
 
     if (REPEAT == 1 || i == 1) {
@@ -247,7 +310,7 @@ measurement perform_test(
     total_time_us += time_us;
     history_time_us.push_back(time_us);
 
-    if (params.verify) {
+    if (params.verify && testcase == "dash::transform") {
       // Test first local 1000 values only:
       for (size_t li = 0; li < std::min<size_t>(1000, arr_a.lsize()); li++) {
         auto expected = arr_a.local[li] + arr_b.local[li];
@@ -256,7 +319,7 @@ measurement perform_test(
           std::cout <<
             "dash::transform: " <<
             "expected (" << expected << ") != " <<
-            "actual ("   << expected << ")"     <<
+            "actual ("   << actual   << ")"     <<
             "at unit:"   << dash::myid() << " " <<
             "lidx:"      << li           << " " <<
             "in repeat " << i
@@ -307,6 +370,7 @@ void print_measurement_header()
     oss << std::right
         << std::setw(5)  << "units"       << ","
         << std::setw(9)  << "mpi.impl"    << ","
+        << std::setw(28) << "testcase"    << ","
         << std::setw(8)  << "repeats"     << ","
         << std::setw(11) << "size"        << ","
         << std::setw( 8) << "time.s"      << ","
@@ -323,6 +387,7 @@ void print_measurement_header()
 
 void print_measurement_record(
   const bench_cfg_params & cfg_params,
+  const std::string      & testcase,
   size_t                   size,
   int                      num_repeats,
   double                   secs,
@@ -345,6 +410,7 @@ void print_measurement_record(
   oss << std::right
       << std::setw(5)  << dash::size() << ","
       << std::setw(9)  << mpi_impl     << ","
+      << std::setw(28) << testcase     << ","
       << std::setw(8)  << num_repeats  << ","
       << std::setw(11) << size         << ","
       << std::fixed << setprecision(2) << setw( 8) << time_s      << ","
@@ -1,12 +1,19 @@
 /**
  * Measures the performance of different
- * for_each implementations on dash containers
+ * for_each implementations on dash containers.
+ *
+ * Testcases with suffix \c .seq, \c .par and \c .par_unseq use the
+ * respective execution policy for \c dash::fill and \c dash::for_each.
+ * For node-level scaling, run one unit per socket or node and compare
+ * the throughput of the policies for varying numbers of threads per unit
+ * (\c OMP_NUM_THREADS, \c DASH_DISABLE_THREADS).
  */
 
 #include <libdash.h>
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <cmath>
 
 using std::cout;
 using std::endl;
@@ -27,6 +34,7 @@ typedef struct benchmark_params_t {
 
 typedef struct measurement_t {
   std::string testcase;
+  int         num_threads;
   double      local_elems_s;
   double      local_size_mb;
   double      time_fill_s;
@@ -74,10 +82,13 @@ int main(int argc, char** argv)
 
   int     multiplier = 1;
   double  round_time = 0;
-  std::array<std::string, 3> testcases {{
+  std::array<std::string, 6> testcases {{
                             "std::for_each.l",
                             "dash::for_each.g",
-                            "dash::for_each_with_index.g" }};
+                            "dash::for_each_with_index.g",
+                            "dash::for_each.seq",
+                            "dash::for_each.par",
+                            "dash::for_each.par_unseq" }};
   // Get locality information
   long num_nodes          = dash::util::Locality::NumNodes();
   long mb_per_node        = 8; // Intermediate, should be
@@ -131,11 +142,25 @@ measurement evaluate(long size, std::string testcase, benchmark_params params)
       sum+=el;
     };
 
+  // Thread-safe element operation for parallel execution policies:
+  auto for_each_sqrt = [](int & el) {
+        el = static_cast<int>(std::sqrt(static_cast<double>(el)));
+      };
+
   dash::barrier();
   auto ts_tot_start = Timer::Now();
-  dash::fill(begin, end, 1);
+  if(testcase == "dash::for_each.par") {
+    dash::fill(dash::execution::par, begin, end, 1);
+  } else if(testcase == "dash::for_each.par_unseq") {
+    dash::fill(dash::execution::par_unseq, begin, end, 1);
+  } else if(testcase == "dash::for_each.seq") {
+    dash::fill(dash::execution::seq, begin, end, 1);
+  } else {
+    dash::fill(begin, end, 1);
+  }
   mes.time_fill_s = Timer::ElapsedSince(ts_tot_start) / (1000 * 1000);
 
+  mes.num_threads = 1;
   auto ts_foreach_start = Timer::Now();
 
   if(testcase == "dash::for_each.g") {
@@ -144,6 +169,16 @@ measurement evaluate(long size, std::string testcase, benchmark_params params)
     dash::for_each_with_index(begin, end, for_each_index);
   } else if(testcase == "std::for_each.l") {
     std::for_each(lbegin, lend, for_each);
+  } else if(testcase == "dash::for_each.seq") {
+    dash::for_each(dash::execution::seq, begin, end, for_each_sqrt);
+  } else if(testcase == "dash::for_each.par") {
+    mes.num_threads = dash::internal::local_num_threads(
+                        dash::execution::par, lsize);
+    dash::for_each(dash::execution::par, begin, end, for_each_sqrt);
+  } else if(testcase == "dash::for_each.par_unseq") {
+    mes.num_threads = dash::internal::local_num_threads(
+                        dash::execution::par_unseq, lsize);
+    dash::for_each(dash::execution::par_unseq, begin, end, for_each_sqrt);
   }
 
   mes.time_foreach_s = Timer::ElapsedSince(ts_foreach_start) / (1000 * 1000);
@@ -163,6 +198,7 @@ void print_measurement_header()
          << std::setw(12) << "l.size.mb"  << ","
          << std::setw(13) << "l.elems/s"  << ","
          << std::setw(30) << "impl"       << ","
+         << std::setw( 8) << "threads"    << ","
          << std::setw( 8) << "fill.s"     << ","
          << std::setw( 8) << "foreach.s"  << ","
          << std::setw( 8) << "total.s"
@@ -184,6 +220,7 @@ void print_measurement_record(
          << std::fixed << setprecision(2) << setw(12) << mes.local_size_mb  << ","
          << std::fixed << setprecision(2) << setw(12) << (mes.local_elems_s / 1000) << "k,"
          << std::fixed << setprecision(2) << setw(30) << mes.testcase       << ","
+         << std::setw(8) << mes.num_threads                                 << ","
          << std::fixed << setprecision(2) << setw(12) << mes.time_fill_s    << ","
          << std::fixed << setprecision(2) << setw(14) << mes.time_foreach_s << ","
          << std::fixed << setprecision(2) << setw(12) << mes.time_total_s
@@ -203,7 +240,7 @@ benchmark_params parse_args(int argc, char * argv[])
       params.size_base      = atoi(argv[i+1]);
     }
     if (flag == "-tmax") {
-      params.size_base      = atoi(argv[i+1]);
+      params.max_time       = atoi(argv[i+1]);
     }
   }
   return params;
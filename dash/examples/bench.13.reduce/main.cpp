@@ -0,0 +1,224 @@
+/**
+ * Measures the latency of collective reductions in dash::accumulate,
+ * dash::equal and dash::all_of depending on the number of units.
+ *
+ * The reduction of local results in a temporary dash::Array read by
+ * unit 0, as used by these algorithms before, is measured as reference.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <array>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef dash::Array<long> Array_t;
+
+typedef struct benchmark_params_t {
+  long   local_size;
+  int    repeat;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  double      time_us;
+  bool        valid;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+measurement evaluate(
+              Array_t          & array_a,
+              Array_t          & array_b,
+              std::string        testcase,
+              benchmark_params   params);
+
+/**
+ * Reference implementation: local results are stored in a temporary
+ * array and reduced by unit 0 in blocking reads.
+ */
+long accumulate_array_reduce(
+  Array_t::iterator first,
+  Array_t::iterator last,
+  long              init)
+{
+  auto & team        = first.team();
+  auto   index_range = dash::local_range(first, last);
+  auto   l_result    = std::accumulate(index_range.begin,
+                                       index_range.end, 0L);
+  long   result      = init;
+
+  dash::Array<long> l_results(team.size());
+  l_results.local[0] = l_result;
+
+  team.barrier();
+
+  if (team.myid() == 0) {
+    for (size_t u = 0; u < team.size(); u++) {
+      result += l_results[u];
+    }
+  }
+  return result;
+}
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.13.reduce");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  std::array<std::string, 5> testcases {{
+                            "array-reduce (reference)",
+                            "dash::accumulate",
+                            "dash::accumulate.custom-op",
+                            "dash::equal",
+                            "dash::all_of" }};
+
+  Array_t array_a(params.local_size * dash::size());
+  Array_t array_b(params.local_size * dash::size());
+  dash::fill(array_a.begin(), array_a.end(), 1L);
+  dash::fill(array_b.begin(), array_b.end(), 1L);
+  dash::barrier();
+
+  for (auto testcase : testcases) {
+    auto res = evaluate(array_a, array_b, testcase, params);
+    print_measurement_record(res, params);
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+measurement evaluate(
+  Array_t          & array_a,
+  Array_t          & array_b,
+  std::string        testcase,
+  benchmark_params   params)
+{
+  measurement mes;
+  long expected = array_a.size();
+  bool valid    = true;
+
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (int r = 0; r < params.repeat; ++r) {
+    if (testcase == "array-reduce (reference)") {
+      auto res = accumulate_array_reduce(array_a.begin(), array_a.end(), 0);
+      // Result is only valid at unit 0:
+      valid &= (dash::myid() != 0 || res == expected);
+    } else if (testcase == "dash::accumulate") {
+      auto res = dash::accumulate(array_a.begin(), array_a.end(), 0L);
+      valid &= (res == expected);
+    } else if (testcase == "dash::accumulate.custom-op") {
+      auto res = dash::accumulate(array_a.begin(), array_a.end(), 0L,
+                                  [](long a, long b) { return a + b; });
+      valid &= (res == expected);
+    } else if (testcase == "dash::equal") {
+      valid &= dash::equal(array_a.begin(), array_a.end(),
+                           array_b.begin());
+    } else if (testcase == "dash::all_of") {
+      valid &= dash::all_of(array_a.begin(), array_a.end(),
+                            [](long v) { return v == 1; });
+    }
+  }
+  mes.time_us  = Timer::ElapsedSince(ts_start) / params.repeat;
+  mes.testcase = testcase;
+  mes.valid    = valid;
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 7) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(10) << "l.size"     << ","
+         << std::setw(30) << "impl"       << ","
+         << std::setw(12) << "us/call"    << ","
+         << std::setw( 7) << "valid"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    auto mes = measurement;
+    cout << std::right
+         << std::setw( 7) << dash::size()      << ","
+         << std::setw( 9) << mpi_impl          << ","
+         << std::setw(10) << params.local_size << ","
+         << std::setw(30) << mes.testcase      << ","
+         << std::fixed << setprecision(2) << setw(12) << mes.time_us << ","
+         << std::setw( 7) << (mes.valid ? "yes" : "no")
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.local_size = 1000;
+  params.repeat     = 100;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-ls") {
+      params.local_size = atol(argv[i+1]);
+    }
+    if (flag == "-r") {
+      params.repeat     = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-ls", "elements per unit", params.local_size);
+  bench_cfg.print_param("-r",  "repetitions",       params.repeat);
+  bench_cfg.print_section_end();
+}
@@ -0,0 +1,284 @@
+/**
+ * Measures the throughput of dash::sort for keys following the
+ * NAS Parallel Benchmark IS problem classes.
+ *
+ * In strong scaling mode (default), the total number of keys is given by
+ * the problem class. In weak scaling mode, the number of keys per unit is
+ * given by the problem class.
+ * The time of std::sort on the local keys of a unit is measured as lower
+ * bound reference.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+#include <limits>
+#include <algorithm>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef int                    key_type;
+typedef dash::Array<key_type>  Array_t;
+
+#define CLASS_S__TOTAL_KEYS  (1 << 16)
+#define CLASS_S__MAX_KEY     (1 << 11)
+
+#define CLASS_W__TOTAL_KEYS  (1 << 20)
+#define CLASS_W__MAX_KEY     (1 << 16)
+
+#define CLASS_A__TOTAL_KEYS  (1 << 23)
+#define CLASS_A__MAX_KEY     (1 << 19)
+
+#define CLASS_B__TOTAL_KEYS  (1 << 25)
+#define CLASS_B__MAX_KEY     (1 << 21)
+
+#define CLASS_C__TOTAL_KEYS  (1 << 27)
+#define CLASS_C__MAX_KEY     (1 << 23)
+
+#define CLASS_D__TOTAL_KEYS  (1L << 29)
+#define CLASS_D__MAX_KEY     (1 << 27)
+
+typedef struct benchmark_params_t {
+  char   class_name;
+  bool   weak_scaling;
+  long   total_keys;
+  long   max_key;
+  int    repeat;
+  bool   verify;
+} benchmark_params;
+
+typedef struct measurement_t {
+  double time_min_s;
+  double time_avg_s;
+  double time_max_s;
+  double time_local_s;
+  bool   valid;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+void print_measurement_header();
+void print_measurement_record(
+  const measurement      & mes,
+  const benchmark_params & params);
+
+/**
+ * Generates keys with the distribution used in NAS IS, the average of
+ * four uniformly distributed random numbers.
+ */
+void generate_keys(
+  Array_t                & keys,
+  const benchmark_params & params,
+  int                      seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<long> dist(0, params.max_key / 4 - 1);
+  for (auto lit = keys.lbegin(); lit != keys.lend(); ++lit) {
+    *lit = static_cast<key_type>(
+             dist(rng) + dist(rng) + dist(rng) + dist(rng));
+  }
+  keys.barrier();
+}
+
+measurement evaluate(const benchmark_params & params)
+{
+  measurement mes;
+  mes.time_min_s   = std::numeric_limits<double>::max();
+  mes.time_max_s   = 0;
+  mes.time_avg_s   = 0;
+  mes.time_local_s = 0;
+  mes.valid        = true;
+
+  Array_t keys(params.total_keys);
+
+  for (int rep = 0; rep < params.repeat; ++rep) {
+    // Reference: sort local keys only
+    generate_keys(keys, params, dash::myid() + rep);
+    auto ts_local_start = Timer::Now();
+    std::sort(keys.lbegin(), keys.lend());
+    mes.time_local_s += Timer::ElapsedSince(ts_local_start) * 1.0e-6;
+    keys.barrier();
+
+    generate_keys(keys, params, dash::myid() + rep);
+    auto ts_start = Timer::Now();
+    dash::sort(keys.begin(), keys.end());
+    double time_s  = Timer::ElapsedSince(ts_start) * 1.0e-6;
+    mes.time_min_s = std::min(mes.time_min_s, time_s);
+    mes.time_max_s = std::max(mes.time_max_s, time_s);
+    mes.time_avg_s += time_s;
+
+    if (params.verify) {
+      // Local keys are sorted and not less than the last key of the
+      // preceding unit:
+      bool l_valid = std::is_sorted(keys.lbegin(), keys.lend());
+      if (keys.lsize() > 0 && keys.pattern().global(0) > 0) {
+        key_type pred_key = keys[keys.pattern().global(0) - 1];
+        l_valid &= pred_key <= *keys.lbegin();
+      }
+      dash::Array<int> valid_flags(dash::size());
+      valid_flags.local[0] = l_valid ? 1 : 0;
+      valid_flags.barrier();
+      mes.valid &= dash::accumulate(valid_flags.begin(), valid_flags.end(),
+                                    0) == static_cast<int>(dash::size());
+    }
+  }
+  mes.time_avg_s   /= params.repeat;
+  mes.time_local_s /= params.repeat;
+  return mes;
+}
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.14.sort");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  auto mes = evaluate(params);
+  print_measurement_record(mes, params);
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 7) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw( 6) << "class"      << ","
+         << std::setw( 7) << "scaling"    << ","
+         << std::setw(11) << "n"          << ","
+         << std::setw( 9) << "repeats"    << ","
+         << std::setw( 9) << "min.s"      << ","
+         << std::setw( 9) << "avg.s"      << ","
+         << std::setw( 9) << "max.s"      << ","
+         << std::setw( 9) << "local.s"    << ","
+         << std::setw(10) << "mkeys/s"    << ","
+         << std::setw(10) << "mkeys/s/u"  << ","
+         << std::setw( 6) << "valid"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const measurement      & mes,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    double mkeys_s   = params.total_keys / mes.time_avg_s * 1.0e-6;
+    cout << std::right
+         << std::setw( 7) << dash::size()         << ","
+         << std::setw( 9) << mpi_impl             << ","
+         << std::setw( 6) << params.class_name    << ","
+         << std::setw( 7) << (params.weak_scaling ? "weak" : "strong") << ","
+         << std::setw(11) << params.total_keys    << ","
+         << std::setw( 9) << params.repeat        << ","
+         << std::fixed << setprecision(4)
+         << std::setw( 9) << mes.time_min_s       << ","
+         << std::setw( 9) << mes.time_avg_s       << ","
+         << std::setw( 9) << mes.time_max_s       << ","
+         << std::setw( 9) << mes.time_local_s     << ","
+         << setprecision(2)
+         << std::setw(10) << mkeys_s              << ","
+         << std::setw(10) << mkeys_s / dash::size() << ","
+         << std::setw( 6) << (params.verify
+                              ? (mes.valid ? "yes" : "no")
+                              : "-")
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.class_name   = 'A';
+  params.weak_scaling = false;
+  params.repeat       = 5;
+  params.verify       = false;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-c") {
+      params.class_name   = argv[i+1][0];
+    } else if (flag == "-s") {
+      params.weak_scaling = std::string(argv[i+1]) == "weak";
+    } else if (flag == "-r") {
+      params.repeat       = atoi(argv[i+1]);
+    } else if (flag == "-v") {
+      params.verify       = atoi(argv[i+1]) != 0;
+    }
+  }
+  switch (params.class_name) {
+    case 'S': params.total_keys = CLASS_S__TOTAL_KEYS;
+              params.max_key    = CLASS_S__MAX_KEY;
+              break;
+    case 'W': params.total_keys = CLASS_W__TOTAL_KEYS;
+              params.max_key    = CLASS_W__MAX_KEY;
+              break;
+    case 'B': params.total_keys = CLASS_B__TOTAL_KEYS;
+              params.max_key    = CLASS_B__MAX_KEY;
+              break;
+    case 'C': params.total_keys = CLASS_C__TOTAL_KEYS;
+              params.max_key    = CLASS_C__MAX_KEY;
+              break;
+    case 'D': params.total_keys = CLASS_D__TOTAL_KEYS;
+              params.max_key    = CLASS_D__MAX_KEY;
+              break;
+    default:  params.class_name = 'A';
+              params.total_keys = CLASS_A__TOTAL_KEYS;
+              params.max_key    = CLASS_A__MAX_KEY;
+              break;
+  }
+  if (params.weak_scaling) {
+    params.total_keys *= dash::size();
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-c", "NAS IS problem class", params.class_name);
+  bench_cfg.print_param("-s", "scaling (strong, weak)",
+                        params.weak_scaling ? "weak" : "strong");
+  bench_cfg.print_param("-r", "repetitions",          params.repeat);
+  bench_cfg.print_param("-v", "verify result",        params.verify);
+  bench_cfg.print_param("",   "total keys",           params.total_keys);
+  bench_cfg.print_param("",   "max. key",             params.max_key);
+  bench_cfg.print_section_end();
+}
@@ -0,0 +1,229 @@
+/**
+ * Measures the time until dash::find returns the first match in an
+ * array depending on the global position of the match.
+ *
+ * For every measured position, a single element in the array matches
+ * the searched value. The time of a search without match, traversing
+ * the complete local range at every unit, is measured as reference.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <limits>
+#include <algorithm>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef int                           value_type;
+typedef dash::Array<value_type>       Array_t;
+typedef Array_t::index_type           index_t;
+
+typedef struct benchmark_params_t {
+  long   size_per_unit;
+  int    repeat;
+  int    num_positions;
+} benchmark_params;
+
+typedef struct measurement_t {
+  double time_min_s;
+  double time_avg_s;
+  double time_max_s;
+  bool   valid;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+void print_measurement_header();
+void print_measurement_record(
+  index_t                  match_pos,
+  const Array_t          & array,
+  const measurement      & mes,
+  double                   time_full_s,
+  const benchmark_params & params);
+
+/**
+ * Measures the duration of dash::find for the value 1 in the given array,
+ * expecting the result at global index \c match_pos.
+ */
+measurement evaluate(
+  Array_t                & array,
+  index_t                  match_pos,
+  const benchmark_params & params)
+{
+  measurement mes;
+  mes.time_min_s = std::numeric_limits<double>::max();
+  mes.time_max_s = 0;
+  mes.time_avg_s = 0;
+  mes.valid      = true;
+
+  for (int rep = 0; rep < params.repeat; ++rep) {
+    array.barrier();
+    auto ts_start = Timer::Now();
+    auto found    = dash::find(array.begin(), array.end(), 1);
+    double time_s  = Timer::ElapsedSince(ts_start) * 1.0e-6;
+    mes.time_min_s = std::min(mes.time_min_s, time_s);
+    mes.time_max_s = std::max(mes.time_max_s, time_s);
+    mes.time_avg_s += time_s;
+    mes.valid &= found.pos() == match_pos;
+  }
+  mes.time_avg_s /= params.repeat;
+  return mes;
+}
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.15.find");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+
+  Array_t array(params.size_per_unit * dash::size());
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  // Reference: no match, every unit searches its complete local range
+  auto mes_full = evaluate(array, array.size(), params);
+
+  print_measurement_header();
+  print_measurement_record(array.size(), array, mes_full,
+                           mes_full.time_avg_s, params);
+
+  // Match positions evenly spaced in the global range, starting at the
+  // first element:
+  for (int p = 0; p < params.num_positions; ++p) {
+    index_t match_pos = static_cast<index_t>(
+                          (array.size() - 1) * p
+                          / std::max(1, params.num_positions - 1));
+    if (dash::myid() == 0) {
+      array[match_pos] = 1;
+    }
+    array.barrier();
+
+    auto mes = evaluate(array, match_pos, params);
+    print_measurement_record(match_pos, array, mes,
+                             mes_full.time_avg_s, params);
+
+    if (dash::myid() == 0) {
+      array[match_pos] = 0;
+    }
+    array.barrier();
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 7) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(12) << "n"          << ","
+         << std::setw(12) << "match.pos"  << ","
+         << std::setw( 9) << "match.rel"  << ","
+         << std::setw( 9) << "repeats"    << ","
+         << std::setw(10) << "min.s"      << ","
+         << std::setw(10) << "avg.s"      << ","
+         << std::setw(10) << "max.s"      << ","
+         << std::setw( 9) << "speedup"    << ","
+         << std::setw( 6) << "valid"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  index_t                  match_pos,
+  const Array_t          & array,
+  const measurement      & mes,
+  double                   time_full_s,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    bool   found     = match_pos < static_cast<index_t>(array.size());
+    double match_rel = static_cast<double>(match_pos) / array.size();
+    cout << std::right
+         << std::setw( 7) << dash::size()         << ","
+         << std::setw( 9) << mpi_impl             << ","
+         << std::setw(12) << array.size()         << ",";
+    if (found) {
+      cout << std::setw(12) << match_pos          << ","
+           << std::fixed << setprecision(3)
+           << std::setw( 9) << match_rel          << ",";
+    } else {
+      cout << std::setw(12) << "none"             << ","
+           << std::setw( 9) << "-"                << ",";
+    }
+    cout << std::setw( 9) << params.repeat        << ","
+         << std::fixed << setprecision(6)
+         << std::setw(10) << mes.time_min_s       << ","
+         << std::setw(10) << mes.time_avg_s       << ","
+         << std::setw(10) << mes.time_max_s       << ","
+         << setprecision(2)
+         << std::setw( 9) << time_full_s / mes.time_avg_s << ","
+         << std::setw( 6) << (mes.valid ? "yes" : "no")
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_per_unit = 1 << 24;
+  params.repeat        = 10;
+  params.num_positions = 9;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-n") {
+      params.size_per_unit = atol(argv[i+1]);
+    } else if (flag == "-r") {
+      params.repeat        = atoi(argv[i+1]);
+    } else if (flag == "-p") {
+      params.num_positions = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-n", "elements per unit",  params.size_per_unit);
+  bench_cfg.print_param("-r", "repetitions",        params.repeat);
+  bench_cfg.print_param("-p", "match positions",    params.num_positions);
+  bench_cfg.print_section_end();
+}
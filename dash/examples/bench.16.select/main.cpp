@@ -0,0 +1,258 @@
+/**
+ * Measures distributed selection of the median and the k smallest
+ * elements of an array with dash::nth_element and dash::partial_sort_copy
+ * against sorting the array with dash::sort.
+ *
+ * Results of all testcases are validated against the result obtained
+ * from the sorted array.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+#include <limits>
+#include <algorithm>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef int                    key_type;
+typedef dash::Array<key_type>  Array_t;
+
+typedef struct benchmark_params_t {
+  long   size_per_unit;
+  long   top_k;
+  int    repeat;
+} benchmark_params;
+
+typedef struct measurement_t {
+  double time_min_s;
+  double time_avg_s;
+  double time_max_s;
+  bool   valid;
+} measurement;
+
+typedef struct selection_t {
+  key_type              median;
+  std::vector<key_type> top_k;
+} selection;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+void print_measurement_header();
+void print_measurement_record(
+  const std::string      & testcase,
+  const Array_t          & keys,
+  const measurement      & mes,
+  double                   time_sort_s,
+  const benchmark_params & params);
+
+void generate_keys(
+  Array_t & keys,
+  int       seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<key_type> dist(
+    0, std::numeric_limits<key_type>::max());
+  for (auto lit = keys.lbegin(); lit != keys.lend(); ++lit) {
+    *lit = dist(rng);
+  }
+  keys.barrier();
+}
+
+/**
+ * Selects the median or the k smallest keys in the given testcase,
+ * returning the time of the selection.
+ */
+double select(
+  const std::string      & testcase,
+  Array_t                & keys,
+  const benchmark_params & params,
+  selection              & result)
+{
+  auto median_pos = keys.size() / 2;
+  result.top_k.resize(params.top_k);
+
+  auto ts_start = Timer::Now();
+  if (testcase == "sort.median") {
+    dash::sort(keys.begin(), keys.end());
+    result.median = keys[median_pos];
+  } else if (testcase == "nth_element.median") {
+    dash::nth_element(keys.begin(), keys.begin() + median_pos, keys.end());
+    result.median = keys[median_pos];
+  } else if (testcase == "sort.top_k") {
+    dash::sort(keys.begin(), keys.end());
+    dash::copy(keys.begin(), keys.begin() + params.top_k,
+               result.top_k.data());
+  } else if (testcase == "partial_sort_copy.top_k") {
+    dash::partial_sort_copy(keys.begin(), keys.end(),
+                            result.top_k.begin(), result.top_k.end());
+  }
+  double time_s = Timer::ElapsedSince(ts_start) * 1.0e-6;
+  keys.barrier();
+  return time_s;
+}
+
+measurement evaluate(
+  const std::string      & testcase,
+  Array_t                & keys,
+  const benchmark_params & params)
+{
+  measurement mes;
+  mes.time_min_s = std::numeric_limits<double>::max();
+  mes.time_max_s = 0;
+  mes.time_avg_s = 0;
+  mes.valid      = true;
+
+  bool select_median = testcase.find("median") != std::string::npos;
+
+  for (int rep = 0; rep < params.repeat; ++rep) {
+    // Reference result from sorted keys:
+    selection expected;
+    generate_keys(keys, dash::myid() + rep);
+    select(select_median ? "sort.median" : "sort.top_k",
+           keys, params, expected);
+
+    selection result;
+    generate_keys(keys, dash::myid() + rep);
+    double time_s  = select(testcase, keys, params, result);
+    mes.time_min_s = std::min(mes.time_min_s, time_s);
+    mes.time_max_s = std::max(mes.time_max_s, time_s);
+    mes.time_avg_s += time_s;
+    mes.valid &= select_median
+                 ? result.median == expected.median
+                 : result.top_k  == expected.top_k;
+  }
+  mes.time_avg_s /= params.repeat;
+  return mes;
+}
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.16.select");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  Array_t keys(params.size_per_unit * dash::size());
+
+  for (std::string selection : { "median", "top_k" }) {
+    auto mes_sort = evaluate("sort." + selection, keys, params);
+    print_measurement_record("dash::sort", keys, mes_sort,
+                             mes_sort.time_avg_s, params);
+    std::string select_algo = selection == "median"
+                              ? "nth_element" : "partial_sort_copy";
+    auto mes = evaluate(select_algo + "." + selection, keys, params);
+    print_measurement_record("dash::" + select_algo, keys, mes,
+                             mes_sort.time_avg_s, params);
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 7) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(24) << "testcase"   << ","
+         << std::setw(12) << "n"          << ","
+         << std::setw( 9) << "repeats"    << ","
+         << std::setw(10) << "min.s"      << ","
+         << std::setw(10) << "avg.s"      << ","
+         << std::setw(10) << "max.s"      << ","
+         << std::setw( 9) << "speedup"    << ","
+         << std::setw( 6) << "valid"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const std::string      & testcase,
+  const Array_t          & keys,
+  const measurement      & mes,
+  double                   time_sort_s,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    cout << std::right
+         << std::setw( 7) << dash::size()         << ","
+         << std::setw( 9) << mpi_impl             << ","
+         << std::setw(24) << testcase             << ","
+         << std::setw(12) << keys.size()          << ","
+         << std::setw( 9) << params.repeat        << ","
+         << std::fixed << setprecision(6)
+         << std::setw(10) << mes.time_min_s       << ","
+         << std::setw(10) << mes.time_avg_s       << ","
+         << std::setw(10) << mes.time_max_s       << ","
+         << setprecision(2)
+         << std::setw( 9) << time_sort_s / mes.time_avg_s << ","
+         << std::setw( 6) << (mes.valid ? "yes" : "no")
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_per_unit = 1 << 22;
+  params.top_k         = 100;
+  params.repeat        = 5;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-n") {
+      params.size_per_unit = atol(argv[i+1]);
+    } else if (flag == "-k") {
+      params.top_k         = atol(argv[i+1]);
+    } else if (flag == "-r") {
+      params.repeat        = atoi(argv[i+1]);
+    }
+  }
+  params.top_k = std::min(params.top_k, params.size_per_unit);
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-n", "elements per unit",  params.size_per_unit);
+  bench_cfg.print_param("-k", "selected elements",  params.top_k);
+  bench_cfg.print_param("-r", "repetitions",        params.repeat);
+  bench_cfg.print_section_end();
+}
@@ -0,0 +1,286 @@
+/**
+ * Measures throughput of insertions and lookups in dash::UnorderedMap
+ * with keys distributed to all units by dash::HashDistributed and with
+ * keys stored at the inserting unit by dash::HashLocal.
+ *
+ * Every unit inserts the same number of unique keys, then looks up the
+ * keys inserted by the next unit, using single-element operations and
+ * the collective bulk operations insert_bulk and find_bulk. Lookups are
+ * validated against the inserted mapped values.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <limits>
+#include <algorithm>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef long   key_type;
+typedef double mapped_type;
+
+typedef struct benchmark_params_t {
+  long   size_per_unit;
+  long   local_buffer_size;
+  int    repeat;
+} benchmark_params;
+
+typedef struct measurement_t {
+  double time_insert_s;
+  double time_find_s;
+  double time_insert_bulk_s;
+  double time_find_bulk_s;
+  bool   valid;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+void print_measurement_header();
+void print_measurement_record(
+  const std::string      & testcase,
+  const std::string      & hash,
+  double                   time_s,
+  bool                     valid,
+  const benchmark_params & params);
+
+key_type key_of(long i, int unit)
+{
+  return static_cast<key_type>(i) * dash::size() + unit;
+}
+
+/**
+ * Inserts the keys of the active unit in a new map and looks up the keys
+ * of the next unit, returning the times of both phases.
+ */
+template<class MapType>
+measurement evaluate_once(
+  const benchmark_params & params)
+{
+  typedef typename MapType::value_type value_type;
+  typedef typename MapType::iterator   iterator;
+
+  measurement mes;
+  int         myid   = dash::myid();
+  int         nunits = dash::size();
+  MapType     map(0, params.local_buffer_size);
+
+  auto ts_start = Timer::Now();
+  for (long i = 0; i < params.size_per_unit; ++i) {
+    key_type key = key_of(i, myid);
+    map.insert(value_type(key, 0.5 * key));
+  }
+  map.barrier();
+  mes.time_insert_s = Timer::ElapsedSince(ts_start) * 1.0e-6;
+
+  int  next_unit = (myid + 1) % nunits;
+  long nfound    = 0;
+  ts_start = Timer::Now();
+  for (long i = 0; i < params.size_per_unit; ++i) {
+    key_type key   = key_of(i, next_unit);
+    auto     found = map.find(key);
+    if (found != map.end()) {
+      value_type value = *found;
+      nfound += (value.second == 0.5 * key);
+    }
+  }
+  mes.time_find_s = Timer::ElapsedSince(ts_start) * 1.0e-6;
+  mes.valid       = nfound == params.size_per_unit &&
+                    map.size() == static_cast<std::size_t>(
+                                    params.size_per_unit * nunits);
+  dash::barrier();
+
+  // Bulk operations on a new map:
+  MapType                 bulk_map(0, params.local_buffer_size);
+  std::vector<value_type> values;
+  std::vector<key_type>   keys;
+  std::vector<iterator>   found(params.size_per_unit);
+  values.reserve(params.size_per_unit);
+  keys.reserve(params.size_per_unit);
+  for (long i = 0; i < params.size_per_unit; ++i) {
+    key_type key = key_of(i, myid);
+    values.push_back(value_type(key, 0.5 * key));
+    keys.push_back(key_of(i, next_unit));
+  }
+  dash::barrier();
+
+  ts_start = Timer::Now();
+  bulk_map.insert_bulk(values.begin(), values.end());
+  mes.time_insert_bulk_s = Timer::ElapsedSince(ts_start) * 1.0e-6;
+
+  ts_start = Timer::Now();
+  bulk_map.find_bulk(keys.begin(), keys.end(), found.begin());
+  mes.time_find_bulk_s = Timer::ElapsedSince(ts_start) * 1.0e-6;
+  nfound = 0;
+  for (long i = 0; i < params.size_per_unit; ++i) {
+    if (found[i] != bulk_map.end()) {
+      value_type value = *found[i];
+      nfound += (value.first  == keys[i] &&
+                 value.second == 0.5 * keys[i]);
+    }
+  }
+  mes.valid &= nfound == params.size_per_unit &&
+               bulk_map.size() == map.size();
+  dash::barrier();
+  return mes;
+}
+
+template<class MapType>
+void evaluate(
+  const std::string      & hash,
+  const benchmark_params & params)
+{
+  measurement best;
+  best.time_insert_s      = std::numeric_limits<double>::max();
+  best.time_find_s        = std::numeric_limits<double>::max();
+  best.time_insert_bulk_s = std::numeric_limits<double>::max();
+  best.time_find_bulk_s   = std::numeric_limits<double>::max();
+  best.valid              = true;
+  for (int rep = 0; rep < params.repeat; ++rep) {
+    auto mes = evaluate_once<MapType>(params);
+    best.time_insert_s      = std::min(best.time_insert_s,
+                                       mes.time_insert_s);
+    best.time_find_s        = std::min(best.time_find_s,
+                                       mes.time_find_s);
+    best.time_insert_bulk_s = std::min(best.time_insert_bulk_s,
+                                       mes.time_insert_bulk_s);
+    best.time_find_bulk_s   = std::min(best.time_find_bulk_s,
+                                       mes.time_find_bulk_s);
+    best.valid             &= mes.valid;
+  }
+  print_measurement_record("insert",      hash, best.time_insert_s,
+                           best.valid, params);
+  print_measurement_record("find",        hash, best.time_find_s,
+                           best.valid, params);
+  print_measurement_record("insert_bulk", hash, best.time_insert_bulk_s,
+                           best.valid, params);
+  print_measurement_record("find_bulk",   hash, best.time_find_bulk_s,
+                           best.valid, params);
+}
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.17.unordered-map");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  evaluate<
+    dash::UnorderedMap<key_type, mapped_type,
+                       dash::HashDistributed<key_type>>
+  >("distributed", params);
+  evaluate<
+    dash::UnorderedMap<key_type, mapped_type,
+                       dash::HashLocal<key_type>>
+  >("local", params);
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 7) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(12) << "testcase"   << ","
+         << std::setw(12) << "hash"       << ","
+         << std::setw(12) << "n"          << ","
+         << std::setw( 9) << "repeats"    << ","
+         << std::setw(10) << "min.s"      << ","
+         << std::setw(12) << "mops.total" << ","
+         << std::setw(12) << "mops.unit"  << ","
+         << std::setw( 6) << "valid"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const std::string      & testcase,
+  const std::string      & hash,
+  double                   time_s,
+  bool                     valid,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl  = dash__toxstr(MPI_IMPL_ID);
+    long        n_total   = params.size_per_unit * dash::size();
+    double      mops_unit = params.size_per_unit / time_s * 1.0e-6;
+    cout << std::right
+         << std::setw( 7) << dash::size()         << ","
+         << std::setw( 9) << mpi_impl             << ","
+         << std::setw(12) << testcase             << ","
+         << std::setw(12) << hash                 << ","
+         << std::setw(12) << n_total              << ","
+         << std::setw( 9) << params.repeat        << ","
+         << std::fixed << setprecision(6)
+         << std::setw(10) << time_s               << ","
+         << setprecision(3)
+         << std::setw(12) << mops_unit * dash::size() << ","
+         << std::setw(12) << mops_unit            << ","
+         << std::setw( 6) << (valid ? "yes" : "no")
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_per_unit     = 1 << 16;
+  params.local_buffer_size = 4096;
+  params.repeat            = 3;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-n") {
+      params.size_per_unit     = atol(argv[i+1]);
+    } else if (flag == "-b") {
+      params.local_buffer_size = atol(argv[i+1]);
+    } else if (flag == "-r") {
+      params.repeat            = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-n", "keys per unit",      params.size_per_unit);
+  bench_cfg.print_param("-b", "local buffer size",  params.local_buffer_size);
+  bench_cfg.print_param("-r", "repetitions",        params.repeat);
+  bench_cfg.print_section_end();
+}
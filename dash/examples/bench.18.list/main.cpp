@@ -0,0 +1,332 @@
+/**
+ * Measures throughput of global push and pop operations of dash::List
+ * in producer/consumer patterns.
+ *
+ * In the first pattern, every unit pushes the same number of elements at
+ * the back or front of the list and, after a barrier, pops elements at
+ * the front or back until the list is empty.
+ * In the second pattern, units with even ids produce elements and units
+ * with odd ids consume them in a sequence of rounds separated by
+ * barriers.
+ * The number and sum of popped elements are validated against the
+ * pushed elements.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <limits>
+#include <algorithm>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef long value_t;
+
+typedef struct benchmark_params_t {
+  long   size_per_unit;
+  long   local_buffer_size;
+  int    rounds;
+  int    repeat;
+} benchmark_params;
+
+typedef struct measurement_t {
+  double time_push_s;
+  double time_pop_s;
+  long   nelem;
+  bool   valid;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+void print_measurement_header();
+void print_measurement_record(
+  const std::string      & testcase,
+  double                   time_s,
+  long                     nelem,
+  bool                     valid,
+  const benchmark_params & params);
+
+/**
+ * Returns the number of popped elements and their sum accumulated over
+ * all units in \c counts.
+ */
+void accumulate_counts(
+  long               npopped,
+  long               sum,
+  dash::Array<long> & counts,
+  long             & total_popped,
+  long             & total_sum)
+{
+  counts.local[0] = npopped;
+  counts.local[1] = sum;
+  counts.barrier();
+  total_popped = 0;
+  total_sum    = 0;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    total_popped += counts[2 * u];
+    total_sum    += counts[2 * u + 1];
+  }
+  counts.barrier();
+}
+
+/**
+ * All units push elements at one end of the list, then pop all elements
+ * at the specified end.
+ */
+measurement evaluate_push_pop(
+  bool                     push_back,
+  bool                     pop_front,
+  const benchmark_params & params)
+{
+  measurement         mes;
+  dash::List<value_t> list(0, params.local_buffer_size);
+  dash::Array<long>   counts(2 * dash::size(), dash::BLOCKED);
+
+  long expect_sum = 0;
+  for (long i = 0; i < params.size_per_unit; ++i) {
+    expect_sum += i;
+  }
+  expect_sum *= dash::size();
+
+  auto ts_start = Timer::Now();
+  for (long i = 0; i < params.size_per_unit; ++i) {
+    if (push_back) {
+      list.push_back(i);
+    } else {
+      list.push_front(i);
+    }
+  }
+  list.barrier();
+  mes.time_push_s = Timer::ElapsedSince(ts_start) * 1.0e-6;
+
+  long    npopped = 0;
+  long    sum     = 0;
+  value_t value;
+  ts_start = Timer::Now();
+  while (pop_front ? list.pop_front(value) : list.pop_back(value)) {
+    ++npopped;
+    sum += value;
+  }
+  list.barrier();
+  mes.time_pop_s = Timer::ElapsedSince(ts_start) * 1.0e-6;
+
+  long total_popped, total_sum;
+  accumulate_counts(npopped, sum, counts, total_popped, total_sum);
+  mes.nelem = params.size_per_unit * dash::size();
+  mes.valid = total_popped == mes.nelem &&
+              total_sum    == expect_sum &&
+              list.size()  == 0;
+  return mes;
+}
+
+/**
+ * Units with even ids push elements at the back of the list, units with
+ * odd ids pop elements at the front in every round. A single unit acts
+ * as both producer and consumer.
+ */
+measurement evaluate_producer_consumer(
+  const benchmark_params & params)
+{
+  measurement         mes;
+  int                 myid     = dash::myid();
+  bool                producer = (myid % 2 == 0);
+  bool                consumer = (myid % 2 == 1 || dash::size() == 1);
+  dash::List<value_t> list(0, params.local_buffer_size);
+  dash::Array<long>   counts(2 * dash::size(), dash::BLOCKED);
+
+  long nproducers = (dash::size() + 1) / 2;
+  long per_round  = std::max<long>(1, params.size_per_unit / params.rounds);
+  long npopped    = 0;
+  long sum        = 0;
+  long expect_sum = 0;
+  value_t value;
+
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (int r = 0; r < params.rounds; ++r) {
+    if (producer) {
+      for (long i = 0; i < per_round; ++i) {
+        list.push_back(r * per_round + i);
+      }
+    }
+    list.barrier();
+    if (consumer) {
+      while (list.pop_front(value)) {
+        ++npopped;
+        sum += value;
+      }
+    }
+  }
+  list.barrier();
+  mes.time_push_s = Timer::ElapsedSince(ts_start) * 1.0e-6;
+  mes.time_pop_s  = mes.time_push_s;
+
+  for (long i = 0; i < per_round * params.rounds; ++i) {
+    expect_sum += i;
+  }
+  long total_popped, total_sum;
+  accumulate_counts(npopped, sum, counts, total_popped, total_sum);
+  mes.nelem = per_round * params.rounds * nproducers;
+  mes.valid = total_popped == mes.nelem &&
+              total_sum    == expect_sum * nproducers &&
+              list.size()  == 0;
+  return mes;
+}
+
+void evaluate(
+  const std::string      & testcase,
+  bool                     push_back,
+  bool                     pop_front,
+  const benchmark_params & params)
+{
+  measurement best;
+  best.time_push_s = std::numeric_limits<double>::max();
+  best.time_pop_s  = std::numeric_limits<double>::max();
+  best.valid       = true;
+  for (int rep = 0; rep < params.repeat; ++rep) {
+    auto mes = (testcase == "prod_cons")
+               ? evaluate_producer_consumer(params)
+               : evaluate_push_pop(push_back, pop_front, params);
+    best.time_push_s = std::min(best.time_push_s, mes.time_push_s);
+    best.time_pop_s  = std::min(best.time_pop_s,  mes.time_pop_s);
+    best.nelem       = mes.nelem;
+    best.valid      &= mes.valid;
+  }
+  if (testcase == "prod_cons") {
+    print_measurement_record(testcase, best.time_push_s, best.nelem,
+                             best.valid, params);
+    return;
+  }
+  print_measurement_record(
+    push_back ? "push_back" : "push_front",
+    best.time_push_s, best.nelem, best.valid, params);
+  print_measurement_record(
+    pop_front ? "pop_front" : "pop_back",
+    best.time_pop_s, best.nelem, best.valid, params);
+}
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.18.list");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  // Queue: push at the back, pop at the front
+  evaluate("queue",     true,  true,  params);
+  // Stack: push at the front, pop at the front
+  evaluate("stack",     false, true,  params);
+  // Pop at the back
+  evaluate("back",      true,  false, params);
+  evaluate("prod_cons", true,  true,  params);
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 7) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(12) << "testcase"   << ","
+         << std::setw(12) << "n"          << ","
+         << std::setw( 9) << "repeats"    << ","
+         << std::setw(10) << "min.s"      << ","
+         << std::setw(12) << "mops.total" << ","
+         << std::setw(12) << "mops.unit"  << ","
+         << std::setw( 6) << "valid"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const std::string      & testcase,
+  double                   time_s,
+  long                     nelem,
+  bool                     valid,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl   = dash__toxstr(MPI_IMPL_ID);
+    double      mops_total = nelem / time_s * 1.0e-6;
+    cout << std::right
+         << std::setw( 7) << dash::size()         << ","
+         << std::setw( 9) << mpi_impl             << ","
+         << std::setw(12) << testcase             << ","
+         << std::setw(12) << nelem                << ","
+         << std::setw( 9) << params.repeat        << ","
+         << std::fixed << setprecision(6)
+         << std::setw(10) << time_s               << ","
+         << setprecision(3)
+         << std::setw(12) << mops_total           << ","
+         << std::setw(12) << mops_total / dash::size() << ","
+         << std::setw( 6) << (valid ? "yes" : "no")
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_per_unit     = 1 << 14;
+  params.local_buffer_size = 4096;
+  params.rounds            = 16;
+  params.repeat            = 3;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-n") {
+      params.size_per_unit     = atol(argv[i+1]);
+    } else if (flag == "-b") {
+      params.local_buffer_size = atol(argv[i+1]);
+    } else if (flag == "-k") {
+      params.rounds            = atoi(argv[i+1]);
+    } else if (flag == "-r") {
+      params.repeat            = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-n", "elements per unit",  params.size_per_unit);
+  bench_cfg.print_param("-b", "local buffer size",  params.local_buffer_size);
+  bench_cfg.print_param("-k", "producer rounds",    params.rounds);
+  bench_cfg.print_param("-r", "repetitions",        params.repeat);
+  bench_cfg.print_section_end();
+}
@@ -0,0 +1,307 @@
+/**
+ * Unbalanced tree search (UTS) benchmark on dash::Deque.
+ *
+ * Counts the nodes of a binomial tree that is generated while it is
+ * traversed: the root has a fixed number of children, every other node
+ * has a fixed number of children with a given probability or no children
+ * otherwise. Children are derived from a hash of their parent's state,
+ * so the tree is identical in every run but its shape is unpredictable.
+ * Units obtain nodes from a work-stealing queue, the root is pushed at
+ * unit 0.
+ *
+ * The number of nodes is validated against a sequential traversal at
+ * unit 0.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <limits>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef struct tree_node_t {
+  uint64_t state;
+  int      depth;
+} tree_node;
+
+typedef struct benchmark_params_t {
+  int    root_children;
+  int    children;
+  double probability;
+  int    work;
+  long   shared_capacity;
+  long   batch_size;
+  int    repeat;
+} benchmark_params;
+
+typedef struct measurement_t {
+  double time_s;
+  long   nnodes;
+  long   nsteals;
+  bool   valid;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+void print_measurement_header();
+void print_measurement_record(
+  const measurement      & mes,
+  const benchmark_params & params);
+
+/**
+ * Mixes the bits of a state, applied \c rounds times to simulate work
+ * per node.
+ */
+uint64_t hash_state(uint64_t state, int rounds)
+{
+  for (int r = 0; r < rounds; ++r) {
+    state += 0x9e3779b97f4a7c15ULL;
+    state  = (state ^ (state >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    state  = (state ^ (state >> 27)) * 0x94d049bb133111ebULL;
+    state  =  state ^ (state >> 31);
+  }
+  return state;
+}
+
+/**
+ * Number of children of a tree node.
+ */
+int num_children(
+  const tree_node        & node,
+  const benchmark_params & params)
+{
+  if (node.depth == 0) {
+    return params.root_children;
+  }
+  double uniform = static_cast<double>(node.state >> 11) /
+                   static_cast<double>(1ULL << 53);
+  return uniform < params.probability ? params.children : 0;
+}
+
+tree_node child_node(
+  const tree_node        & parent,
+  int                      child,
+  const benchmark_params & params)
+{
+  tree_node node;
+  node.state = hash_state(parent.state + child, params.work);
+  node.depth = parent.depth + 1;
+  return node;
+}
+
+tree_node root_node()
+{
+  tree_node root;
+  root.state = 19;
+  root.depth = 0;
+  return root;
+}
+
+long count_sequential(const benchmark_params & params)
+{
+  std::vector<tree_node> stack;
+  stack.push_back(root_node());
+  long nnodes = 0;
+  while (!stack.empty()) {
+    tree_node node = stack.back();
+    stack.pop_back();
+    ++nnodes;
+    int nchildren = num_children(node, params);
+    for (int c = 0; c < nchildren; ++c) {
+      stack.push_back(child_node(node, c, params));
+    }
+  }
+  return nnodes;
+}
+
+measurement evaluate_once(
+  long                     expect_nnodes,
+  const benchmark_params & params)
+{
+  measurement             mes;
+  dash::Deque<tree_node>  deque(params.shared_capacity, params.batch_size);
+  dash::Array<long>       counts(2 * dash::size(), dash::BLOCKED);
+
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  if (dash::myid() == 0) {
+    deque.push_back(root_node());
+  }
+  long      nnodes = 0;
+  tree_node node;
+  while (deque.next(node)) {
+    ++nnodes;
+    int nchildren = num_children(node, params);
+    for (int c = 0; c < nchildren; ++c) {
+      deque.push_back(child_node(node, c, params));
+    }
+  }
+  deque.barrier();
+  mes.time_s = Timer::ElapsedSince(ts_start) * 1.0e-6;
+
+  counts.local[0] = nnodes;
+  counts.local[1] = deque.num_steals();
+  counts.barrier();
+  mes.nnodes  = 0;
+  mes.nsteals = 0;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    mes.nnodes  += counts[2 * u];
+    mes.nsteals += counts[2 * u + 1];
+  }
+  mes.valid = (mes.nnodes == expect_nnodes);
+  counts.barrier();
+  return mes;
+}
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.19.uts");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+
+  dash::Shared<long> expect_nnodes;
+  if (dash::myid() == 0) {
+    expect_nnodes.set(count_sequential(params));
+  }
+  dash::barrier();
+  long expect = expect_nnodes.get();
+
+  print_measurement_header();
+
+  measurement best;
+  best.time_s = std::numeric_limits<double>::max();
+  best.valid  = true;
+  for (int rep = 0; rep < params.repeat; ++rep) {
+    auto mes = evaluate_once(expect, params);
+    if (mes.time_s < best.time_s) {
+      best.time_s  = mes.time_s;
+      best.nsteals = mes.nsteals;
+    }
+    best.nnodes  = mes.nnodes;
+    best.valid  &= mes.valid;
+  }
+  print_measurement_record(best, params);
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 7) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(12) << "nodes"      << ","
+         << std::setw( 9) << "repeats"    << ","
+         << std::setw(10) << "min.s"      << ","
+         << std::setw(12) << "mnodes.s"   << ","
+         << std::setw(12) << "mnodes.unit" << ","
+         << std::setw( 9) << "steals"     << ","
+         << std::setw( 6) << "valid"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const measurement      & mes,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    double      mnodes_s = mes.nnodes / mes.time_s * 1.0e-6;
+    cout << std::right
+         << std::setw( 7) << dash::size()         << ","
+         << std::setw( 9) << mpi_impl             << ","
+         << std::setw(12) << mes.nnodes           << ","
+         << std::setw( 9) << params.repeat        << ","
+         << std::fixed << setprecision(6)
+         << std::setw(10) << mes.time_s           << ","
+         << setprecision(3)
+         << std::setw(12) << mnodes_s             << ","
+         << std::setw(12) << mnodes_s / dash::size() << ","
+         << std::setw( 9) << mes.nsteals          << ","
+         << std::setw( 6) << (mes.valid ? "yes" : "no")
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.root_children   = 2000;
+  params.children        = 8;
+  params.probability     = 0.124;
+  params.work            = 16;
+  params.shared_capacity = 4096;
+  params.batch_size      = 32;
+  params.repeat          = 3;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-b0") {
+      params.root_children   = atoi(argv[i+1]);
+    } else if (flag == "-m") {
+      params.children        = atoi(argv[i+1]);
+    } else if (flag == "-q") {
+      params.probability     = atof(argv[i+1]);
+    } else if (flag == "-w") {
+      params.work            = atoi(argv[i+1]);
+    } else if (flag == "-c") {
+      params.shared_capacity = atol(argv[i+1]);
+    } else if (flag == "-s") {
+      params.batch_size      = atol(argv[i+1]);
+    } else if (flag == "-r") {
+      params.repeat          = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-b0", "root children",       params.root_children);
+  bench_cfg.print_param("-m",  "node children",       params.children);
+  bench_cfg.print_param("-q",  "child probability",   params.probability);
+  bench_cfg.print_param("-w",  "hash rounds per node", params.work);
+  bench_cfg.print_param("-c",  "shared capacity",     params.shared_capacity);
+  bench_cfg.print_param("-s",  "steal batch size",    params.batch_size);
+  bench_cfg.print_param("-r",  "repetitions",         params.repeat);
+  bench_cfg.print_section_end();
+}
@@ -116,7 +116,7 @@ int main(int argc, char *argv[])
   s_total = std::chrono::system_clock::now();
   for (auto d = 0; d < iterations; ++d) {
     // Update Halos asynchroniously
-    current_halo->updateHalosAsync();
+    auto halo_update = current_halo->updateHalosAsync();
 
     // optimized calculation of inner matrix elements
     auto current_begin = current_matrix->local.lbegin();
@@ -146,7 +146,7 @@ int main(int argc, char *argv[])
     }*/
 
     // Wait until all Halo updates ready
-    current_halo->waitHalosAsync();
+    halo_update.wait();
 
     // Calculation of boundary Halo elements
     for (auto it = current_halo->bbegin(); it != current_halo->bend(); ++it) {
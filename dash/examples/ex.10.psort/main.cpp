@@ -107,7 +107,7 @@ int main(int argc, char * argv[])
     double duration_it_s = 0;
 
     array_t arr(array_size);
-    array_t key_histo(max_key * nunits, dash::BLOCKED);
+    array_t key_histo(max_key, dash::BLOCKED);
     array_t pre_sum(max_key);
 
     for (size_t rep = 0; rep < repeat; rep++)
@@ -120,36 +120,15 @@ int main(int argc, char * argv[])
         *lit = rand() % max_key;
         a++;
       }
-      for (auto lit = key_histo.lbegin(); lit != key_histo.lend(); ++lit) {
-        *lit = 0;
-      }
       // Wait till all process have written the data to array.
       arr.barrier();
       // Initialization done.
 
       auto ts_rep_start = Timer::Now();
 
-      // Create Local Histograms.
-      // Compute the histogram for the values in local range:
-      for (size_t i = 0; i < arr.lsize(); i++) {
-        key_type value = arr.local[i];
-        ++key_histo.local[value];
-      }
-
-      // Accumulate and broadcast (allreduce) local histograms:
-      //
-      std::vector<key_type> key_histo_res(key_histo.lsize());
-      dart_allreduce(
-        key_histo.lbegin(),                      // send buffer
-        key_histo_res.data(),                    // receive buffer
-        key_histo.lsize(),                       // buffer size
-        dash::dart_datatype<key_type>::value,    // data type
-        dash::plus<key_type>().dart_operation(), // operation
-        dash::Team::All().dart_id()              // team
-      );
-      // Overwrite local histogram with sum of all local histograms:
-      std::copy(key_histo_res.begin(), key_histo_res.end(),
-                key_histo.lbegin());
+      // Histogram of keys, distributed like the prefix sums:
+      dash::histogram(arr.begin(), arr.end(), key_histo,
+                      [](key_type key) { return key; });
 
       // Prefix sum in local sections of histogram:
       pre_sum.local[0] = key_histo.local[0];
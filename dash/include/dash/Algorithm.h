@@ -17,13 +17,23 @@
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
 #include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/TransformReduce.h>
+#include <dash/algorithm/Scan.h>
 #include <dash/algorithm/Copy.h>
 #include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
 #include <dash/algorithm/AllOf.h>
 #include <dash/algorithm/AnyOf.h>
+#include <dash/algorithm/NoneOf.h>
 #include <dash/algorithm/Find.h>
 #include <dash/algorithm/Equal.h>
+#include <dash/algorithm/Sort.h>
+#include <dash/algorithm/Remove.h>
+#include <dash/algorithm/Unique.h>
+#include <dash/algorithm/Partition.h>
+#include <dash/algorithm/NthElement.h>
+#include <dash/algorithm/PartialSortCopy.h>
+#include <dash/algorithm/Histogram.h>
 
 #include <dash/algorithm/SUMMA.h>
 
@@ -14,6 +14,8 @@
 #include <dash/Dimensional.h>
 
 #include <dash/iterator/GlobIter.h>
+#include <dash/Future.h>
+#include <dash/internal/IndexedTransfer.h>
 
 #include <iterator>
 #include <initializer_list>
@@ -1064,6 +1066,90 @@ public:
     return m_pattern.is_local(global_index, m_myid);
   }
 
+  /**
+   * Reads the elements at the given global indices into a local buffer,
+   * such that \c out[i] is the value of the element at \c indices[i].
+   *
+   * Indices are grouped by their owning unit and elements are fetched in
+   * aggregated transfers per unit instead of one transfer per element.
+   *
+   * Example:
+   *
+   * \code
+   *   std::vector<index_t> indices { 3, 1000, 17, 999 };
+   *   std::vector<T>       values(indices.size());
+   *   auto fut = array.gather(indices, values.data());
+   *   // ...
+   *   fut.wait();
+   * \endcode
+   *
+   * \returns  Future of the end of the output range, \c out must not be
+   *           accessed before it is completed
+   */
+  template<class IndexSequence>
+  dash::Future<value_type *> gather(
+    /// Sequence of global indices of elements to read
+    const IndexSequence & indices,
+    /// Output range of at least \c indices.size() elements
+    value_type          * out) const
+  {
+    return dash::internal::gather_indexed(
+             *m_globmem, m_pattern,
+             static_cast<const value_type *>(m_lbegin), indices, out);
+  }
+
+  /**
+   * Writes values to the elements at the given global indices, such that
+   * the element at \c indices[i] is assigned \c values[i].
+   * For duplicate indices, the last value in sequence order is written.
+   *
+   * Indices are grouped by their owning unit and elements are written in
+   * aggregated transfers per unit instead of one transfer per element.
+   *
+   * \returns  Future that is completed when all values have been written,
+   *           \c values may be modified once this call returned
+   */
+  template<class IndexSequence>
+  dash::Future<void> scatter(
+    /// Sequence of global indices of elements to write
+    const IndexSequence & indices,
+    /// Values to write, at least \c indices.size() elements
+    const value_type    * values)
+  {
+    return dash::internal::scatter_indexed(
+             *m_globmem, m_pattern, m_lbegin, indices, values);
+  }
+
+  /**
+   * Combines values with the elements at the given global indices using a
+   * reduce operation, such that the element at \c indices[i] is updated
+   * to \c op(element, values[i]), equivalent to \c MPI_Accumulate.
+   * Values of duplicate indices are combined before they are transferred.
+   *
+   * Example:
+   *
+   * \code
+   *   // Histogram update:
+   *   std::vector<int> ones(bins.size(), 1);
+   *   array.scatter(bins, ones.data(), dash::plus<int>()).wait();
+   * \endcode
+   *
+   * \returns  Future that is completed when all updates have been applied,
+   *           \c values may be modified once this call returned
+   */
+  template<class IndexSequence, class ReduceOpType>
+  dash::Future<void> scatter(
+    /// Sequence of global indices of elements to update
+    const IndexSequence & indices,
+    /// Operands of updates, at least \c indices.size() elements
+    const value_type    * values,
+    /// Reduce operation, e.g. \c dash::plus
+    ReduceOpType          op)
+  {
+    return dash::internal::scatter_indexed(
+             *m_globmem, m_pattern, indices, values, op);
+  }
+
   /**
    * Establish a barrier for all units operating on the array, publishing all
    * changes to all units.
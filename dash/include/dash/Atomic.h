@@ -207,6 +207,40 @@ public:
     return fetch_and_op(dash::plus<ValueType>(), -val);
   }
 
+  /**
+   * Atomically replaces the referenced shared value by \c desired if it is
+   * equal to \c expected.
+   * Only valid for integral value types.
+   *
+   * \return  The value of the referenced shared variable before the
+   *          operation, equal to \c expected if the value has been
+   *          replaced.
+   */
+  ValueType compare_exchange(
+    /// Value expected at the global atomic variable.
+    ValueType expected,
+    /// Value to assign if the global atomic variable equals \c expected.
+    ValueType desired)
+  {
+    DASH_LOG_DEBUG_VAR("Atomic.compare_exchange()", expected);
+    DASH_LOG_TRACE_VAR("Atomic.compare_exchange",   desired);
+    DASH_LOG_TRACE_VAR("Atomic.compare_exchange",   _gptr);
+    DASH_ASSERT(_team != nullptr);
+    DASH_ASSERT(!DART_GPTR_ISNULL(_gptr));
+    value_type result;
+    dart_ret_t ret = dart_compare_and_swap(
+                       _gptr,
+                       reinterpret_cast<const void *>(&desired),
+                       reinterpret_cast<const void *>(&expected),
+                       reinterpret_cast<void *>(&result),
+                       dash::dart_datatype<ValueType>::value,
+                       _team->dart_id());
+    DASH_ASSERT_EQ(DART_OK, ret, "dart_compare_and_swap failed");
+    dart_flush_all(_gptr);
+    DASH_LOG_DEBUG_VAR("Atomic.compare_exchange >", result);
+    return result;
+  }
+
 private:
   /// The atomic value's underlying global pointer.
   dart_gptr_t   _gptr = DART_GPTR_NULL;
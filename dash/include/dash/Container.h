@@ -66,5 +66,6 @@
 // Dynamic containers:
 #include<dash/List.h>
 #include<dash/UnorderedMap.h>
+#include<dash/Deque.h>
 
 #endif // DASH__CONTAINER_H_
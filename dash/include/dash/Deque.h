@@ -0,0 +1,489 @@
+#ifndef DASH__DEQUE_H__INCLUDED
+#define DASH__DEQUE_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/GlobMem.h>
+#include <dash/Atomic.h>
+
+#include <dash/util/Locality.h>
+#include <dash/util/TeamLocality.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <deque>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstddef>
+
+namespace dash {
+
+/**
+ * \defgroup  DashDequeConcept  Deque Concept
+ * Concept of a distributed work-stealing double-ended queue.
+ *
+ * \ingroup DashContainerConcept
+ * \{
+ * \par Description
+ *
+ * A queue of elements, typically tasks, with one segment at every unit
+ * for dynamic load balancing across the units in a team.
+ *
+ * The owner of a segment pushes and pops elements at its back in LIFO
+ * order. Units with empty segments steal batches of the oldest elements
+ * at the front of the segments of other units, preferring units in the
+ * same node locality domain.
+ *
+ * Every segment is split in a private part in local memory and a shared
+ * part in global memory. The owner accesses the private part without
+ * communication and moves the oldest elements to the shared part when it
+ * is empty. Stealing units lock the shared part of a victim in an atomic
+ * compare-and-swap operation and claim elements at its front.
+ *
+ * \par Methods
+ *
+ * Return Type          | Method             | Parameters                  | Description
+ * -------------------- | ------------------ | --------------------------- | -----------------------------------------------------------------
+ * <tt>void</tt>        | <tt>push_back</tt> | <tt>value</tt>              | Pushes an element at the back of the local segment
+ * <tt>bool</tt>        | <tt>pop_back</tt>  | <tt>&value</tt>             | Pops an element at the back of the local segment, if any
+ * <tt>size_type</tt>   | <tt>steal</tt>     | &nbsp;                      | Moves a batch of elements of another unit to the local segment
+ * <tt>bool</tt>        | <tt>next</tt>      | <tt>&value</tt>             | Pops or steals an element until all segments are empty
+ * <tt>void</tt>        | <tt>barrier</tt>   | &nbsp;                      | Collective, resets termination detection of <tt>next</tt>
+ *
+ * \}
+ */
+
+/**
+ * A distributed double-ended queue for work stealing.
+ *
+ * \concept{DashDequeConcept}
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Deque<task_t> deque;
+ *   if (dash::myid() == 0) {
+ *     deque.push_back(root_task);
+ *   }
+ *   task_t task;
+ *   // Process elements until the queues of all units are empty:
+ *   while (deque.next(task)) {
+ *     for (auto & child : children(task)) {
+ *       deque.push_back(child);
+ *     }
+ *   }
+ *   deque.barrier();
+ * \endcode
+ *
+ * \tparam  ElementType  Element type, must be trivially copyable.
+ */
+template<typename ElementType>
+class Deque
+{
+private:
+  typedef Deque<ElementType>                                    self_t;
+
+public:
+  typedef ElementType                                       value_type;
+  typedef typename dash::default_size_t                      size_type;
+  typedef typename dash::default_index_t               difference_type;
+
+private:
+  typedef long                                            control_type;
+  typedef dash::GlobMem<value_type>                        glob_mem_type;
+  typedef dash::GlobMem<control_type>                 glob_control_type;
+
+  /// Offsets of control words in the global control memory of a unit.
+  enum control_id {
+    /// Lock of the shared part of the segment.
+    control_lock = 0,
+    /// Index of the first element in the shared part.
+    control_head,
+    /// Index past the last element in the shared part.
+    control_tail,
+    /// Number of idle units, only used at unit 0.
+    control_idle,
+    ncontrols
+  };
+
+public:
+  /**
+   * Constructor, collectively allocates the shared part of the segments
+   * at all units in the team.
+   */
+  Deque(
+    /// Maximum number of elements in the shared part of every segment.
+    size_type   shared_capacity = 4096,
+    /// Maximum number of elements moved to the shared part or stolen
+    /// in a single operation.
+    size_type   batch_size      = 64,
+    /// Team containing all units operating on the queue.
+    Team      & team            = dash::Team::All())
+  : _team(&team),
+    _myid(team.myid()),
+    _capacity(shared_capacity),
+    _batch(std::max<size_type>(1, batch_size)),
+    _random(team.myid())
+  {
+    DASH_LOG_DEBUG_VAR("Deque(capacity,batch,team)", shared_capacity);
+    DASH_LOG_DEBUG_VAR("Deque(capacity,batch,team)", batch_size);
+    if (_capacity < 2 * _batch) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "Deque(capacity,batch,team): shared capacity " << _capacity <<
+        " is smaller than twice the batch size " << _batch);
+    }
+    _buffer  = new glob_mem_type(_capacity, *_team);
+    _control = new glob_control_type(ncontrols, *_team);
+    std::fill(_control->lbegin(), _control->lend(), 0);
+    _init_victims();
+    _team->barrier();
+    DASH_LOG_DEBUG("Deque(capacity,batch,team) >");
+  }
+
+  /**
+   * Destructor, collectively deallocates the shared part of the segments.
+   */
+  ~Deque()
+  {
+    if (_buffer != nullptr) {
+      _team->barrier();
+      delete _control;
+      delete _buffer;
+      _control = nullptr;
+      _buffer  = nullptr;
+    }
+  }
+
+  Deque(const self_t & other)            = delete;
+  self_t & operator=(const self_t & rhs) = delete;
+
+  /**
+   * Pushes an element at the back of the segment of the active unit.
+   * Moves the oldest elements to the shared part of the segment if it has
+   * been emptied by other units.
+   */
+  void push_back(const value_type & value)
+  {
+    _local.push_back(value);
+    if (_local.size() >= 2 * _batch && _local.size() % _batch == 0) {
+      _release();
+    }
+  }
+
+  /**
+   * Pops the element at the back of the segment of the active unit.
+   * Reclaims elements from the shared part of the segment if the private
+   * part is empty.
+   *
+   * \return  \c false if the segment of the active unit is empty.
+   */
+  bool pop_back(value_type & value)
+  {
+    if (_local.empty() && !_reclaim()) {
+      return false;
+    }
+    value = _local.back();
+    _local.pop_back();
+    return true;
+  }
+
+  /**
+   * Steals a batch of elements at the front of the segment of another
+   * unit and pushes them at the back of the segment of the active unit.
+   * Victims are visited in random order, units in the node locality
+   * domain of the active unit first.
+   *
+   * \return  The number of stolen elements, 0 if no elements could be
+   *          stolen from any unit.
+   */
+  size_type steal()
+  {
+    std::shuffle(_victims.begin(), _victims.begin() + _num_near, _random);
+    std::shuffle(_victims.begin() + _num_near, _victims.end(), _random);
+    for (auto victim : _victims) {
+      auto nstolen = _steal_from(victim);
+      if (nstolen > 0) {
+        ++_num_steals;
+        return nstolen;
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * Pops the element at the back of the segment of the active unit or
+   * steals elements from other units until an element is obtained or the
+   * segments of all units are empty.
+   *
+   * Units that are out of elements are counted as idle at unit 0. Once
+   * all units are idle, no unit holds or processes any element, so no
+   * elements can be pushed anymore.
+   * Call \c barrier() before using the queue again after \c next()
+   * returned \c false.
+   *
+   * \return  \c false if the segments of all units are empty.
+   */
+  bool next(value_type & value)
+  {
+    if (pop_back(value)) {
+      return true;
+    }
+    dash::Atomic<control_type> idle(_control_gptr(team_unit_t(0),
+                                                  control_idle),
+                                    *_team);
+    control_type nunits = _team->size();
+    while (true) {
+      if (steal() > 0) {
+        return pop_back(value);
+      }
+      // Units register as idle only while holding no elements and
+      // unregister before attempting to steal:
+      if (idle.fetch_and_add(1) == nunits - 1) {
+        DASH_LOG_DEBUG("Deque.next >", "all units idle");
+        return false;
+      }
+      idle.add(-1);
+    }
+  }
+
+  /**
+   * Number of elements in the segment of the active unit, including
+   * elements in the shared part that might be stolen concurrently.
+   */
+  size_type local_size() const
+  {
+    return _local.size() + (_tail - _head_seen);
+  }
+
+  /**
+   * Whether the segment of the active unit is empty.
+   */
+  bool empty() const
+  {
+    return _local.empty() && _tail == _head_seen;
+  }
+
+  /**
+   * Number of successful steals of the active unit.
+   */
+  size_type num_steals() const
+  {
+    return _num_steals;
+  }
+
+  /**
+   * Collective synchronization of all units in the team, resets the
+   * termination detection of \c next().
+   */
+  void barrier()
+  {
+    DASH_LOG_DEBUG("Deque.barrier()");
+    _team->barrier();
+    _head_seen = _control->lbegin()[control_head];
+    if (_myid.id == 0) {
+      _control->lbegin()[control_idle] = 0;
+    }
+    _team->barrier();
+    DASH_LOG_DEBUG("Deque.barrier >");
+  }
+
+  /**
+   * The team containing all units operating on the queue.
+   */
+  inline Team & team() const
+  {
+    return *_team;
+  }
+
+private:
+  dart_gptr_t _control_gptr(team_unit_t unit, control_id control) const
+  {
+    return _control->at(unit, control).dart_gptr();
+  }
+
+  dash::Atomic<control_type> _control_atomic(
+    team_unit_t unit,
+    control_id  control) const
+  {
+    return dash::Atomic<control_type>(_control_gptr(unit, control), *_team);
+  }
+
+  /**
+   * Orders the other units in the team by locality, units in the node
+   * domain of the active unit first.
+   */
+  void _init_victims()
+  {
+    global_unit_t            my_gid = _team->global_id(_myid);
+    dash::util::TeamLocality tloc(*_team);
+    auto nodes = tloc.domain().scope_domains(
+                   dash::util::Locality::Scope::Node);
+    for (auto & node : nodes) {
+      auto & node_units = node.units();
+      if (std::find(node_units.begin(), node_units.end(), my_gid)
+          == node_units.end()) {
+        continue;
+      }
+      for (auto gid : node_units) {
+        if (gid != my_gid) {
+          _victims.push_back(_team->relative_id(gid));
+        }
+      }
+    }
+    _num_near = _victims.size();
+    for (int unit = 0; unit < static_cast<int>(_team->size()); ++unit) {
+      team_unit_t u(unit);
+      if (unit != _myid.id &&
+          std::find(_victims.begin(), _victims.begin() + _num_near, u)
+          == _victims.begin() + _num_near) {
+        _victims.push_back(u);
+      }
+    }
+    DASH_LOG_TRACE("Deque._init_victims",
+                   "units in node domain:", _num_near,
+                   "total:", _victims.size());
+  }
+
+  /**
+   * Moves a batch of the oldest elements in the private part to the
+   * shared part of the local segment if it has been consumed by thieves.
+   */
+  void _release()
+  {
+    if (_tail - _head_seen >= static_cast<control_type>(_batch)) {
+      _head_seen = _control_atomic(_myid, control_head).fetch_and_add(0);
+      if (_tail - _head_seen >= static_cast<control_type>(_batch)) {
+        return;
+      }
+    }
+    DASH_LOG_TRACE("Deque._release", "tail:", _tail, "batch:", _batch);
+    value_type * ring = _buffer->lbegin();
+    for (size_type i = 0; i < _batch; ++i) {
+      ring[(_tail + i) % _capacity] = _local.front();
+      _local.pop_front();
+    }
+    // Publish elements after they have been written:
+    _control_atomic(_myid, control_tail).add(_batch);
+    _tail += _batch;
+  }
+
+  /**
+   * Moves the newest half of the shared part of the local segment back
+   * to the private part.
+   *
+   * \return  \c false if the shared part is empty.
+   */
+  bool _reclaim()
+  {
+    if (_tail == _head_seen) {
+      return false;
+    }
+    auto lock = _control_atomic(_myid, control_lock);
+    while (lock.compare_exchange(0, 1) != 0) { }
+    _head_seen = _control_atomic(_myid, control_head).fetch_and_add(0);
+    control_type nshared = _tail - _head_seen;
+    control_type nclaim  = (nshared + 1) / 2;
+    if (nclaim > 0) {
+      value_type * ring = _buffer->lbegin();
+      for (control_type i = _tail - nclaim; i < _tail; ++i) {
+        _local.push_back(ring[i % _capacity]);
+      }
+      _tail -= nclaim;
+      _control_atomic(_myid, control_tail).add(-nclaim);
+    }
+    lock.add(-1);
+    DASH_LOG_TRACE("Deque._reclaim >", "claimed:", nclaim);
+    return nclaim > 0;
+  }
+
+  /**
+   * Steals up to half of the shared part of the segment of the given
+   * unit, at most one batch.
+   */
+  size_type _steal_from(team_unit_t victim)
+  {
+    auto lock = _control_atomic(victim, control_lock);
+    if (lock.compare_exchange(0, 1) != 0) {
+      return 0;
+    }
+    auto head = _control_atomic(victim, control_head);
+    control_type first  = head.fetch_and_add(0);
+    control_type last   = _control_atomic(victim, control_tail)
+                            .fetch_and_add(0);
+    control_type nsteal = std::min<control_type>(
+                            (last - first + 1) / 2, _batch);
+    if (nsteal > 0) {
+      _stolen.resize(nsteal);
+      control_type offset = first % _capacity;
+      control_type nfirst = std::min<control_type>(
+                              nsteal, _capacity - offset);
+      dart_storage_t ds   = dash::dart_storage<value_type>(nfirst);
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(
+          _stolen.data(),
+          _buffer->at(victim, offset).dart_gptr(),
+          ds.nelem, ds.dtype),
+        DART_OK);
+      if (nfirst < nsteal) {
+        // Wrap around the end of the ring buffer:
+        ds = dash::dart_storage<value_type>(nsteal - nfirst);
+        DASH_ASSERT_RETURNS(
+          dart_get_blocking(
+            _stolen.data() + nfirst,
+            _buffer->at(victim, 0).dart_gptr(),
+            ds.nelem, ds.dtype),
+          DART_OK);
+      }
+      head.add(nsteal);
+    }
+    lock.add(-1);
+    if (nsteal <= 0) {
+      return 0;
+    }
+    DASH_LOG_TRACE("Deque._steal_from", "victim:", victim,
+                   "stolen:", nsteal);
+    _local.insert(_local.end(), _stolen.begin(), _stolen.end());
+    return nsteal;
+  }
+
+private:
+  /// Team containing all units operating on the queue.
+  Team                     * _team       = nullptr;
+  /// Id of the active unit in the team.
+  team_unit_t                _myid;
+  /// Maximum number of elements in the shared part of a segment.
+  size_type                  _capacity;
+  /// Number of elements moved to the shared part or stolen at once.
+  size_type                  _batch;
+  /// Ring buffers of the shared parts of all segments.
+  glob_mem_type            * _buffer     = nullptr;
+  /// Locks and indices of the shared parts of all segments.
+  glob_control_type        * _control    = nullptr;
+  /// Private part of the local segment.
+  std::deque<value_type>     _local;
+  /// Buffer of elements stolen from another unit.
+  std::vector<value_type>    _stolen;
+  /// Index past the last element in the shared part of the local segment.
+  control_type               _tail       = 0;
+  /// Last known index of the first element in the shared part of the
+  /// local segment, only advanced by other units.
+  control_type               _head_seen  = 0;
+  /// Other units in the team, units in the same node domain first.
+  std::vector<team_unit_t>   _victims;
+  /// Number of units in the same node domain in \c _victims.
+  size_type                  _num_near   = 0;
+  /// Random number generator for the order of victims.
+  std::mt19937               _random;
+  /// Number of successful steals.
+  size_type                  _num_steals = 0;
+
+}; // class Deque
+
+} // namespace dash
+
+#endif // DASH__DEQUE_H__INCLUDED
@@ -0,0 +1,114 @@
+#ifndef DASH__EXECUTION_H__INCLUDED
+#define DASH__EXECUTION_H__INCLUDED
+
+#include <type_traits>
+
+/**
+ * \defgroup  DashExecutionPolicies  Execution policies of DASH algorithms
+ *
+ * \par Description
+ *
+ * Execution policies specify how a unit processes its local portion of
+ * the range passed to a DASH algorithm, following the execution policies
+ * of C++17 (\c std::execution).
+ * Every unit only executes the algorithm on elements in its local memory,
+ * the policy does not affect communication between units.
+ *
+ * - \c dash::execution::seq:
+ *   Local elements are processed in order by the calling thread.
+ * - \c dash::execution::par:
+ *   The local range is split into contiguous chunks that are processed
+ *   by a team of threads, the number of threads is obtained from
+ *   \c dash::util::UnitLocality::num_domain_threads.
+ *   Elements in the same chunk are processed in order.
+ * - \c dash::execution::par_unseq:
+ *   Like \c par, elements in a chunk may additionally be processed
+ *   interleaved in SIMD lanes.
+ *
+ * Without OpenMP support, \c par and \c par_unseq are executed like
+ * \c seq.
+ *
+ * For the same local range size, all algorithms assign identical chunks
+ * to the same thread. When memory of a container is first written by
+ * an algorithm executed with \c par (for example \c dash::fill), pages
+ * are placed in the NUMA domain of the threads that access them in
+ * subsequent parallel algorithms.
+ *
+ * As with \c std::execution policies, the caller is responsible for
+ * preventing data races in functions passed to parallel algorithms.
+ */
+
+namespace dash {
+namespace execution {
+
+/**
+ * Execution policy type of sequential execution of the local phase of
+ * DASH algorithms.
+ *
+ * \ingroup DashExecutionPolicies
+ */
+class sequenced_policy { };
+
+/**
+ * Execution policy type of multithreaded execution of the local phase of
+ * DASH algorithms.
+ *
+ * \ingroup DashExecutionPolicies
+ */
+class parallel_policy { };
+
+/**
+ * Execution policy type of multithreaded and vectorized execution of the
+ * local phase of DASH algorithms.
+ *
+ * \ingroup DashExecutionPolicies
+ */
+class parallel_unsequenced_policy { };
+
+/// Sequential execution policy
+constexpr sequenced_policy            seq       { };
+/// Multithreaded execution policy
+constexpr parallel_policy             par       { };
+/// Multithreaded and vectorized execution policy
+constexpr parallel_unsequenced_policy par_unseq { };
+
+} // namespace execution
+
+/**
+ * Type trait to check whether \c T is a DASH execution policy type.
+ *
+ * \ingroup DashExecutionPolicies
+ */
+template< class T >
+struct is_execution_policy : std::false_type { };
+
+template<>
+struct is_execution_policy<dash::execution::sequenced_policy>
+: std::true_type { };
+
+template<>
+struct is_execution_policy<dash::execution::parallel_policy>
+: std::true_type { };
+
+template<>
+struct is_execution_policy<dash::execution::parallel_unsequenced_policy>
+: std::true_type { };
+
+namespace internal {
+
+/**
+ * Resolves to \c T if \c ExecutionPolicy is an execution policy type,
+ * used to exclude algorithm overloads with execution policy parameter from
+ * overload resolution otherwise.
+ */
+template< class ExecutionPolicy, class T = void >
+using enable_if_execution_policy =
+  typename std::enable_if<
+    dash::is_execution_policy<
+      typename std::decay<ExecutionPolicy>::type >::value,
+    T >::type;
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__EXECUTION_H__INCLUDED
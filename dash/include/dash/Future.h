@@ -3,8 +3,12 @@
 
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <sstream>
 #include <iostream>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
 
 #include <dash/Exception.h>
 #include <dash/internal/Logging.h>
@@ -12,18 +16,76 @@
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Shared state of a \c dash::Future, referenced by all copies of a future
+ * and by futures of its continuations.
+ */
+template<typename ResultT>
+struct FutureState
+{
+  std::function<ResultT (void)> func;
+  std::function<bool (void)>    test_func;
+  ResultT                       value;
+  bool                          ready     = false;
+  bool                          has_func  = false;
+};
+
+template<>
+struct FutureState<void>
+{
+  std::function<void (void)>    func;
+  std::function<bool (void)>    test_func;
+  bool                          ready     = false;
+  bool                          has_func  = false;
+};
+
+} // namespace internal
+
+/**
+ * Result of an asynchronous operation.
+ *
+ * A future is created from a function that completes the operation and
+ * returns its result, and an optional test function that makes progress on
+ * the operation and returns whether it has completed, e.g. by testing DART
+ * handles of pending one-sided transfers.
+ * Futures without test function are deferred: they can only be completed in
+ * \c wait() or \c get().
+ *
+ * Copies of a future share their state, the operation is completed exactly
+ * once.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Future<T *> fut_a = dash::copy_async(a.begin(), a.end(), buf_a);
+ *   dash::Future<T *> fut_b = dash::copy_async(b.begin(), b.end(), buf_b);
+ *   auto fut_sum = dash::when_all(std::vector<dash::Future<T *>> {
+ *                                   fut_a, fut_b })
+ *                    .then([&](std::vector<T *> &) {
+ *                      return std::accumulate(buf_a, buf_a + n, T());
+ *                    });
+ *   while (!fut_sum.test()) {
+ *     // overlap communication with computation
+ *   }
+ *   T sum = fut_sum.get();
+ * \endcode
+ */
 template<typename ResultT>
 class Future
 {
 private:
-  typedef Future<ResultT>               self_t;
-  typedef std::function<ResultT (void)> func_t;
+  typedef Future<ResultT>                  self_t;
+  typedef internal::FutureState<ResultT>   state_t;
+
+public:
+  typedef ResultT                          value_type;
+  typedef std::function<ResultT (void)>    func_t;
+  typedef std::function<bool (void)>       test_func_t;
 
 private:
-  func_t    _func;
-  ResultT   _value;
-  bool      _ready     = false;
-  bool      _has_func  = false;
+  std::shared_ptr<state_t> _state;
 
 public:
   // For ostream output
@@ -34,67 +96,333 @@ public:
 
 public:
   Future()
-  : _ready(false),
-    _has_func(false)
+  : _state(std::make_shared<state_t>())
   { }
 
+  /**
+   * Creates a deferred future, the given function is evaluated in
+   * \c wait().
+   */
   Future(const func_t & func)
-  : _func(func),
-    _ready(false),
-    _has_func(true)
-  { }
+  : _state(std::make_shared<state_t>())
+  {
+    _state->func     = func;
+    _state->has_func = true;
+  }
 
+  /**
+   * Creates a future of an asynchronous operation that is completed by
+   * \c func once \c test_func returned \c true.
+   */
   Future(
-    const self_t & other)
-  : _func(other._func),
-    _value(other._value),
-    _ready(other._ready),
-    _has_func(other._has_func)
-  { }
-
-  Future<ResultT> & operator=(const self_t & other)
+    const func_t      & func,
+    const test_func_t & test_func)
+  : _state(std::make_shared<state_t>())
   {
-    if (this != &other) {
-      _func      = other._func;
-      _value     = other._value;
-      _ready     = other._ready;
-      _has_func  = other._has_func;
-    }
-    return *this;
+    _state->func      = func;
+    _state->test_func = test_func;
+    _state->has_func  = true;
   }
 
+  Future(const self_t & other)               = default;
+  Future<ResultT> & operator=(const self_t & other) = default;
+
+  /**
+   * Blocks until the operation has completed.
+   */
   void wait()
   {
-    DASH_LOG_TRACE_VAR("Future.wait()", _ready);
-    if (_ready) {
+    DASH_LOG_TRACE_VAR("Future.wait()", _state->ready);
+    if (_state->ready) {
       return;
     }
-    if (!_has_func) {
+    if (!_state->has_func) {
       DASH_LOG_ERROR("Future.wait()", "No function");
       DASH_THROW(
         dash::exception::RuntimeError,
         "Future not initialized with function");
     }
-    _value = _func();
-    _ready = true;
-    DASH_LOG_TRACE_VAR("Future.wait >", _ready);
+    _state->value = _state->func();
+    _state->ready = true;
+    // Release resources captured by the completion functions:
+    _state->func      = nullptr;
+    _state->test_func = nullptr;
+    DASH_LOG_TRACE_VAR("Future.wait >", _state->ready);
   }
 
+  /**
+   * Makes progress on the operation and completes it if possible.
+   * Does not block.
+   *
+   * \returns  true if the result is available
+   */
   bool test() const
   {
-    return _ready;
+    if (!_state->ready && _state->test_func && _state->test_func()) {
+      const_cast<self_t *>(this)->wait();
+    }
+    return _state->ready;
+  }
+
+  /**
+   * Whether the future has no test function and can only be completed
+   * in \c wait().
+   */
+  bool is_deferred() const
+  {
+    return !_state->ready && !_state->test_func;
+  }
+
+  /**
+   * Whether the future refers to an operation or a result.
+   */
+  bool valid() const
+  {
+    return _state->ready || _state->has_func;
   }
 
   ResultT & get()
   {
-    DASH_LOG_TRACE_VAR("Future.get()", _ready);
+    DASH_LOG_TRACE_VAR("Future.get()", _state->ready);
     wait();
-    DASH_LOG_TRACE_VAR("Future.get >", _value);
-    return _value;
+    DASH_LOG_TRACE_VAR("Future.get >", _state->value);
+    return _state->value;
+  }
+
+  /**
+   * Attaches a continuation that is invoked with the result of this future.
+   *
+   * \returns  Future of the continuation's result, completed when this
+   *           future has completed.
+   */
+  template<typename ContinuationT>
+  Future<typename std::result_of<ContinuationT(ResultT &)>::type>
+  then(ContinuationT continuation)
+  {
+    typedef typename std::result_of<ContinuationT(ResultT &)>::type
+      cont_result_t;
+    self_t pred(*this);
+    return Future<cont_result_t>(
+             [=]() mutable { return continuation(pred.get()); },
+             [=]()         { return pred.test(); });
   }
 
 }; // class Future
 
+/**
+ * Future of an asynchronous operation without result.
+ */
+template<>
+class Future<void>
+{
+private:
+  typedef Future<void>                     self_t;
+  typedef internal::FutureState<void>      state_t;
+
+public:
+  typedef void                             value_type;
+  typedef std::function<void (void)>       func_t;
+  typedef std::function<bool (void)>       test_func_t;
+
+private:
+  std::shared_ptr<state_t> _state;
+
+public:
+  Future()
+  : _state(std::make_shared<state_t>())
+  { }
+
+  Future(const func_t & func)
+  : _state(std::make_shared<state_t>())
+  {
+    _state->func     = func;
+    _state->has_func = true;
+  }
+
+  Future(
+    const func_t      & func,
+    const test_func_t & test_func)
+  : _state(std::make_shared<state_t>())
+  {
+    _state->func      = func;
+    _state->test_func = test_func;
+    _state->has_func  = true;
+  }
+
+  Future(const self_t & other)               = default;
+  Future<void> & operator=(const self_t & other) = default;
+
+  void wait()
+  {
+    DASH_LOG_TRACE_VAR("Future<void>.wait()", _state->ready);
+    if (_state->ready) {
+      return;
+    }
+    if (!_state->has_func) {
+      DASH_LOG_ERROR("Future<void>.wait()", "No function");
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Future not initialized with function");
+    }
+    _state->func();
+    _state->ready     = true;
+    _state->func      = nullptr;
+    _state->test_func = nullptr;
+  }
+
+  bool test() const
+  {
+    if (!_state->ready && _state->test_func && _state->test_func()) {
+      const_cast<self_t *>(this)->wait();
+    }
+    return _state->ready;
+  }
+
+  bool is_deferred() const
+  {
+    return !_state->ready && !_state->test_func;
+  }
+
+  bool valid() const
+  {
+    return _state->ready || _state->has_func;
+  }
+
+  void get()
+  {
+    wait();
+  }
+
+  template<typename ContinuationT>
+  Future<typename std::result_of<ContinuationT()>::type>
+  then(ContinuationT continuation)
+  {
+    typedef typename std::result_of<ContinuationT()>::type
+      cont_result_t;
+    self_t pred(*this);
+    return Future<cont_result_t>(
+             [=]() mutable { pred.wait(); return continuation(); },
+             [=]()         { return pred.test(); });
+  }
+
+}; // class Future<void>
+
+/**
+ * Creates a future that is ready with the given value.
+ */
+template<typename ValueT>
+Future<typename std::decay<ValueT>::type>
+make_ready_future(ValueT && value)
+{
+  typedef typename std::decay<ValueT>::type value_t;
+  value_t v(std::forward<ValueT>(value));
+  Future<value_t> fut([=]() { return v; },
+                      []()  { return true; });
+  fut.wait();
+  return fut;
+}
+
+/**
+ * Creates a future that is completed when all of the given futures are
+ * completed.
+ *
+ * \returns  Future of the results of the given futures, in their order.
+ */
+template<typename ResultT>
+Future< std::vector<ResultT> >
+when_all(const std::vector< Future<ResultT> > & pending)
+{
+  std::vector< Future<ResultT> > futures(pending);
+  return Future< std::vector<ResultT> >(
+           [=]() mutable {
+             std::vector<ResultT> results;
+             results.reserve(futures.size());
+             for (auto & f : futures) {
+               results.push_back(f.get());
+             }
+             return results;
+           },
+           [=]() {
+             bool all_ready = true;
+             // Test every future to make progress on all of them:
+             for (auto & f : futures) {
+               all_ready = f.test() && all_ready;
+             }
+             return all_ready;
+           });
+}
+
+/**
+ * Creates a future that is completed when all of the given futures are
+ * completed.
+ */
+inline Future<void>
+when_all(const std::vector< Future<void> > & pending)
+{
+  std::vector< Future<void> > futures(pending);
+  return Future<void>(
+           [=]() mutable {
+             for (auto & f : futures) {
+               f.wait();
+             }
+           },
+           [=]() {
+             bool all_ready = true;
+             for (auto & f : futures) {
+               all_ready = f.test() && all_ready;
+             }
+             return all_ready;
+           });
+}
+
+/**
+ * Creates a future that is completed when any of the given futures is
+ * completed.
+ * If none of the futures can make progress in \c test(), the first
+ * deferred future is completed.
+ *
+ * \returns  Future of the index of a completed future in the given range.
+ *
+ * \throws  dash::exception::InvalidArgument  if the range of futures is
+ *          empty
+ */
+template<typename ResultT>
+Future<std::size_t>
+when_any(const std::vector< Future<ResultT> > & pending)
+{
+  if (pending.empty()) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::when_any: empty range of futures");
+  }
+  std::vector< Future<ResultT> > futures(pending);
+  auto test_any = [=](std::size_t & idx) {
+                    for (idx = 0; idx < futures.size(); ++idx) {
+                      if (futures[idx].test()) {
+                        return true;
+                      }
+                    }
+                    return false;
+                  };
+  return Future<std::size_t>(
+           [=]() mutable {
+             std::size_t idx;
+             while (!test_any(idx)) {
+               for (idx = 0; idx < futures.size(); ++idx) {
+                 if (futures[idx].is_deferred()) {
+                   futures[idx].wait();
+                   return idx;
+                 }
+               }
+             }
+             return idx;
+           },
+           [=]() {
+             std::size_t idx;
+             return test_any(idx);
+           });
+}
+
 template<typename ResultT>
 std::ostream & operator<<(
   std::ostream & os,
@@ -102,8 +430,8 @@ std::ostream & operator<<(
 {
   std::ostringstream ss;
   ss << "dash::Future<" << typeid(ResultT).name() << ">(";
-  if (future._ready) {
-    ss << future._value;
+  if (future._state->ready) {
+    ss << future._state->value;
   } else {
     ss << "not ready";
   }
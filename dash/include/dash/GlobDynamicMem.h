@@ -20,6 +20,7 @@
 
 #include <dash/internal/Logging.h>
 
+#include <algorithm>
 #include <list>
 #include <vector>
 #include <iterator>
@@ -53,6 +54,10 @@ namespace dash {
  *
  * Newly allocated memory segments are unattached and immediately accessible
  * by the local unit only.
+ * The collective operation \c reserve registers local capacity in global
+ * memory in advance. Growing the local segment within its reserved capacity
+ * is non-collective and remote units obtain the new local size in the
+ * one-sided operation \c refresh, without a commit.
  * Deallocated memory is immediately removed from the local unit's memory
  * space but remains accessible for remote units.
  *
@@ -79,6 +84,8 @@ namespace dash {
  * <tt>void</tt>        | <tt>grow</tt>      | <tt>size lsize_diff</tt>    | Extend the size of the local segment of the global memory space by the specified number of values.         |
  * <tt>void</tt>        | <tt>shrink</tt>    | <tt>size lsize_diff</tt>    | Reduce the size of the local segment of the global memory space by the specified number of values.         |
  * <tt>void</tt>        | <tt>commit</tt>    | nbsp;                       | Publish changes to local memory across all units.                                                          |
+ * <tt>void</tt>        | <tt>reserve</tt>   | <tt>size lcap</tt>          | Register local capacity in global memory, so grow operations within the capacity are visible immediately.  |
+ * <tt>size</tt>        | <tt>refresh</tt>   | <tt>unit u</tt>             | Read the local size published by unit \c u in a one-sided operation.                                       |
  *
  *
  * \par Methods inherited from Global Memory concept
@@ -257,6 +264,16 @@ private:
   typedef std::vector<std::vector<size_type> >
     bucket_cumul_sizes_map;
 
+  typedef dash::Array<
+            uint64_t, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
+    size_words_map;
+
+  /// Bit offset of the epoch in the published size word of a unit, the
+  /// lower bits store the attached local size.
+  static const int      size_word_epoch_shift = 48;
+  static const uint64_t size_word_size_mask    =
+                          (uint64_t(1) << size_word_epoch_shift) - 1;
+
   template<typename T_, class GMem_, class Ptr_, class Ref_>
   friend class dash::GlobBucketIter;
 
@@ -283,7 +300,9 @@ public:
     _bucket_cumul_sizes(team.size()),
     _num_attach_buckets(team.size()),
     _num_detach_buckets(team.size()),
-    _remote_size(0)
+    _remote_size(0),
+    _published_sizes(team.size()),
+    _remote_epochs(team.size(), 0)
   {
     DASH_LOG_TRACE("GlobDynamicMem.(ninit,nunits)",
                    n_local_elem, team.size());
@@ -291,6 +310,7 @@ public:
     _local_sizes.local[0]        = 0;
     _num_attach_buckets.local[0] = 0;
     _num_detach_buckets.local[0] = 0;
+    _published_sizes.local[0]    = 0;
 
     DASH_LOG_TRACE("GlobDynamicMem.GlobDynamicMem",
                    "allocating initial memory space");
@@ -408,12 +428,16 @@ public:
    * Local operation.
    * Newly allocated memory is attached to global memory space by calling
    * the collective operation \c attach().
+   * Memory grown within the capacity registered in \c reserve() is
+   * attached already and its new size is published to remote units
+   * immediately.
    *
    * \return  Native pointer to beginning of new allocated memory.
    *
    * \see resize
    * \see shrink
    * \see commit
+   * \see reserve
    */
   local_iterator grow(size_type num_elements)
   {
@@ -427,28 +451,64 @@ public:
     }
     // Update size of local memory space:
     _local_sizes.local[0]        += num_elements;
-    // Update number of local buckets marked for attach:
-    _num_attach_buckets.local[0] += 1;
 
-    // Create new unattached bucket:
-    DASH_LOG_TRACE("GlobDynamicMem.grow", "creating new unattached bucket:",
-                   "size:", num_elements);
-    bucket_type bucket;
-    bucket.size     = num_elements;
-    bucket.lptr     = _allocator.allocate_local(bucket.size);
-    bucket.gptr     = DART_GPTR_NULL;
-    bucket.attached = false;
-    // Add bucket to local memory space:
-    _buckets.push_back(bucket);
-    if (_attach_buckets_first == _buckets.end()) {
-      // Move iterator to first unattached bucket to position of new bucket:
-      _attach_buckets_first = _buckets.begin();
-      std::advance(_attach_buckets_first,  _buckets.size() - 1);
+    if (_reserve_active &&
+        _buckets.back().size + num_elements <= _reserve_capacity) {
+      // Extend the attached bucket of reserved capacity, no commit is
+      // required to make the new elements accessible to remote units:
+      DASH_LOG_TRACE("GlobDynamicMem.grow", "extending reserved bucket:",
+                     "size:", _buckets.back().size,
+                     "capacity:", _reserve_capacity);
+      _buckets.back().size              += num_elements;
+      _bucket_cumul_sizes[_myid].back() += num_elements;
+      publish_local_size();
+    } else if (!_buckets.empty() && !_buckets.back().attached &&
+        _buckets.back().size + num_elements <= _attach_slab_capacity) {
+      // Extend the newest unattached bucket within its allocated slab, so
+      // all buckets grown since the last commit are attached in a single
+      // registration:
+      DASH_LOG_TRACE("GlobDynamicMem.grow", "extending unattached bucket:",
+                     "size:", _buckets.back().size,
+                     "slab capacity:", _attach_slab_capacity);
+      _attach_epoch_size                += num_elements;
+      _buckets.back().size              += num_elements;
+      _bucket_cumul_sizes[_myid].back() += num_elements;
+    } else {
+      _attach_epoch_size           += num_elements;
+      // Buckets grown after the reserved bucket must be attached:
+      _reserve_active               = false;
+      // Update number of local buckets marked for attach:
+      _num_attach_buckets.local[0] += 1;
+      // Create new unattached bucket. Allocate a slab with capacity for
+      // the number of elements grown since the last commit, so the number
+      // of buckets attached in the next commit is logarithmic in the
+      // number of calls of grow():
+      _attach_slab_capacity = std::max<size_type>(
+                                num_elements,
+                                _attach_epoch_size > num_elements
+                                ? _attach_epoch_size
+                                : 0);
+      DASH_LOG_TRACE("GlobDynamicMem.grow", "creating new unattached bucket:",
+                     "size:", num_elements,
+                     "slab capacity:", _attach_slab_capacity);
+      bucket_type bucket;
+      bucket.size     = num_elements;
+      bucket.lptr     = _allocator.allocate_local(_attach_slab_capacity);
+      bucket.gptr     = DART_GPTR_NULL;
+      bucket.attached = false;
+      // Add bucket to local memory space:
+      _buckets.push_back(bucket);
+      if (_attach_buckets_first == _buckets.end()) {
+        // Move iterator to first unattached bucket to position of new
+        // bucket:
+        _attach_buckets_first = _buckets.begin();
+        std::advance(_attach_buckets_first,  _buckets.size() - 1);
+      }
+      _bucket_cumul_sizes[_myid].push_back(_local_sizes.local[0]);
+      DASH_LOG_TRACE("GlobDynamicMem.grow", "added unattached bucket:",
+                     "size:", bucket.size,
+                     "lptr:", bucket.lptr);
     }
-    _bucket_cumul_sizes[_myid].push_back(_local_sizes.local[0]);
-    DASH_LOG_TRACE("GlobDynamicMem.grow", "added unattached bucket:",
-                   "size:", bucket.size,
-                   "lptr:", bucket.lptr);
     // Update local iteration space:
     _lbegin = lbegin(_myid);
     _lend   = lend(_myid);
@@ -459,6 +519,7 @@ public:
     DASH_LOG_TRACE("GlobDynamicMem.grow",
                    "local buckets:",      _buckets.size(),
                    "unattached buckets:", _num_attach_buckets.local[0]);
+    _unit_cumul_sizes_valid = false;
     DASH_LOG_TRACE("GlobDynamicMem.grow >");
     // Return local iterator to start of allocated memory:
     return _lbegin + local_size_old;
@@ -557,7 +618,10 @@ public:
                          "updating iterator to first unattached bucket");
           _attach_buckets_first--;
         }
+        _allocator.deallocate_local(bucket_last.lptr);
         _buckets.pop_back();
+        // Capacity of the slab of the preceding bucket is unknown:
+        _attach_slab_capacity = 0;
         if (_attach_buckets_first->attached) {
           // Updated iterator to first unattached bucket references attached
           // bucket:
@@ -612,6 +676,12 @@ public:
     // Mark attached buckets for deallocation.
     // Requires separate loop as iterators on _buckets could be invalidated.
     DASH_LOG_DEBUG_VAR("GlobDynamicMem.shrink", num_dealloc_gbuckets);
+    if (num_dealloc_gbuckets > 0) {
+      // Cumulative bucket sizes of this unit at remote units are invalid
+      // until the next commit:
+      ++_size_epoch;
+      _reserve_active = false;
+    }
     while (num_dealloc_gbuckets-- > 0) {
       auto dealloc_bucket = _buckets.back();
       DASH_LOG_TRACE("GlobDynamicMem.shrink", "deallocate attached bucket:"
@@ -622,6 +692,8 @@ public:
       // Unregister bucket:
       _buckets.pop_back();
     }
+    publish_local_size();
+    _unit_cumul_sizes_valid = false;
     // Update local iterators as bucket iterators might have changed:
     _lbegin = lbegin(_myid);
     _lend   = lend(_myid);
@@ -665,14 +737,19 @@ public:
     // at the same time:
     size_type num_detached_elem = commit_detach();
     size_type num_attached_elem = commit_attach();
-
-    if (num_detached_elem > 0 || num_attached_elem > 0) {
-      // Update _begin iterator:
-      DASH_LOG_TRACE("GlobDynamicMem.commit", "updating _begin");
-      _begin = global_iterator(this, 0);
-      DASH_LOG_TRACE("GlobDynamicMem.commit", "updating _end");
-      _end   = _begin + size();
-    }
+    _unit_cumul_sizes_valid     = false;
+    // Publish local size including buckets attached in this commit:
+    publish_local_size();
+
+    DASH_LOG_TRACE("GlobDynamicMem.commit",
+                   "detached:", num_detached_elem,
+                   "attached:", num_attached_elem);
+    // Update global iterators, also if only remote units changed their
+    // local memory space:
+    DASH_LOG_TRACE("GlobDynamicMem.commit", "updating _begin");
+    _begin = global_iterator(this, 0);
+    DASH_LOG_TRACE("GlobDynamicMem.commit", "updating _end");
+    _end   = _begin + size();
     // Update local iterators as bucket iterators might have changed:
     DASH_LOG_TRACE("GlobDynamicMem.commit", "updating _lbegin");
     _lbegin = lbegin(_myid);
@@ -712,6 +789,116 @@ public:
     DASH_LOG_DEBUG("GlobDynamicMem.resize >");
   }
 
+  /**
+   * Register local capacity for the given number of elements in global
+   * memory, in addition to the current local size.
+   * Commits pending changes of local memory space.
+   *
+   * Collective operation.
+   *
+   * Subsequent calls of \c grow() within the reserved capacity do not
+   * allocate unattached buckets but extend the reserved bucket, which is
+   * accessible by remote units without a commit. Remote units obtain the
+   * new local size in \c refresh().
+   * The reserved capacity is released from use for non-collective growth
+   * in the next commit that attaches memory at any unit and when shrinking
+   * detaches the reserved bucket.
+   *
+   * Values written to the grown memory are not synchronized, units have to
+   * synchronize with the unit that grew its local memory before accessing
+   * them, for example in a barrier.
+   *
+   * \see grow
+   * \see refresh
+   * \see commit
+   */
+  void reserve(size_type num_elements)
+  {
+    DASH_LOG_DEBUG_VAR("GlobDynamicMem.reserve()", num_elements);
+    commit();
+    // Every unit attaches exactly one bucket so bucket indices are
+    // consistent at all units:
+    bucket_type bucket;
+    bucket.size     = 0;
+    bucket.lptr     = num_elements > 0
+                      ? _allocator.allocate_local(num_elements)
+                      : nullptr;
+    bucket.gptr     = _allocator.attach(bucket.lptr, num_elements);
+    bucket.attached = true;
+    DASH_ASSERT(!DART_GPTR_ISNULL(bucket.gptr));
+    _buckets.push_back(bucket);
+    for (auto & u_bucket_cumul_sizes : _bucket_cumul_sizes) {
+      u_bucket_cumul_sizes.push_back(u_bucket_cumul_sizes.empty()
+                                     ? 0
+                                     : u_bucket_cumul_sizes.back());
+    }
+    _reserve_capacity = num_elements;
+    _reserve_active   = num_elements > 0;
+    _unit_cumul_sizes_valid = false;
+    publish_local_size();
+    _lbegin = lbegin(_myid);
+    _lend   = lend(_myid);
+    DASH_LOG_DEBUG("GlobDynamicMem.reserve >",
+                   "lptr:", bucket.lptr, "gptr:", bucket.gptr);
+  }
+
+  /**
+   * Update the local size of the given unit from the size it published
+   * when growing or shrinking its local memory space.
+   *
+   * Local operation, reads the size of the unit in a one-sided operation.
+   *
+   * The local size of the unit is only updated if the unit did not
+   * detach memory since the last commit.
+   *
+   * \return  The local size of the specified unit.
+   *
+   * \see reserve
+   */
+  size_type refresh(team_unit_t unit)
+  {
+    DASH_LOG_DEBUG_VAR("GlobDynamicMem.refresh()", unit);
+    DASH_ASSERT_RANGE(0, unit, _nunits-1, "unit id out of range");
+    if (unit == _myid) {
+      return local_size();
+    }
+    auto & u_bucket_cumul_sizes = _bucket_cumul_sizes[unit];
+    uint64_t  size_word = _published_sizes[unit.id];
+    size_type u_epoch   = size_word >> size_word_epoch_shift;
+    size_type u_size    = size_word &  size_word_size_mask;
+    DASH_LOG_TRACE("GlobDynamicMem.refresh", "unit:", unit,
+                   "epoch:", u_epoch, "size:", u_size);
+    if (u_epoch == _remote_epochs[unit] && !u_bucket_cumul_sizes.empty()) {
+      _remote_size                -= u_bucket_cumul_sizes.back();
+      u_bucket_cumul_sizes.back()  = u_size;
+      _remote_size                += u_size;
+      _unit_cumul_sizes_valid      = false;
+    }
+    DASH_LOG_DEBUG("GlobDynamicMem.refresh >", local_size(unit));
+    return local_size(unit);
+  }
+
+  /**
+   * Update the local sizes of all units from the sizes they published
+   * when growing or shrinking their local memory space.
+   *
+   * Local operation.
+   *
+   * \return  The total number of elements in global memory space.
+   *
+   * \see refresh(team_unit_t)
+   */
+  size_type refresh()
+  {
+    DASH_LOG_DEBUG("GlobDynamicMem.refresh()");
+    for (size_type u = 0; u < _nunits; ++u) {
+      refresh(team_unit_t(u));
+    }
+    _end = _begin + size();
+    DASH_LOG_DEBUG("GlobDynamicMem.refresh >", size());
+    return size();
+  }
+
   /**
    * Global pointer of the initial address of the global memory.
    */
@@ -1054,24 +1241,14 @@ private:
     DASH_LOG_TRACE("GlobDynamicMem.commit_attach()");
     DASH_LOG_TRACE("GlobDynamicMem.commit_attach",
                    "local buckets to attach:", _num_attach_buckets.local[0]);
-    // Unregister buckets marked for detach in global memory:
-    _num_attach_buckets.barrier();
-    // Minumum and maximum number of buckets to be attached by any unit:
-    auto min_max_attach     = gather_min_max(_num_attach_buckets.begin(),
-                                             _num_attach_buckets.end());
-    auto min_attach_buckets = min_max_attach.first;
-    auto max_attach_buckets = min_max_attach.second;
-    DASH_LOG_TRACE("GlobDynamicMem.commit_attach",
-                   "min. attach buckets:",  min_attach_buckets);
-    DASH_LOG_TRACE("GlobDynamicMem.commit_attach",
-                   "max. attach buckets:",  max_attach_buckets);
     // Number of buckets successfully attached in this commit:
     size_type num_attached_buckets = 0;
     // Number of elements allocated in global memory in this commit:
     size_type num_attached_elem    = 0;
     // Number of elements at remote units before the commit:
     size_type old_remote_size      = _remote_size;
-    _remote_size                   = update_remote_size();
+    // Maximum number of buckets to be attached by any unit:
+    size_type max_attach_buckets   = update_remote_size();
     // Whether at least one remote unit needs to attach additional global
     // memory:
     bool has_remote_attach         = _remote_size > old_remote_size;
@@ -1079,19 +1256,28 @@ private:
     DASH_LOG_TRACE_VAR("GlobDynamicMem.commit_attach", _remote_size);
     DASH_LOG_TRACE_VAR("GlobDynamicMem.commit_attach", size());
     DASH_LOG_TRACE_VAR("GlobDynamicMem.commit_attach", has_remote_attach);
+    DASH_LOG_TRACE("GlobDynamicMem.commit_attach",
+                   "max. attach buckets:",  max_attach_buckets);
     // Plausibility check:
     DASH_ASSERT(!has_remote_attach || max_attach_buckets > 0);
 
+    // Buckets grown since the last commit are allocated in a new slab:
+    _attach_slab_capacity = 0;
+    _attach_epoch_size    = 0;
+
     // Attach local unattached buckets in global memory space.
     // As bucket sizes differ between units, units must collect gptr's
     // (dart_gptr_t) and size of buckets attached by other units and store
     // them locally so a remote unit's local index can be mapped to the
     // remote unit's bucket.
-    if (min_attach_buckets == 0 && max_attach_buckets == 0) {
-      DASH_LOG_TRACE("GlobDynamicMem.commit_attach", "no attach");
+    if (max_attach_buckets == 0) {
+      DASH_LOG_TRACE("GlobDynamicMem.commit_attach >", "no attach");
       DASH_ASSERT(_attach_buckets_first == _buckets.end());
       DASH_ASSERT(_buckets.empty() || _buckets.back().attached);
+      return 0;
     }
+    // Attached buckets are appended after the reserved bucket:
+    _reserve_active = false;
     DASH_LOG_TRACE("GlobDynamicMem.commit_attach", "attaching",
                    std::distance(_attach_buckets_first, _buckets.end()),
                    "buckets");
@@ -1127,6 +1313,12 @@ private:
       bucket.gptr     = _allocator.attach(bucket.lptr, bucket.size);
       DASH_ASSERT(!DART_GPTR_ISNULL(bucket.gptr));
       _buckets.push_back(bucket);
+      // Keep bucket indices consistent with the list of cumulative bucket
+      // sizes used to resolve global pointers:
+      auto & l_bucket_cumul_sizes = _bucket_cumul_sizes[_myid];
+      l_bucket_cumul_sizes.push_back(l_bucket_cumul_sizes.empty()
+                                     ? 0
+                                     : l_bucket_cumul_sizes.back());
       num_attached_buckets++;
       DASH_LOG_TRACE("GlobDynamicMem.commit_attach", "attached null bucket:",
                      "gptr:", bucket.gptr,
@@ -1137,33 +1329,11 @@ private:
     return num_attached_elem;
   }
 
-  template<
-    typename GlobalIt,
-    typename ValueType = typename GlobalIt::value_type >
-  std::pair<ValueType, ValueType> gather_min_max(
-    const GlobalIt & first,
-    const GlobalIt & last)
-  {
-    // TODO: Unoptimized, use dash::min_max_element once it is available
-    //
-    DASH_LOG_TRACE("GlobDynamicMem.gather_min_max()");
-    size_type * lcopy     = new ValueType[dash::distance(first, last)];
-    size_type * lcopy_end = dash::copy(first, last, lcopy);
-    auto min_lptr  = std::min_element(lcopy, lcopy_end);
-    auto max_lptr  = std::max_element(lcopy, lcopy_end);
-    std::pair<ValueType, ValueType> min_max;
-    min_max.first  = *min_lptr;
-    min_max.second = *max_lptr;
-    delete[] lcopy;
-    DASH_LOG_TRACE("GlobDynamicMem.gather_min_max >",
-                   "min:", min_max.first,
-                   "max:", min_max.second);
-    return min_max;
-  }
-
   /**
-   * Request the size of all units' local memory, including unattached memory
-   * regions, and update the capacity of global memory space.
+   * Exchange the size of all units' local memory, including unattached
+   * memory regions, and update the capacity of global memory space.
+   *
+   * \return  The maximum number of buckets to be attached by any unit.
    */
   size_type update_remote_size()
   {
@@ -1184,118 +1354,125 @@ private:
     //
     // Outline:
     //
-    // 1. Create local copy of the distributed array _num_attach_buckets that
-    //    contains the number of unattached buckets of every unit.
-    // 2. Temporarily attach an array attach_bucket_sizes in global memory
-    //    that contains the sizes of this unit's unattached buckets.
-    // 3. At this point, every unit published the number of buckets it will
-    //    attach in the next commit, and their sizes.
-    //    The current local size Lu of every unit, including its unattached
-    //    buckets, is stored in _local_sizes.
-    // 4. For every remote unit u:
+    // 1. Gather the current local size Lu, including unattached buckets,
+    //    the number of unattached buckets and the size word of every unit
+    //    in a single allgather. The size word contains the size of the
+    //    unit's attached buckets and the epoch of its detach operations.
+    // 2. Only if any unit has more than one unattached bucket, gather the
+    //    sizes of the single unattached buckets of all units, padded to
+    //    the maximum number of unattached buckets.
+    // 3. For every remote unit u, set the last cumulative bucket size to
+    //    the size of its attached buckets and append the sizes of its
+    //    unattached buckets to the unit's list of cumulative bucket sizes:
     //    - If unit u has one unattached bucket, append the unit's current
-    //      local size Lu to the unit's list of cumulative bucket sizes.
-    //    - If unit u has more than one unattached bucket, the sizes of the
-    //      single buckets must be retrieved from the vector
-    //      attach_bucket_sizes temporarily attached by u in step 1.
-    // 5. Detach vector attach_bucket_sizes.
+    //      local size Lu.
+    //    - If unit u has more than one unattached bucket, accumulate the
+    //      bucket sizes gathered in step 2.
+    //    Lists of units that did not change are not modified.
 
     DASH_LOG_TRACE("GlobDynamicMem.update_remote_size()");
     size_type new_remote_size = 0;
-    // Number of unattached buckets of every unit:
-    std::vector<size_type> num_unattached_buckets(_nunits, 0);
-    _num_attach_buckets.barrier();
-    dash::copy(_num_attach_buckets.begin(),
-               _num_attach_buckets.end(),
-               num_unattached_buckets.data());
-    // Attach array of local unattached bucket sizes to allow remote units to
-    // query the sizes of this unit's unattached buckets.
+    // Local size, number of unattached buckets and published size word of
+    // every unit:
+    uint64_t local_attach_info[3] = { _local_sizes.local[0],
+                                      _num_attach_buckets.local[0],
+                                      local_size_word() };
+    std::vector<uint64_t> attach_info(3 * _nunits, 0);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        local_attach_info,
+        attach_info.data(),
+        sizeof(local_attach_info),
+        DART_TYPE_BYTE,
+        _teamid),
+      DART_OK);
+    // Units attaching less buckets than others attach null buckets:
+    size_type max_unattached_buckets = 0;
+    for (size_type u = 0; u < _nunits; ++u) {
+      max_unattached_buckets = std::max<size_type>(max_unattached_buckets,
+                                                   attach_info[3 * u + 1]);
+    }
+    // Sizes of unattached buckets of all units, only required if any unit
+    // has more than one unattached bucket:
     std::vector<size_type> attach_buckets_sizes;
-    for (auto bit = _attach_buckets_first; bit != _buckets.end(); ++bit) {
-      attach_buckets_sizes.push_back((*bit).size);
+    if (max_unattached_buckets > 1) {
+      std::vector<size_type> local_attach_buckets_sizes(
+                               max_unattached_buckets, 0);
+      size_type bi = 0;
+      for (auto bit = _attach_buckets_first; bit != _buckets.end(); ++bit) {
+        local_attach_buckets_sizes[bi++] = (*bit).size;
+      }
+      DASH_LOG_TRACE_VAR("GlobDynamicMem.update_remote_size",
+                         local_attach_buckets_sizes);
+      attach_buckets_sizes.resize(max_unattached_buckets * _nunits);
+      DASH_ASSERT_RETURNS(
+        dart_allgather(
+          local_attach_buckets_sizes.data(),
+          attach_buckets_sizes.data(),
+          max_unattached_buckets * sizeof(size_type),
+          DART_TYPE_BYTE,
+          _teamid),
+        DART_OK);
     }
-    DASH_LOG_TRACE_VAR("GlobDynamicMem.update_remote_size",
-                       attach_buckets_sizes);
-    // Use same allocator type as used for values in global memory:
-    typedef typename allocator_type::template rebind<size_type>::other
-      size_type_allocator_t;
-    size_type_allocator_t attach_buckets_sizes_allocator(_allocator.team());
-    auto attach_buckets_sizes_gptr = attach_buckets_sizes_allocator.attach(
-                                       &attach_buckets_sizes[0],
-                                       attach_buckets_sizes.size());
-    _team->barrier();
-    // Implicit barrier in allocator.attach
-    DASH_LOG_TRACE_VAR("GlobDynamicMem.update_remote_size",
-                       attach_buckets_sizes_gptr);
-    for (int u = 0; u < _nunits; ++u) {
-      if (u == _myid) {
+    for (size_type u = 0; u < _nunits; ++u) {
+      if (u == static_cast<size_type>(_myid)) {
         continue;
       }
-      DASH_LOG_TRACE("GlobDynamicMem.update_remote_size",
-                     "collecting local bucket sizes of unit", u);
       // Last known local attached capacity of remote unit:
       auto & u_bucket_cumul_sizes = _bucket_cumul_sizes[u];
-      // Request current locally allocated capacity of remote unit:
       size_type u_local_size_old  = u_bucket_cumul_sizes.size() == 0
                                     ? 0
                                     : u_bucket_cumul_sizes.back();
-      size_type u_local_size_new  = _local_sizes[u];
-      DASH_LOG_TRACE_VAR("GlobDynamicMem.update_remote_size",
-                         u_local_size_old);
-      DASH_LOG_TRACE_VAR("GlobDynamicMem.update_remote_size",
-                         u_local_size_old);
-      int u_local_size_diff  = u_local_size_new - u_local_size_old;
-      new_remote_size       += u_local_size_new;
+      size_type u_local_size_new  = attach_info[3 * u];
+      new_remote_size            += u_local_size_new;
       // Number of unattached buckets of unit u:
-      size_type u_num_attach_buckets = num_unattached_buckets[u];
-      DASH_LOG_TRACE_VAR("GlobDynamicMem.update_remote_size",
-                         u_num_attach_buckets);
-      if (u_num_attach_buckets == 0) {
-        // No unattached buckets at unit u.
-      } else if (u_num_attach_buckets == 1) {
+      size_type u_num_attach_buckets = attach_info[3 * u + 1];
+      // Size of attached buckets of unit u:
+      uint64_t  u_size_word       = attach_info[3 * u + 2];
+      size_type u_attached_size   = u_size_word & size_word_size_mask;
+      _remote_epochs[u]           = u_size_word >> size_word_epoch_shift;
+      if (u_num_attach_buckets == 0 &&
+          u_local_size_new == u_local_size_old &&
+          max_unattached_buckets == 0) {
+        // Unit u did not change its local memory space.
+        continue;
+      }
+      DASH_LOG_TRACE("GlobDynamicMem.update_remote_size", "unit", u,
+                     "local size:", u_local_size_old, "->", u_local_size_new,
+                     "attached size:", u_attached_size,
+                     "unattached buckets:", u_num_attach_buckets);
+      if (!u_bucket_cumul_sizes.empty()) {
+        // Local memory space of unit u shrunk or grew within its reserved
+        // capacity:
+        u_bucket_cumul_sizes.back() = u_attached_size;
+      }
+      if (u_num_attach_buckets == 1) {
         // One unattached bucket at unit u, no need to request single bucket
         // sizes:
         u_bucket_cumul_sizes.push_back(u_local_size_new);
-      } else {
-        // Unit u has multiple unattached buckets.
-        // Request sizes of single unattached buckets of unit u:
-        std::vector<size_type> u_attach_buckets_sizes(
-                                 u_num_attach_buckets, 0);
-        dart_gptr_t u_attach_buckets_sizes_gptr = attach_buckets_sizes_gptr;
-        dart_gptr_setunit(&u_attach_buckets_sizes_gptr, u);
-        dart_storage_t ds = dash::dart_storage<size_type>(u_num_attach_buckets);
-        DASH_ASSERT_RETURNS(
-          dart_get_blocking(
-            // local dest:
-            u_attach_buckets_sizes.data(),
-            // global source:
-            u_attach_buckets_sizes_gptr,
-            // request bytes (~= number of sizes) from unit u:
-            ds.nelem, ds.dtype),
-          DART_OK);
-        // Update local snapshot of cumulative bucket sizes at unit u:
-        for (int bi = 0; bi < u_num_attach_buckets; ++bi) {
-          size_type single_bkt_size = u_attach_buckets_sizes[bi];
-          size_type cumul_bkt_size  = single_bkt_size;
-          DASH_LOG_TRACE_VAR("GlobDynamicMem.update_remote_size",
-                             single_bkt_size);
-          if (u_bucket_cumul_sizes.size() > 0) {
-            cumul_bkt_size += u_bucket_cumul_sizes.back();
-          }
-          u_bucket_cumul_sizes.push_back(cumul_bkt_size);
+      } else if (u_num_attach_buckets > 1) {
+        // Accumulate sizes of single unattached buckets of unit u:
+        for (size_type bi = 0; bi < u_num_attach_buckets; ++bi) {
+          size_type single_bkt_size = attach_buckets_sizes[
+                                        u * max_unattached_buckets + bi];
+          u_bucket_cumul_sizes.push_back(
+            single_bkt_size + (u_bucket_cumul_sizes.empty()
+                               ? 0
+                               : u_bucket_cumul_sizes.back()));
         }
+        DASH_ASSERT_EQ(u_local_size_new, u_bucket_cumul_sizes.back(),
+                       "local size differs from sum of bucket sizes");
       }
-      // Local memory space of unit shrunk:
-      if (u_local_size_diff < 0 && u_bucket_cumul_sizes.size() > 0) {
-        u_bucket_cumul_sizes.back() += u_local_size_diff;
+      // Null buckets attached by unit u:
+      for (size_type bi = u_num_attach_buckets;
+           bi < max_unattached_buckets; ++bi) {
+        u_bucket_cumul_sizes.push_back(u_bucket_cumul_sizes.empty()
+                                       ? 0
+                                       : u_bucket_cumul_sizes.back());
       }
     }
-    // Detach array of local unattached bucket sizes, implicit barrier:
-    attach_buckets_sizes_allocator.detach(attach_buckets_sizes_gptr);
-    // Implicit barrier in allocator.detach
-    _team->barrier();
 #if DASH_ENABLE_TRACE_LOGGING
-    for (int u = 0; u < _nunits; ++u) {
+    for (size_type u = 0; u < _nunits; ++u) {
       DASH_LOG_TRACE("GlobDynamicMem.update_remote_size",
                      "unit", u,
                      "cumulative bucket sizes:", _bucket_cumul_sizes[u]);
@@ -1303,7 +1480,57 @@ private:
 #endif
     DASH_LOG_TRACE("GlobDynamicMem.update_remote_size >", new_remote_size);
     _remote_size = new_remote_size;
-    return _remote_size;
+    return max_unattached_buckets;
+  }
+
+  /**
+   * Cumulative local sizes of all units (i.e. postfix sum of local sizes in
+   * unit order), used by global iterators to resolve the unit at a global
+   * position in a binary search.
+   * Recomputed after the local sizes of units changed.
+   */
+  const std::vector<size_type> & unit_cumul_sizes() const
+  {
+    if (!_unit_cumul_sizes_valid) {
+      _unit_cumul_sizes.resize(_nunits);
+      size_type cumul_size = 0;
+      for (size_type u = 0; u < _nunits; ++u) {
+        const auto & u_bucket_cumul_sizes = _bucket_cumul_sizes[u];
+        cumul_size += u_bucket_cumul_sizes.empty()
+                      ? 0
+                      : u_bucket_cumul_sizes.back();
+        _unit_cumul_sizes[u] = cumul_size;
+      }
+      _unit_cumul_sizes_valid = true;
+      DASH_LOG_TRACE_VAR("GlobDynamicMem.unit_cumul_sizes",
+                         _unit_cumul_sizes);
+    }
+    return _unit_cumul_sizes;
+  }
+
+  /**
+   * Size word of the local memory space, combining the size of attached
+   * buckets and the epoch of detach operations.
+   */
+  uint64_t local_size_word() const
+  {
+    size_type attached_size = _local_sizes.local[0];
+    for (auto bit = _attach_buckets_first; bit != _buckets.end(); ++bit) {
+      attached_size -= bit->size;
+    }
+    return (static_cast<uint64_t>(_size_epoch) << size_word_epoch_shift) |
+           (static_cast<uint64_t>(attached_size) & size_word_size_mask);
+  }
+
+  /**
+   * Store the size word of the local memory space in global memory so it
+   * can be read by remote units in \c refresh().
+   */
+  void publish_local_size()
+  {
+    _published_sizes.local[0] = local_size_word();
+    DASH_LOG_TRACE_VAR("GlobDynamicMem.publish_local_size",
+                       _published_sizes.local[0]);
   }
 
   /**
@@ -1387,6 +1614,25 @@ private:
   local_sizes_map            _num_detach_buckets;
   /// Total number of elements in attached memory space of remote units.
   size_type                  _remote_size = 0;
+  /// Capacity of the slab allocated for the newest unattached bucket.
+  size_type                  _attach_slab_capacity = 0;
+  /// Number of elements grown since the last commit.
+  size_type                  _attach_epoch_size    = 0;
+  /// Mapping unit id to the unit's size word, see \c local_size_word().
+  size_words_map             _published_sizes;
+  /// Epochs of detach operations of remote units at the last commit.
+  std::vector<size_type>     _remote_epochs;
+  /// Number of detach operations of the local unit.
+  size_type                  _size_epoch           = 0;
+  /// Capacity of the bucket attached in the last call of reserve().
+  size_type                  _reserve_capacity     = 0;
+  /// Whether the last local bucket is the reserved bucket.
+  bool                       _reserve_active       = false;
+  /// Cumulative local sizes of all units, see \c unit_cumul_sizes().
+  mutable std::vector<size_type> _unit_cumul_sizes;
+  /// Whether \c _unit_cumul_sizes is consistent with the cumulative bucket
+  /// sizes of all units.
+  mutable bool               _unit_cumul_sizes_valid = false;
   /// Global iterator referencing start of global memory space.
   global_iterator            _begin;
   /// Global iterator referencing the final position in global memory space.
@@ -0,0 +1,534 @@
+#ifndef DASH__GLOB_READ_CACHE_H__
+#define DASH__GLOB_READ_CACHE_H__
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/Types.h>
+#include <dash/GlobRef.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+
+#include <dash/internal/Logging.h>
+
+#include <unordered_map>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+
+
+namespace dash {
+
+/**
+ * Hit and miss counters of a \c dash::GlobReadCache instance.
+ */
+struct GlobReadCacheStats
+{
+  /// Number of reads served from a cached line.
+  size_t hits          = 0;
+  /// Number of reads that required fetching a line from global memory.
+  size_t misses        = 0;
+  /// Number of lines evicted to make room for a new line.
+  size_t evictions     = 0;
+  /// Number of completed epochs, i.e. cache invalidations.
+  size_t epochs        = 0;
+  /// Number of bytes fetched from global memory.
+  size_t bytes_fetched = 0;
+
+  /**
+   * Ratio of cache hits to total number of cached reads.
+   */
+  inline double hit_rate() const noexcept
+  {
+    return (hits + misses == 0)
+           ? 0.0
+           : static_cast<double>(hits) / (hits + misses);
+  }
+};
+
+inline std::ostream & operator<<(
+  std::ostream             & os,
+  const GlobReadCacheStats & stats)
+{
+  std::ostringstream ss;
+  ss << "dash::GlobReadCacheStats("
+     << "hits:"      << stats.hits          << ", "
+     << "misses:"    << stats.misses        << ", "
+     << "evictions:" << stats.evictions     << ", "
+     << "epochs:"    << stats.epochs        << ", "
+     << "bytes:"     << stats.bytes_fetched << ", "
+     << "hit rate:"  << stats.hit_rate()    << ")";
+  return operator<<(os, ss.str());
+}
+
+/**
+ * Software-managed cache for read access to remote elements in global
+ * memory.
+ *
+ * Remote reads are served at the granularity of cache lines: on a miss,
+ * the complete line containing the requested element is fetched with a
+ * single \c dart_get_blocking and subsequent reads of elements in the same
+ * line are served from local memory.
+ * Lines are identified by segment id, unit id and line offset of the
+ * element's global address.
+ *
+ * The cache does not maintain coherence. Cached values are valid within
+ * an epoch which has to be closed by the user whenever remote elements
+ * may have been modified, typically after a barrier or flush:
+ *
+ * \code
+ *   dash::GlobReadCache<int> cache(array.lcapacity());
+ *   for (auto gi : indices) {
+ *     sum += cache.get(array[gi]);
+ *   }
+ *   array.barrier();
+ *   // Elements might have been modified, discard cached lines:
+ *   cache.invalidate();
+ * \endcode
+ *
+ * \see  dash::cached
+ */
+template<typename ElementType>
+class GlobReadCache
+{
+private:
+  typedef GlobReadCache<ElementType>
+    self_t;
+
+public:
+  typedef ElementType                                         value_type;
+  typedef size_t                                               size_type;
+  typedef GlobReadCacheStats                                  stats_type;
+
+private:
+  /**
+   * Identifies a cache line in the global address space.
+   */
+  struct line_key_t
+  {
+    dart_unit_t unit;
+    int16_t     segid;
+    uint64_t    line;
+
+    inline bool operator==(const line_key_t & other) const noexcept
+    {
+      return line  == other.line  &&
+             unit  == other.unit  &&
+             segid == other.segid;
+    }
+  };
+
+  struct line_key_hash
+  {
+    inline size_t operator()(const line_key_t & key) const noexcept
+    {
+      uint64_t h = key.line;
+      h ^= (static_cast<uint64_t>(key.unit)    << 40) ^
+           (static_cast<uint64_t>(key.segid)   << 24);
+      h *= 0x9E3779B97F4A7C15ull;
+      return static_cast<size_t>(h ^ (h >> 32));
+    }
+  };
+
+  /**
+   * Meta data of a cache slot.
+   */
+  struct slot_t
+  {
+    line_key_t key;
+    /// Number of valid elements in the slot's line.
+    size_type  nelem;
+    /// Epoch in which the line has been fetched.
+    size_type  epoch;
+    bool       used;
+  };
+
+  typedef std::unordered_map<line_key_t, size_type, line_key_hash>
+    line_map_t;
+
+public:
+  /**
+   * Constructor, creates a cache for elements in global memory with
+   * identical local capacity at every unit.
+   */
+  GlobReadCache(
+    /// Number of elements allocated in global memory at every unit,
+    /// lines are never fetched beyond this bound.
+    size_type local_capacity,
+    /// Number of elements in a cache line.
+    size_type line_nelem = 64,
+    /// Maximum number of cached lines.
+    size_type max_lines  = 1024)
+  : _lcapacity(local_capacity),
+    _line_nelem(std::max<size_type>(line_nelem, 1)),
+    _max_lines(std::max<size_type>(max_lines, 1)),
+    _data(_line_nelem * _max_lines),
+    _slots(_max_lines)
+  {
+    DASH_LOG_TRACE("GlobReadCache(lcap,line,lines)",
+                   "local capacity:", _lcapacity,
+                   "line size:",      _line_nelem,
+                   "max. lines:",     _max_lines);
+    for (auto & slot : _slots) {
+      slot.used = false;
+    }
+    _lines.reserve(_max_lines);
+  }
+
+  GlobReadCache(const self_t & other)        = delete;
+  GlobReadCache(self_t && other)             = default;
+  self_t & operator=(const self_t & other)   = delete;
+  self_t & operator=(self_t && other)        = default;
+
+  /**
+   * Read the element referenced by the given global pointer.
+   * Fetches the element's cache line from global memory on a miss.
+   */
+  value_type get(dart_gptr_t gptr)
+  {
+    value_type value;
+    get(&value, gptr);
+    return value;
+  }
+
+  /**
+   * Read the element referenced by the given global reference.
+   */
+  inline value_type get(const GlobRef<value_type> & gref)
+  {
+    return get(gref.dart_gptr());
+  }
+
+  /**
+   * Read the element referenced by the given global pointer into the
+   * given local address.
+   */
+  void get(value_type * out, dart_gptr_t gptr)
+  {
+    DASH_ASSERT_MSG(gptr.addr_or_offs.offset % sizeof(value_type) == 0,
+                    "Global address is not aligned to element size");
+    uint64_t   elem_offs = gptr.addr_or_offs.offset / sizeof(value_type);
+    line_key_t key { gptr.unitid,
+                     gptr.segid,
+                     elem_offs / _line_nelem };
+    size_type  l_offs    = elem_offs % _line_nelem;
+
+    auto line_it = _lines.find(key);
+    if (line_it != _lines.end() &&
+        _slots[line_it->second].epoch == _epoch) {
+      ++_stats.hits;
+      std::memcpy(out,
+                  slot_begin(line_it->second) + l_offs,
+                  sizeof(value_type));
+      return;
+    }
+    ++_stats.misses;
+    size_type slot = (line_it != _lines.end())
+                     ? line_it->second
+                     : acquire_slot(key);
+    fetch_line(slot, gptr, key.line);
+    std::memcpy(out, slot_begin(slot) + l_offs, sizeof(value_type));
+  }
+
+  /**
+   * Close the current epoch, lines cached in previous epochs are not
+   * used for subsequent reads.
+   *
+   * Must be called whenever cached remote elements might have been
+   * modified, e.g. after a barrier or flush on the underlying global
+   * memory.
+   */
+  void invalidate()
+  {
+    DASH_LOG_TRACE_VAR("GlobReadCache.invalidate()", _epoch);
+    ++_epoch;
+    ++_stats.epochs;
+  }
+
+  /**
+   * Remove all lines from the cache and release their slots.
+   */
+  void clear()
+  {
+    invalidate();
+    _lines.clear();
+    for (auto & slot : _slots) {
+      slot.used = false;
+    }
+    _next_slot = 0;
+  }
+
+  /**
+   * The current epoch of the cache.
+   */
+  inline size_type epoch() const noexcept
+  {
+    return _epoch;
+  }
+
+  /**
+   * Hit and miss counters since construction or the last call of
+   * \c reset_stats.
+   */
+  inline const stats_type & stats() const noexcept
+  {
+    return _stats;
+  }
+
+  /**
+   * Reset hit and miss counters.
+   */
+  inline void reset_stats() noexcept
+  {
+    _stats = stats_type();
+  }
+
+  /**
+   * Number of elements in a cache line.
+   */
+  inline size_type line_size() const noexcept
+  {
+    return _line_nelem;
+  }
+
+  /**
+   * Maximum number of lines held in the cache.
+   */
+  inline size_type capacity() const noexcept
+  {
+    return _max_lines;
+  }
+
+private:
+  inline value_type * slot_begin(size_type slot)
+  {
+    return _data.data() + (slot * _line_nelem);
+  }
+
+  /**
+   * Resolve a free slot for the line with the given key, evicting lines
+   * in FIFO order if all slots are in use.
+   */
+  size_type acquire_slot(const line_key_t & key)
+  {
+    size_type slot = _next_slot;
+    _next_slot     = (_next_slot + 1) % _max_lines;
+    if (_slots[slot].used) {
+      _lines.erase(_slots[slot].key);
+      ++_stats.evictions;
+    }
+    _slots[slot].key  = key;
+    _slots[slot].used = true;
+    _lines[key]       = slot;
+    return slot;
+  }
+
+  void fetch_line(size_type slot, dart_gptr_t gptr, uint64_t line)
+  {
+    uint64_t  line_begin = line * _line_nelem;
+    size_type nelem      = _line_nelem;
+    DASH_ASSERT_LT(line_begin, _lcapacity,
+                   "Global address exceeds local capacity");
+    if (line_begin + nelem > _lcapacity) {
+      // Final line in the unit's local memory is underfilled:
+      nelem = _lcapacity - line_begin;
+    }
+    DASH_LOG_TRACE("GlobReadCache.fetch_line",
+                   "unit:",  gptr.unitid,
+                   "line:",  line,
+                   "nelem:", nelem);
+    gptr.addr_or_offs.offset = line_begin * sizeof(value_type);
+    dart_storage_t ds = dash::dart_storage<value_type>(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_get_blocking(slot_begin(slot), gptr, ds.nelem, ds.dtype),
+      DART_OK);
+    _slots[slot].nelem  = nelem;
+    _slots[slot].epoch  = _epoch;
+    _stats.bytes_fetched += nelem * sizeof(value_type);
+  }
+
+private:
+  /// Number of elements in global memory at every unit.
+  size_type               _lcapacity;
+  /// Number of elements in a cache line.
+  size_type               _line_nelem;
+  /// Maximum number of cached lines.
+  size_type               _max_lines;
+  /// Storage of cached lines.
+  std::vector<value_type> _data;
+  /// Meta data of cache slots.
+  std::vector<slot_t>     _slots;
+  /// Mapping of line keys to cache slots.
+  line_map_t              _lines;
+  /// Next slot to use in FIFO replacement.
+  size_type               _next_slot = 0;
+  /// Current epoch, incremented on every invalidation.
+  size_type               _epoch     = 0;
+  /// Hit and miss counters.
+  stats_type              _stats;
+};
+
+/**
+ * Proxy type providing cached read access to elements of a DASH
+ * container.
+ *
+ * Reads of local elements are resolved to native pointers, reads of
+ * remote elements are served by a \c dash::GlobReadCache.
+ * The cache is invalidated by \c barrier, \c flush and \c invalidate.
+ *
+ * \see  dash::cached
+ */
+template<class ContainerType>
+class CachedView
+{
+private:
+  typedef CachedView<ContainerType>
+    self_t;
+
+public:
+  typedef typename ContainerType::value_type                  value_type;
+  typedef typename ContainerType::index_type                  index_type;
+  typedef typename ContainerType::size_type                    size_type;
+  typedef typename ContainerType::pattern_type              pattern_type;
+  typedef GlobReadCache<value_type>                           cache_type;
+  typedef typename cache_type::stats_type                     stats_type;
+
+public:
+  /**
+   * Constructor, creates a cached view on the given container.
+   */
+  CachedView(
+    ContainerType & container,
+    /// Number of elements in a cache line.
+    size_type       line_nelem = 64,
+    /// Maximum number of cached lines.
+    size_type       max_lines  = 1024)
+  : _container(&container),
+    _cache(container.lcapacity(), line_nelem, max_lines),
+    _myid(container.pattern().team().myid())
+  { }
+
+  CachedView(self_t && other)                = default;
+
+  /**
+   * Read the element at the given global index.
+   */
+  value_type operator[](index_type global_index)
+  {
+    auto lpos = _container->pattern().local(global_index);
+    if (lpos.unit == _myid) {
+      return _container->lbegin()[lpos.index];
+    }
+    return _cache.get(
+             _container->begin().globmem().at(
+               team_unit_t(lpos.unit), lpos.index).dart_gptr());
+  }
+
+  /**
+   * Read the element referenced by the given global iterator.
+   */
+  template<class GlobIterType>
+  value_type get(const GlobIterType & git)
+  {
+    return operator[](git.gpos());
+  }
+
+  /**
+   * Read the element referenced by the given global reference.
+   */
+  value_type get(const GlobRef<value_type> & gref)
+  {
+    if (gref.is_local()) {
+      return static_cast<value_type>(gref);
+    }
+    return _cache.get(gref);
+  }
+
+  /**
+   * Barrier on the container's team, closes the cache's current epoch.
+   */
+  void barrier()
+  {
+    _container->barrier();
+    _cache.invalidate();
+  }
+
+  /**
+   * Complete outstanding operations on the container's global memory,
+   * closes the cache's current epoch.
+   */
+  void flush()
+  {
+    _container->begin().globmem().flush_all();
+    _cache.invalidate();
+  }
+
+  /**
+   * Close the cache's current epoch without synchronization.
+   */
+  inline void invalidate()
+  {
+    _cache.invalidate();
+  }
+
+  inline size_type size() const noexcept
+  {
+    return _container->size();
+  }
+
+  inline const stats_type & stats() const noexcept
+  {
+    return _cache.stats();
+  }
+
+  inline cache_type & cache() noexcept
+  {
+    return _cache;
+  }
+
+  inline ContainerType & container() noexcept
+  {
+    return *_container;
+  }
+
+private:
+  ContainerType * _container;
+  cache_type      _cache;
+  team_unit_t     _myid;
+};
+
+/**
+ * Create a view providing cached read access to elements in the given
+ * container.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Array<int> adj(nelem);
+ *   auto cadj = dash::cached(adj);
+ *   for (auto i : neighbors) {
+ *     // Remote reads fetch complete cache lines:
+ *     total += cadj[i];
+ *   }
+ *   std::cout << cadj.stats() << std::endl;
+ *   // Barrier invalidates cached lines:
+ *   cadj.barrier();
+ * \endcode
+ *
+ * \see  dash::GlobReadCache
+ */
+template<class ContainerType>
+CachedView<ContainerType> cached(
+  ContainerType & container,
+  /// Number of elements in a cache line.
+  size_t          line_nelem = 64,
+  /// Maximum number of cached lines.
+  size_t          max_lines  = 1024)
+{
+  return CachedView<ContainerType>(container, line_nelem, max_lines);
+}
+
+} // namespace dash
+
+#endif // DASH__GLOB_READ_CACHE_H__
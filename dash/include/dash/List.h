@@ -6,8 +6,12 @@
 #include <dash/Team.h>
 #include <dash/Exception.h>
 #include <dash/GlobDynamicMem.h>
+#include <dash/GlobMem.h>
 #include <dash/Allocator.h>
 #include <dash/Array.h>
+#include <dash/Atomic.h>
+
+#include <dash/dart/if/dart_communication.h>
 
 #include <dash/list/ListRef.h>
 #include <dash/list/LocalListRef.h>
@@ -17,6 +21,8 @@
 #include <iterator>
 #include <limits>
 #include <vector>
+#include <algorithm>
+#include <cstddef>
 
 namespace dash {
 
@@ -329,9 +335,14 @@ public:
    * As one-sided, non-collective allocation on remote units is not possible
    * with most DART communication backends, the new list element is allocated
    * locally and moved to its final position in global memory in \c barrier.
+   * Elements pushed by different units are ordered by tickets drawn from
+   * an atomic counter.
    */
-  void push_back(const value_type & element)
+  void push_back(const value_type & value)
   {
+    size_type ticket = _counter(counter_back).fetch_and_add(1);
+    DASH_LOG_TRACE("List.push_back()", "ticket:", ticket);
+    _staged_back.push_back(staged_node { ticket, value });
   }
 
   /**
@@ -340,6 +351,24 @@ public:
    */
   void pop_back()
   {
+    value_type value;
+    pop_back(value);
+  }
+
+  /**
+   * Removes the last element in the list and copies its value, reducing
+   * the container size by one.
+   *
+   * Elements are claimed in an atomic operation, concurrent pops of
+   * different units never remove the same element. Only elements
+   * published in the last \c barrier can be removed, memory of removed
+   * elements is released in the next \c barrier.
+   *
+   * \return  false if the list contains no element to remove
+   */
+  bool pop_back(value_type & value)
+  {
+    return _pop(false, value);
   }
 
   /**
@@ -347,6 +376,12 @@ public:
    */
   reference back()
   {
+    auto pops = _pop_counts(_counter(counter_pop).fetch_and_add(0));
+    if (pops.first + pops.second >= _committed_size) {
+      DASH_THROW(dash::exception::OutOfRange,
+                 "List.back(): list is empty");
+    }
+    return reference(_value_gptr(_committed_size - 1 - pops.second));
   }
 
   /**
@@ -364,6 +399,9 @@ public:
    */
   void push_front(const value_type & value)
   {
+    size_type ticket = _counter(counter_front).fetch_and_add(1);
+    DASH_LOG_TRACE("List.push_front()", "ticket:", ticket);
+    _staged_front.push_back(staged_node { ticket, value });
   }
 
   /**
@@ -372,6 +410,21 @@ public:
    */
   void pop_front()
   {
+    value_type value;
+    pop_front(value);
+  }
+
+  /**
+   * Removes the first element in the list and copies its value, reducing
+   * the container size by one.
+   *
+   * \return  false if the list contains no element to remove
+   *
+   * \see pop_back
+   */
+  bool pop_front(value_type & value)
+  {
+    return _pop(true, value);
   }
 
   /**
@@ -379,6 +432,12 @@ public:
    */
   reference front()
   {
+    auto pops = _pop_counts(_counter(counter_pop).fetch_and_add(0));
+    if (pops.first + pops.second >= _committed_size) {
+      DASH_THROW(dash::exception::OutOfRange,
+                 "List.front(): list is empty");
+    }
+    return reference(_value_gptr(pops.first));
   }
 
   /**
@@ -462,7 +521,9 @@ public:
    */
   inline size_type size() const noexcept
   {
-    return _remote_size + _local_sizes.local[0];
+    return _remote_size + _local_sizes.local[0]
+           + _staged_front.size() + _staged_back.size()
+           - _pops_front - _pops_back;
   }
 
   /**
@@ -557,23 +618,104 @@ public:
   /**
    * Establish a barrier for all units operating on the list, publishing all
    * changes to all units.
+   *
+   * Every unit removes its popped elements and compacts its remaining
+   * elements, the first unit receives the elements pushed at the front
+   * and the last unit the elements pushed at the back of the list in
+   * one-sided puts. Local nodes are relinked in list order.
    */
   void barrier()
   {
     DASH_LOG_TRACE_VAR("List.barrier()", _team);
-    // Apply changes in local memory spaces to global memory space:
-    if (_globmem != nullptr) {
-      _globmem->commit();
+    if (_globmem == nullptr) {
+      return;
+    }
+    size_type nunits = _team->size();
+    // Wait for pushes and pops of all units:
+    _team->barrier();
+    size_type l_counts[ncounts] = {
+                _local_sizes.local[0],
+                _staged_front.size(),
+                _staged_back.size(),
+                _pops_front,
+                _pops_back
+              };
+    std::vector<size_type> g_counts(ncounts * nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        l_counts,
+        g_counts.data(),
+        sizeof(l_counts),
+        DART_TYPE_BYTE,
+        _team->dart_id()),
+      DART_OK);
+    size_type g_totals[ncounts] = { 0, 0, 0, 0, 0 };
+    for (size_type u = 0; u < nunits; ++u) {
+      for (int c = 0; c < ncounts; ++c) {
+        g_totals[c] += g_counts[u * ncounts + c];
+      }
     }
+    if (_myid.id == 0) {
+      // Tickets and pops of the next epoch start at 0, counters are not
+      // accessed by other units until the final barrier:
+      std::fill(_counters->lbegin(), _counters->lend(), 0);
+    }
+    // Ranges of local elements remaining at every unit, committed elements
+    // are removed from the front and the back of the list by pops:
+    std::vector<size_type> new_sizes(nunits);
+    std::vector<size_type> kept_begin(nunits);
+    std::vector<size_type> kept_end(nunits);
+    std::vector<size_type> committed(nunits);
+    size_type pop_end = _committed_size - g_totals[count_pop_back];
+    for (size_type u = 0; u < nunits; ++u) {
+      size_type l_size    = g_counts[u * ncounts + count_local];
+      size_type c_begin   = (u > 0) ? _local_cumul_sizes[u-1] : 0;
+      committed[u]        = std::min(_local_cumul_sizes[u] - c_begin,
+                                     l_size);
+      size_type c_end     = c_begin + committed[u];
+      size_type rm_front  = std::min(
+                              committed[u],
+                              g_totals[count_pop_front] > c_begin
+                              ? g_totals[count_pop_front] - c_begin
+                              : 0);
+      size_type rm_back   = std::min(
+                              committed[u] - rm_front,
+                              c_end > pop_end ? c_end - pop_end : 0);
+      kept_begin[u] = rm_front;
+      kept_end[u]   = committed[u] - rm_back;
+      new_sizes[u]  = l_size - rm_front - rm_back;
+    }
+    new_sizes.front() += g_totals[count_staged_front];
+    // Offset of the first element pushed at the back in the last unit:
+    size_type back_offset = new_sizes.back();
+    new_sizes.back()  += g_totals[count_staged_back];
+    size_type front_in = (_myid.id == 0) ? g_totals[count_staged_front] : 0;
+    _compact_local(kept_begin[_myid], kept_end[_myid], committed[_myid],
+                   front_in, new_sizes[_myid]);
+    // Attach memory acquired for received elements:
+    _globmem->commit();
+    _flush_staged(g_totals[count_staged_front], back_offset);
+    _team->barrier();
+    _link_local(new_sizes);
+    _local_sizes.local[0] = new_sizes[_myid];
+    _lbegin               = _globmem->lbegin();
+    _lend                 = _lbegin + new_sizes[_myid];
+    _pops_front           = 0;
+    _pops_back            = 0;
     // Accumulate local sizes of remote units:
     _remote_size = 0;
-    for (int u = 0; u < _team->size(); ++u) {
-      if (u != _myid) {
-        size_type local_size_u  = _local_sizes[u];
-        _remote_size           += local_size_u;
+    for (size_type u = 0; u < nunits; ++u) {
+      if (u != static_cast<size_type>(_myid.id)) {
+        _remote_size += new_sizes[u];
+      }
+      _local_cumul_sizes[u] = new_sizes[u];
+      if (u > 0) {
+        _local_cumul_sizes[u] += _local_cumul_sizes[u-1];
       }
     }
-    DASH_LOG_TRACE("List.barrier()", "passed barrier");
+    _committed_size = _local_cumul_sizes.back();
+    DASH_LOG_TRACE("List.barrier()", "passed barrier",
+                   "size:", _committed_size);
   }
 
   /**
@@ -612,6 +754,10 @@ public:
     DASH_LOG_TRACE_VAR("List.allocate", lcap);
 
     _globmem     = new glob_mem_type(lcap, *_team);
+    _counters    = new dash::GlobMem<size_type>(ncounters, *_team);
+    std::fill(_counters->lbegin(), _counters->lend(), 0);
+    _local_cumul_sizes.assign(_team->size(), 0);
+    _committed_size = 0;
     // Global iterators:
     _begin       = iterator(_globmem, _nil_node);
     _end         = _begin;
@@ -661,11 +807,244 @@ public:
       delete _globmem;
       _globmem = nullptr;
     }
+    if (_counters != nullptr) {
+      delete _counters;
+      _counters = nullptr;
+    }
+    _staged_front.clear();
+    _staged_back.clear();
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
+    _committed_size       = 0;
     DASH_LOG_TRACE_VAR("List.deallocate >", this);
   }
 
+private:
+  /**
+   * Element pushed at the front or back of the list since the last
+   * barrier.
+   */
+  struct staged_node
+  {
+    /// Position of the element among all elements pushed at the same end.
+    size_type  ticket;
+    value_type value;
+  };
+
+  /// Counters at unit 0: tickets of elements pushed at the back and the
+  /// front, and pops at the front (lower half) and back (upper half).
+  enum counter_id : int {
+    counter_back = 0,
+    counter_front,
+    counter_pop,
+    ncounters
+  };
+
+  /// Counts of every unit exchanged in \c barrier.
+  enum count_id : int {
+    count_local = 0,
+    count_staged_front,
+    count_staged_back,
+    count_pop_front,
+    count_pop_back,
+    ncounts
+  };
+
+  /**
+   * Atomic counter at unit 0.
+   */
+  dash::Atomic<size_type> _counter(counter_id counter)
+  {
+    return dash::Atomic<size_type>(
+             _counters->at(team_unit_t(0), counter).dart_gptr(), *_team);
+  }
+
+  /**
+   * Number of pops at the front and back of the list in a value of the
+   * pop counter.
+   */
+  static std::pair<size_type, size_type> _pop_counts(size_type pops)
+  {
+    return std::make_pair(pops & 0xffffffff, pops >> 32);
+  }
+
+  /**
+   * Claims the first or last element not removed by any unit in an atomic
+   * increment of the pop counter and reads its value.
+   */
+  bool _pop(bool front, value_type & value)
+  {
+    size_type inc  = front ? 1 : (size_type(1) << 32);
+    auto      pops = _pop_counts(_counter(counter_pop).fetch_and_add(inc));
+    if (pops.first + pops.second >= _committed_size) {
+      DASH_LOG_TRACE("List._pop", "list is empty");
+      return false;
+    }
+    size_type index = front ? pops.first
+                            : _committed_size - 1 - pops.second;
+    dart_storage_t ds = dash::dart_storage<value_type>(1);
+    DASH_ASSERT_RETURNS(
+      dart_get_blocking(
+        &value,
+        _value_gptr(index),
+        ds.nelem,
+        ds.dtype),
+      DART_OK);
+    if (front) {
+      ++_pops_front;
+    } else {
+      ++_pops_back;
+    }
+    DASH_LOG_TRACE("List._pop", "index:", index);
+    return true;
+  }
+
+  /**
+   * Global pointer to the value of the element at the specified index in
+   * the list published in the last barrier.
+   */
+  dart_gptr_t _value_gptr(size_type index)
+  {
+    auto unit_it = std::upper_bound(_local_cumul_sizes.begin(),
+                                    _local_cumul_sizes.end(),
+                                    index);
+    team_unit_t unit(std::distance(_local_cumul_sizes.begin(), unit_it));
+    size_type   lidx = index - ((unit > 0) ? _local_cumul_sizes[unit-1]
+                                           : 0);
+    dart_gptr_t gptr = _globmem->at(unit, lidx).dart_gptr();
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr, offsetof(node_type, value)),
+      DART_OK);
+    return gptr;
+  }
+
+  /**
+   * Native pointer to the local node at the specified offset.
+   */
+  node_type * _lnode(size_type lidx)
+  {
+    return static_cast<node_type *>(_globmem->lbegin() + lidx);
+  }
+
+  /**
+   * Moves the local elements that are not removed to the beginning of
+   * local memory, preceded by \c front_in slots for elements received
+   * from other units, and acquires memory for the new local size.
+   * Of the \c committed local elements published in the last barrier,
+   * elements in \c [kept_begin, kept_end) are kept, elements after them
+   * have been added locally and are kept.
+   */
+  void _compact_local(
+    size_type kept_begin,
+    size_type kept_end,
+    size_type committed,
+    size_type front_in,
+    size_type new_size)
+  {
+    size_type              l_size  = _local_sizes.local[0];
+    bool                   shifted = kept_begin != front_in ||
+                                     kept_end   != committed;
+    std::vector<node_type> kept;
+    if (shifted) {
+      kept.reserve(l_size);
+      for (size_type lidx = kept_begin; lidx < l_size; ++lidx) {
+        if (lidx < kept_end || lidx >= committed) {
+          kept.push_back(*_lnode(lidx));
+        }
+      }
+    }
+    if (new_size > _globmem->local_size()) {
+      DASH_LOG_TRACE("List._compact_local",
+                     "globmem.grow(", new_size - _globmem->local_size(), ")");
+      _globmem->grow(new_size - _globmem->local_size());
+    }
+    for (size_type k = 0; k < kept.size(); ++k) {
+      *_lnode(front_in + k) = kept[k];
+    }
+    DASH_LOG_TRACE("List._compact_local", "shifted:", kept.size(),
+                   "new size:", new_size);
+  }
+
+  /**
+   * Writes the elements pushed at the front of the list by the active
+   * unit to the first unit and the elements pushed at the back to the
+   * last unit, following the element at \c back_offset.
+   */
+  void _flush_staged(
+    size_type nfront,
+    size_type back_offset)
+  {
+    team_unit_t    last_unit(_team->size() - 1);
+    dart_gptr_t    gptr_last = DART_GPTR_NULL;
+    dart_storage_t ds        = dash::dart_storage<value_type>(1);
+    for (const auto & staged : _staged_front) {
+      gptr_last = _globmem->at(team_unit_t(0), nfront - 1 - staged.ticket)
+                           .dart_gptr();
+      DASH_ASSERT_RETURNS(
+        dart_gptr_incaddr(&gptr_last, offsetof(node_type, value)),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_put(gptr_last, &staged.value, ds.nelem, ds.dtype),
+        DART_OK);
+    }
+    for (const auto & staged : _staged_back) {
+      gptr_last = _globmem->at(last_unit, back_offset + staged.ticket)
+                           .dart_gptr();
+      DASH_ASSERT_RETURNS(
+        dart_gptr_incaddr(&gptr_last, offsetof(node_type, value)),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_put(gptr_last, &staged.value, ds.nelem, ds.dtype),
+        DART_OK);
+    }
+    if (!DART_GPTR_ISNULL(gptr_last)) {
+      DASH_ASSERT_RETURNS(
+        dart_flush_all(gptr_last),
+        DART_OK);
+    }
+    DASH_LOG_TRACE("List._flush_staged",
+                   "front:", _staged_front.size(),
+                   "back:",  _staged_back.size());
+    _staged_front.clear();
+    _staged_back.clear();
+  }
+
+  /**
+   * Links the local nodes in the order of local memory by native pointers.
+   * The first and last local node are linked to the last node of the
+   * preceding and the first node of the succeeding non-empty unit by
+   * global pointers.
+   */
+  void _link_local(
+    const std::vector<size_type> & new_sizes)
+  {
+    size_type l_size = new_sizes[_myid];
+    for (size_type lidx = 0; lidx < l_size; ++lidx) {
+      node_type * node = _lnode(lidx);
+      node->lprev = (lidx > 0)          ? _lnode(lidx - 1) : nullptr;
+      node->lnext = (lidx + 1 < l_size) ? _lnode(lidx + 1) : nullptr;
+      node->gprev = DART_GPTR_NULL;
+      node->gnext = DART_GPTR_NULL;
+    }
+    if (l_size == 0) {
+      return;
+    }
+    for (int u = _myid.id - 1; u >= 0; --u) {
+      if (new_sizes[u] > 0) {
+        _lnode(0)->gprev = _globmem->at(team_unit_t(u), new_sizes[u] - 1)
+                                   .dart_gptr();
+        break;
+      }
+    }
+    for (size_type u = _myid.id + 1; u < new_sizes.size(); ++u) {
+      if (new_sizes[u] > 0) {
+        _lnode(l_size - 1)->gnext = _globmem->at(team_unit_t(u), 0)
+                                            .dart_gptr();
+        break;
+      }
+    }
+  }
+
 private:
   /// Team containing all units interacting with the list.
   dash::Team         * _team
@@ -690,6 +1069,29 @@ private:
   node_type            _nil_node;
   /// Mapping units to their number of local list elements.
   local_sizes_map      _local_sizes;
+  /// Cumulative (postfix sum) local sizes of all units published in the
+  /// last barrier.
+  std::vector<size_type> _local_cumul_sizes;
+  /// Number of elements in the list published in the last barrier.
+  size_type            _committed_size
+                         = 0;
+  /// Atomic counters of pushes and pops at unit 0, see \c counter_id.
+  dash::GlobMem<size_type> * _counters
+                         = nullptr;
+  /// Elements pushed at the front by the active unit since the last
+  /// barrier.
+  std::vector<staged_node> _staged_front;
+  /// Elements pushed at the back by the active unit since the last
+  /// barrier.
+  std::vector<staged_node> _staged_back;
+  /// Number of elements popped at the front by the active unit since the
+  /// last barrier.
+  size_type            _pops_front
+                         = 0;
+  /// Number of elements popped at the back by the active unit since the
+  /// last barrier.
+  size_type            _pops_back
+                         = 0;
   /// Capacity of local buffer containing locally added node elements that
   /// have not been committed to global memory yet.
   /// Default is 4 KB.
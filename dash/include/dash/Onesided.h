@@ -5,6 +5,8 @@
 #include <dash/GlobPtr.h>
 #include <dash/Team.h>
 
+#include <vector>
+
 namespace dash {
 
 /**
@@ -120,6 +122,27 @@ void get_value(
     DART_OK);
 }
 
+namespace internal {
+
+/**
+ * Tests pending transfers referenced by DART handles for local completion
+ * without blocking.
+ */
+inline bool test_local_completion(
+  std::vector<dart_handle_t> & handles)
+{
+  if (handles.empty()) {
+    return true;
+  }
+  int32_t completed = 0;
+  DASH_ASSERT_RETURNS(
+    dart_testall_local(&handles[0], handles.size(), &completed),
+    DART_OK);
+  return completed != 0;
+}
+
+} // namespace internal
+
 } // namespace dash
 
 #endif // DASH__ONESIDED_H__
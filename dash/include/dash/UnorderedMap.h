@@ -113,14 +113,19 @@ namespace dash {
  * Usage examples:
  *
  * \code
- * // map of int (key type) to double (value type):
+ * // map of int (key type) to double (value type), keys are distributed
+ * // to units by dash::HashDistributed:
  * dash::UnorderedMap<int, double> map;
  *
  * int myid = static_cast<int>(dash::myid());
  *
- * map.insert(std::make_pair(myid, 12.3);
+ * // inserted at unit map.bucket(myid):
+ * map.insert(std::make_pair(myid, 12.3));
  *
- * map.local.insert(std::make_pair(100 * myid, 12.3);
+ * // map of elements stored at the inserting unit:
+ * dash::UnorderedMap<int, double, dash::HashLocal<int>> lmap;
+ *
+ * lmap.local.insert(std::make_pair(100 * myid, 12.3));
  * \endcode
  */
 
@@ -132,7 +137,7 @@ namespace dash {
 template<
   typename Key,
   typename Mapped,
-  typename Hash    = dash::HashLocal<Key>,
+  typename Hash    = dash::HashDistributed<Key>,
   typename Pred    = std::equal_to<Key>,
   typename Alloc   = dash::allocator::DynamicAllocator<
                        std::pair<const Key, Mapped> > >
@@ -247,6 +252,10 @@ public:
    * Synchronize changes on local and global memory space of the map since
    * initialization or the last call of its \c barrier method with global
    * memory.
+   * Elements inserted at remote units since the last barrier are written
+   * to their target units and added to their indices, remote insertions
+   * exceeding the attached memory of their target unit are written after
+   * the target unit attached additional memory.
    */
   void barrier();
 
@@ -518,6 +527,29 @@ public:
    */
   const_iterator find(const key_type & key) const;
 
+  /**
+   * Finds the elements with keys in the given range and writes iterators
+   * to them, or \c end() for keys not contained in the map, to the range
+   * starting at \c d_first.
+   *
+   * Keys are sent to the units they are mapped to in one exchange, every
+   * unit looks up the keys it received in its local index and returns
+   * the local offsets of the elements in a second exchange.
+   * With \c dash::HashLocal, keys are sent to all units.
+   *
+   * Collective operation.
+   *
+   * \return  Iterator past the last iterator written.
+   */
+  template<class InputIterator, class OutputIterator>
+  OutputIterator find_bulk(
+    /// Iterator at first key to find.
+    InputIterator  first,
+    /// Iterator past the last key to find.
+    InputIterator  last,
+    /// Iterator at first iterator of found elements to write.
+    OutputIterator d_first);
+
   //////////////////////////////////////////////////////////////////////////
   // Modifiers
   //////////////////////////////////////////////////////////////////////////
@@ -536,6 +568,17 @@ public:
    * - References to elements in the map container remain valid in all cases,
    *   even after a rehash.
    *
+   * The element is inserted at the unit its key is mapped to by the hash
+   * function. For remote units, a slot in the unit's local elements is
+   * reserved in an atomic operation and the element is written to it in
+   * a one-sided put, or in the next \c barrier() if the slot exceeds the
+   * memory attached at the unit.
+   * Until the next \c barrier(), the element is found by the inserting
+   * unit only, which accesses elements that are written in the barrier in
+   * a local copy.
+   * If elements with equivalent keys are inserted concurrently by
+   * different units, only one of them is found after the next barrier.
+   *
    * \see     \c operator[]
    *
    * \return  pair, with its member pair::first set to an iterator pointing
@@ -571,8 +614,33 @@ public:
     InputIterator last);
 
   /**
-   * Removes and destroys single element referenced by given iterator from
-   * the container, decreasing the container size by 1.
+   * Insert elements in iterator range of key-value pairs, collectively.
+   *
+   * Elements are grouped by the units their keys are mapped to and
+   * exchanged in one round of one-sided puts into a receive buffer
+   * allocated collectively for all units. Every unit then inserts the
+   * elements it received in its local memory and index in a single
+   * allocation. Elements with keys that are already contained in the map
+   * are ignored.
+   *
+   * Collective operation, implies a \c barrier().
+   */
+  template<class InputIterator>
+  void insert_bulk(
+    /// Iterator at first value in the range to insert.
+    InputIterator first,
+    /// Iterator past the last value in the range to insert.
+    InputIterator last);
+
+  /**
+   * Removes single element referenced by given iterator from the
+   * container, decreasing the container size by 1.
+   *
+   * The element is marked as erased in the local memory of its unit and
+   * removed from the unit's index, iterators skip erased elements.
+   * Elements at remote units are erased at their unit in the next
+   * \c barrier(), until then the erasure is only visible to the active
+   * unit. Memory of erased elements is released in \c compact().
    *
    * References and iterators to the erased elements are invalidated.
    * Other iterators and references are not invalidated.
@@ -584,9 +652,8 @@ public:
     const_iterator position);
 
   /**
-   * Removes and destroys elements referenced by the given key from the
-   * container, decreasing the container size by the number of elements
-   * removed.
+   * Removes elements referenced by the given key from the container,
+   * decreasing the container size by the number of elements removed.
    *
    * References and iterators to the erased elements are invalidated.
    * Other iterators and references are not invalidated.
@@ -598,8 +665,8 @@ public:
     const key_type & key);
 
   /**
-   * Removes and destroys elements in the given range from the container,
-   * decreasing the container size by the number of elements removed.
+   * Removes elements in the given range from the container, decreasing
+   * the container size by the number of elements removed.
    *
    * References and iterators to the erased elements are invalidated.
    * Other iterators and references are not invalidated.
@@ -613,6 +680,74 @@ public:
     /// Iterator past the last element to remove.
     const_iterator last);
 
+  /**
+   * Releases the memory of erased elements.
+   *
+   * Applies pending insertions and erasures in a \c barrier(), then every
+   * unit moves its remaining elements to newly allocated global memory
+   * and rebuilds its index.
+   *
+   * Collective operation.
+   *
+   * All iterators and references are invalidated.
+   */
+  void compact();
+
+  //////////////////////////////////////////////////////////////////////////
+  // Asynchronous Operations
+  //////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Registers a function \c fn(mapped_type & value, const mapped_type & arg)
+   * for use in \c async_update.
+   * All units must register their update functions in the same order.
+   *
+   * \return  Handle of the update function.
+   */
+  template<class UpdateFunction>
+  size_type register_update(
+    /// Function updating a mapped value with an argument.
+    UpdateFunction fn);
+
+  /**
+   * Updates the mapped value of the element with the specified key at the
+   * unit owning the key, inserting an element with default-constructed
+   * mapped value if no such element exists.
+   *
+   * The request is sent to the owning unit, which applies the update
+   * function to the element in its local memory and replies with the
+   * updated value. Concurrent updates of an element are serialized at
+   * its owner.
+   *
+   * \return  Future of the updated mapped value.
+   */
+  dash::Future<mapped_type> async_update(
+    /// Key of the element to update.
+    const key_type    & key,
+    /// Handle of the update function returned by \c register_update.
+    size_type           handle,
+    /// Argument of the update function.
+    const mapped_type & arg);
+
+  /**
+   * Reads the mapped value of the element with the specified key at the
+   * unit owning the key.
+   *
+   * \return  Future of the mapped value, \c get() throws
+   *          \c dash::exception::InvalidArgument if the map contains no
+   *          element with the key.
+   */
+  dash::Future<mapped_type> async_get(
+    /// Key of the element to read.
+    const key_type & key);
+
+  /**
+   * Applies asynchronous requests received from remote units.
+   * Requests are also applied while testing or waiting for futures of
+   * asynchronous operations and in \c barrier().
+   */
+  void progress();
+
   //////////////////////////////////////////////////////////////////////////
   // Bucket Interface
   //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,347 @@
+#ifndef DASH__UPDATE_BUFFER_H__INCLUDED
+#define DASH__UPDATE_BUFFER_H__INCLUDED
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/Types.h>
+#include <dash/Init.h>
+#include <dash/Exception.h>
+#include <dash/algorithm/Operation.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <sstream>
+
+
+namespace dash {
+
+/**
+ * Counters of a \c dash::UpdateBuffer instance.
+ */
+struct UpdateBufferStats
+{
+  /// Number of updates passed to the buffer.
+  size_t updates   = 0;
+  /// Number of updates combined with a buffered update of the same element.
+  size_t combined  = 0;
+  /// Number of accumulate operations issued.
+  size_t transfers = 0;
+  /// Number of times a unit's buffer has been sent.
+  size_t flushes   = 0;
+
+  /**
+   * Average number of updates applied per accumulate operation.
+   */
+  inline double aggregation_factor() const noexcept
+  {
+    return (transfers == 0)
+           ? 0.0
+           : static_cast<double>(updates) / transfers;
+  }
+};
+
+inline std::ostream & operator<<(
+  std::ostream            & os,
+  const UpdateBufferStats & stats)
+{
+  std::ostringstream ss;
+  ss << "dash::UpdateBufferStats("
+     << "updates:"     << stats.updates   << ", "
+     << "combined:"    << stats.combined  << ", "
+     << "transfers:"   << stats.transfers << ", "
+     << "flushes:"     << stats.flushes   << ", "
+     << "aggregation:" << stats.aggregation_factor() << ")";
+  return operator<<(os, ss.str());
+}
+
+/**
+ * Aggregates updates of elements in a one-dimensional container that are
+ * combined with the element values using the reduce operation \c op, like
+ * \c dash::Atomic::op.
+ *
+ * Updates are buffered per owning unit. A unit's buffer is sent when it
+ * holds \c capacity updates, when the oldest buffered update is older than
+ * the specified maximum delay, or in \c flush(). Before sending, updates
+ * of the same element are combined locally and consecutive elements are
+ * updated in a single accumulate operation.
+ *
+ * Updates are guaranteed to be applied at their target units only after
+ * \c flush(). Like other DASH objects, an update buffer must not be
+ * shared between threads.
+ *
+ * \code
+ *   dash::UpdateBuffer<dash::Array<int>, dash::plus<int>> histo_updates(
+ *     histo);
+ *   for (auto key : keys) {
+ *     histo_updates.update(key, 1);
+ *   }
+ *   histo_updates.flush();
+ *   histo.barrier();
+ * \endcode
+ */
+template<
+  class ContainerType,
+  class ReduceOpType >
+class UpdateBuffer
+{
+private:
+  typedef UpdateBuffer<ContainerType, ReduceOpType>
+    self_t;
+  typedef std::chrono::steady_clock
+    clock_t;
+
+public:
+  typedef typename ContainerType::value_type                  value_type;
+  typedef typename ContainerType::index_type                  index_type;
+  typedef typename ContainerType::size_type                    size_type;
+  typedef typename ContainerType::pattern_type              pattern_type;
+  typedef UpdateBufferStats                                   stats_type;
+
+  static_assert(
+    pattern_type::ndim() == 1,
+    "dash::UpdateBuffer requires a one-dimensional container");
+  static_assert(
+    dash::dart_datatype<value_type>::value != DART_TYPE_UNDEFINED,
+    "dash::UpdateBuffer cannot accumulate unknown type");
+
+  /// Default number of buffered updates per unit.
+  static const size_type default_capacity = 1024;
+
+private:
+  struct update_t {
+    index_type loffset;
+    value_type value;
+  };
+
+private:
+  ContainerType                       & _container;
+  const pattern_type                  & _pattern;
+  ReduceOpType                          _op;
+  size_type                             _capacity;
+  std::chrono::microseconds             _max_delay;
+  /// Buffered updates of every unit
+  std::vector< std::vector<update_t> >  _buffers;
+  /// Time of the first update in the buffer of every unit
+  std::vector<clock_t::time_point>      _buffer_since;
+  /// Global pointers to the first local element of units, resolved on
+  /// first update of a unit
+  std::vector<dart_gptr_t>              _unit_gptrs;
+  /// Units with sent updates that have not been completed remotely
+  std::vector<team_unit_t>              _unflushed;
+  std::vector<value_type>               _send_buffer;
+  size_type                             _num_buffered = 0;
+  /// Time of the oldest update in any non-empty buffer
+  clock_t::time_point                   _oldest_update;
+  stats_type                            _stats;
+
+public:
+  /**
+   * Creates an update buffer for elements of the given container.
+   *
+   * \param container     Container of the updated elements
+   * \param capacity      Number of buffered updates after which a unit's
+   *                      buffer is sent
+   * \param max_delay_us  Maximum time in microseconds an update is
+   *                      buffered before it is sent, checked on every
+   *                      update. Disabled if 0.
+   * \param op            Reduce operation combining update values and
+   *                      element values
+   */
+  explicit UpdateBuffer(
+    ContainerType & container,
+    size_type       capacity     = default_capacity,
+    long            max_delay_us = 0,
+    ReduceOpType    op           = ReduceOpType())
+  : _container(container),
+    _pattern(container.pattern()),
+    _op(op),
+    _capacity(std::max<size_type>(1, capacity)),
+    _max_delay(max_delay_us),
+    _buffers(container.pattern().team().size()),
+    _buffer_since(container.pattern().team().size()),
+    _unit_gptrs(container.pattern().team().size(), DART_GPTR_NULL)
+  {
+    DASH_LOG_TRACE_VAR("UpdateBuffer()", _capacity);
+    DASH_LOG_TRACE_VAR("UpdateBuffer()", max_delay_us);
+  }
+
+  UpdateBuffer(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Sends remaining updates and waits for their completion, see
+   * \c flush().
+   */
+  ~UpdateBuffer()
+  {
+    if (dash::is_initialized()) {
+      flush();
+    }
+  }
+
+  /**
+   * Combines \c value with the element at the given global index using
+   * the buffer's reduce operation.
+   */
+  void update(index_type g_index, const value_type & value)
+  {
+    auto   l_pos  = _pattern.local(g_index);
+    auto & buffer = _buffers[l_pos.unit];
+    if (buffer.empty() && _max_delay.count() > 0) {
+      _buffer_since[l_pos.unit] = clock_t::now();
+      if (_num_buffered == 0) {
+        _oldest_update = _buffer_since[l_pos.unit];
+      }
+    }
+    buffer.push_back(update_t { l_pos.index, value });
+    ++_num_buffered;
+    ++_stats.updates;
+    if (buffer.size() >= _capacity) {
+      send(team_unit_t(l_pos.unit));
+      if (_max_delay.count() > 0 && _num_buffered > 0) {
+        // The sent buffer might have held the oldest update:
+        update_oldest();
+      }
+    } else if (_max_delay.count() > 0 &&
+               clock_t::now() - _oldest_update >= _max_delay) {
+      DASH_LOG_TRACE("UpdateBuffer.update", "maximum delay exceeded");
+      send_all();
+    }
+  }
+
+  /**
+   * Sends all buffered updates and waits for their completion at the
+   * target units.
+   * Does not synchronize with other units, updates sent by other units
+   * are visible after a subsequent barrier.
+   */
+  void flush()
+  {
+    DASH_LOG_TRACE_VAR("UpdateBuffer.flush()", _num_buffered);
+    send_all();
+    for (auto unit : _unflushed) {
+      DASH_ASSERT_RETURNS(
+        dart_flush(_unit_gptrs[unit]),
+        DART_OK);
+    }
+    _unflushed.clear();
+    DASH_LOG_TRACE("UpdateBuffer.flush >");
+  }
+
+  /**
+   * Number of updates currently held in the buffer.
+   */
+  size_type size() const noexcept
+  {
+    return _num_buffered;
+  }
+
+  size_type capacity() const noexcept
+  {
+    return _capacity;
+  }
+
+  const stats_type & stats() const noexcept
+  {
+    return _stats;
+  }
+
+  void reset_stats() noexcept
+  {
+    _stats = stats_type();
+  }
+
+private:
+  /**
+   * Resolves the time of the oldest update in the non-empty buffers.
+   */
+  void update_oldest()
+  {
+    _oldest_update = clock_t::time_point::max();
+    for (size_type u = 0; u < _buffers.size(); ++u) {
+      if (!_buffers[u].empty()) {
+        _oldest_update = std::min(_oldest_update, _buffer_since[u]);
+      }
+    }
+  }
+
+  void send_all()
+  {
+    for (team_unit_t u{0}; u < _buffers.size(); ++u) {
+      send(u);
+    }
+  }
+
+  /**
+   * Combines buffered updates of a unit and applies runs of consecutive
+   * elements in one accumulate operation each.
+   */
+  void send(team_unit_t unit)
+  {
+    auto & buffer = _buffers[unit];
+    if (buffer.empty()) {
+      return;
+    }
+    DASH_LOG_TRACE("UpdateBuffer.send()", "unit:", unit,
+                   "updates:", buffer.size());
+    if (DART_GPTR_ISNULL(_unit_gptrs[unit])) {
+      _unit_gptrs[unit] = _container.begin().globmem().at(unit, 0)
+                                                       .dart_gptr();
+    }
+    // Stable to combine updates of an element in the order of updates:
+    std::stable_sort(buffer.begin(), buffer.end(),
+                     [](const update_t & a, const update_t & b) {
+                       return a.loffset < b.loffset;
+                     });
+    // Send buffer must not be reallocated while accumulate operations
+    // are pending:
+    _send_buffer.clear();
+    _send_buffer.reserve(buffer.size());
+    auto dart_team = _pattern.team().dart_id();
+    for (auto u = buffer.begin(); u != buffer.end(); ) {
+      auto run_offset = _send_buffer.size();
+      auto run_lbegin = u->loffset;
+      auto run_lend   = u->loffset;
+      for (; u != buffer.end() && u->loffset <= run_lend; ++u) {
+        if (u->loffset == run_lend) {
+          _send_buffer.push_back(u->value);
+          ++run_lend;
+        } else {
+          _send_buffer.back() = _op(_send_buffer.back(), u->value);
+          ++_stats.combined;
+        }
+      }
+      dart_gptr_t gptr = _unit_gptrs[unit];
+      gptr.addr_or_offs.offset += run_lbegin * sizeof(value_type);
+      DASH_ASSERT_RETURNS(
+        dart_accumulate(
+          gptr,
+          _send_buffer.data() + run_offset,
+          _send_buffer.size() - run_offset,
+          dash::dart_datatype<value_type>::value,
+          _op.dart_operation(),
+          dart_team),
+        DART_OK);
+      ++_stats.transfers;
+    }
+    // Local completion allows to reuse the send buffer:
+    DASH_ASSERT_RETURNS(
+      dart_flush_local(_unit_gptrs[unit]),
+      DART_OK);
+    if (std::find(_unflushed.begin(), _unflushed.end(), unit)
+        == _unflushed.end()) {
+      _unflushed.push_back(unit);
+    }
+    _num_buffered -= buffer.size();
+    buffer.clear();
+    ++_stats.flushes;
+  }
+};
+
+} // namespace dash
+
+#endif // DASH__UPDATE_BUFFER_H__INCLUDED
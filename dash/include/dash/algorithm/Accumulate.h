@@ -1,9 +1,11 @@
 #ifndef DASH__ALGORITHM__ACCUMULATE_H__
 #define DASH__ALGORITHM__ACCUMULATE_H__
 
+#include <dash/Execution.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Reduce.h>
 
 namespace dash {
 
@@ -63,9 +65,82 @@ dart_ret_t accumulate_impl(
 } // namespace internal
 
 
+/**
+ * Accumulate values in range \c [first, last) using the given binary
+ * reduce function \c op, executing the local phase in the given
+ * execution policy.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * \see      dash::accumulate
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType>
+accumulate(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  ValueType          init,
+  BinaryOperation    binary_op)
+{
+  typedef typename GlobInputIt::value_type element_t;
+
+  auto & team      = in_first.team();
+  auto index_range = dash::local_range(in_first, in_last);
+  auto l_result    = dash::internal::local_reduce<ValueType>(
+                       policy,
+                       index_range.begin,
+                       index_range.end,
+                       [](const element_t & e) {
+                         return static_cast<ValueType>(e);
+                       },
+                       binary_op);
+  return dash::internal::team_reduce(l_result, init, binary_op, team);
+}
+
 /**
  * Accumulate values in range \c [first, last) as the sum of all values
- * in the range.
+ * in the range, executing the local phase in the given execution policy.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * \see      dash::accumulate
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType>
+accumulate(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  ValueType          init)
+{
+  return dash::accumulate(policy, in_first, in_last, init,
+                          dash::plus<ValueType>());
+}
+
+/**
+ * Accumulate values in range \c [first, last) using the given binary
+ * reduce function \c op.
+ *
+ * Elements are converted to \c ValueType, \c binary_op must be
+ * associative as local results of units are reduced in a tree.
+ * Reduce operations supported by DART like \c dash::plus and
+ * \c std::plus are combined in a single \c dart_allreduce.
+ *
+ * Collective operation, the result is returned at all units.
  *
  * Note: For equivalent of semantics of \c MPI_Accumulate, see
  * \c dash::transform.
@@ -80,40 +155,23 @@ dart_ret_t accumulate_impl(
  */
 template <
   class GlobInputIt,
-  class ValueType >
+  class ValueType,
+  class BinaryOperation >
 ValueType accumulate(
   GlobInputIt     in_first,
   GlobInputIt     in_last,
-  ValueType       init)
+  ValueType       init,
+  BinaryOperation binary_op)
 {
-  typedef typename GlobInputIt::index_type index_t;
-
-  auto & team      = in_first.team();
-  auto myid        = team.myid();
-  auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init);
-  auto result      = 0;
-
-  dash::Array<index_t> l_results(team.size());
-  l_results.local[0] = l_result;
-
-  team.barrier();
-
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result += l_results[i];
-    }
-  }
-  return result;
+  return dash::accumulate(dash::execution::par, in_first, in_last, init,
+                          binary_op);
 }
 
 /**
- * Accumulate values in range \c [first, last) using the given binary
- * reduce function \c op.
+ * Accumulate values in range \c [first, last) as the sum of all values
+ * in the range.
  *
- * Collective operation.
+ * Collective operation, the result is returned at all units.
  *
  * Note: For equivalent of semantics of \c MPI_Accumulate, see
  * \c dash::transform.
@@ -128,35 +186,14 @@ ValueType accumulate(
  */
 template <
   class GlobInputIt,
-  class ValueType,
-  class BinaryOperation >
+  class ValueType >
 ValueType accumulate(
   GlobInputIt     in_first,
   GlobInputIt     in_last,
-  ValueType       init,
-  BinaryOperation binary_op = dash::plus<ValueType>())
+  ValueType       init)
 {
-  typedef typename GlobInputIt::index_type index_t;
-
-  auto & team      = in_first.team();
-  auto myid        = team.myid();
-  auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init, binary_op);
-  auto result      = 0;
-
-  dash::Array<index_t> l_results(team.size());
-  l_results.local[0] = l_result;
-
-  team.barrier();
-
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result = binary_op(result, l_results[i]);
-    }
-  }
-  return result;
+  return dash::accumulate(in_first, in_last, init,
+                          dash::plus<ValueType>());
 }
 
 } // namespace dash
@@ -2,27 +2,38 @@
 #define DASH__ALGORITHM__ALL_OF_H__
 
 #include <dash/iterator/GlobIter.h>
-#include <dash/algorithm/Find.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Reduce.h>
+
+#include <algorithm>
 
 
 namespace dash {
 
 /**
+ * Returns true if the predicate holds for all elements in the range
+ * \c [first, last), or if the range is empty.
+ *
+ * Collective operation, the result is returned at all units.
+ *
  * \ingroup     DashAlgorithms
  */
 template<
   typename ElementType,
   class    PatternType,
-	typename UnaryPredicate>
-GlobIter<ElementType, PatternType> all_of(
+  typename UnaryPredicate >
+bool all_of(
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last,
   /// Predicate applied to the elements in range [first, last)
-  UnaryPredicate p)
+  UnaryPredicate                       p)
 {
-  return find_if_not(first, last, p) == last;
+  auto index_range = dash::local_range(first, last);
+  return dash::internal::team_all(
+           std::all_of(index_range.begin, index_range.end, p),
+           first.team());
 }
 
 } // namespace dash
@@ -2,19 +2,27 @@
 #define DASH__ALGORITHM__ANY_OF_H__
 
 #include <dash/iterator/GlobIter.h>
-#include <dash/algorithm/Find.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Reduce.h>
+
+#include <algorithm>
 
 
 namespace dash {
 
 /**
+ * Returns true if the predicate holds for at least one element in the
+ * range \c [first, last).
+ *
+ * Collective operation, the result is returned at all units.
+ *
  * \ingroup     DashAlgorithms
  */
 template<
   typename ElementType,
   class    PatternType,
   typename UnaryPredicate >
-GlobIter<ElementType, PatternType> any_of(
+bool any_of(
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first,
   /// Iterator to the final position in the sequence
@@ -22,7 +30,10 @@ GlobIter<ElementType, PatternType> any_of(
   /// Predicate applied to the elements in range [first, last)
   UnaryPredicate                       p)
 {
-  return find_if(first, last, p) != last;
+  auto index_range = dash::local_range(first, last);
+  return dash::internal::team_any(
+           std::any_of(index_range.begin, index_range.end, p),
+           first.team());
 }
 
 } // namespace dash
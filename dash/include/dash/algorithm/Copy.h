@@ -4,6 +4,7 @@
 #include <dash/Future.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/Onesided.h>
 
 #include <dash/dart/if/dart_communication.h>
 
@@ -12,10 +13,11 @@
 #include <memory>
 #include <future>
 
-// #ifndef DASH__ALGORITHM__COPY__USE_WAIT
-#define DASH__ALGORITHM__COPY__USE_FLUSH
-// #define DASH__ALGORITHM__COPY__USE_WAIT
-// #endif
+// Asynchronous copy operations use DART handles by default such that
+// returned futures can test for completion. Define
+// DASH__ALGORITHM__COPY__USE_FLUSH to complete transfers by flushing
+// global pointers instead.
+// #define DASH__ALGORITHM__COPY__USE_FLUSH
 
 namespace dash {
 
@@ -268,7 +270,7 @@ dash::Future<ValueType *> copy_async_impl(
   size_type num_elem_total = dash::distance(in_first, in_last);
   if (num_elem_total <= 0) {
     DASH_LOG_TRACE("dash::copy_async_impl", "input range empty");
-    return dash::Future<ValueType *>([=]() { return out_first; });
+    return dash::make_ready_future(out_first);
   }
   DASH_LOG_TRACE("dash::copy_async_impl",
                  "total elements:",    num_elem_total,
@@ -430,6 +432,15 @@ dash::Future<ValueType *> copy_async_impl(
   for (auto gptr : req_handles) {
     DASH_LOG_TRACE("dash::copy_async_impl", "  req_handle:", gptr);
   }
+#endif
+#ifdef DASH__ALGORITHM__COPY__USE_FLUSH
+  // Requests can only be completed by flushing in wait():
+  typename dash::Future<ValueType *>::test_func_t test_func;
+#else
+  typename dash::Future<ValueType *>::test_func_t test_func =
+    [=]() mutable {
+      return dash::internal::test_local_completion(req_handles);
+    };
 #endif
   dash::Future<ValueType *> result([=]() mutable {
     // Wait for all get requests to complete:
@@ -465,7 +476,7 @@ dash::Future<ValueType *> copy_async_impl(
     DASH_LOG_TRACE("dash::copy_async_impl [Future] >",
                    "  async requests completed, _out:", _out);
     return _out;
-  });
+  }, test_func);
   DASH_LOG_TRACE("dash::copy_async_impl >", "  returning future");
   return result;
 }
@@ -568,6 +579,17 @@ dash::Future<GlobOutputIt> copy_async_impl(
   for (auto gptr : req_handles) {
     DASH_LOG_TRACE("dash::copy_async_impl", "  req_handle:", gptr);
   }
+#endif
+#ifdef DASH__ALGORITHM__COPY__USE_FLUSH
+  // Requests can only be completed by flushing in wait():
+  typename dash::Future<GlobOutputIt>::test_func_t test_func;
+#else
+  // Local completion of put requests allows to complete them in wait()
+  // without waiting for further local progress:
+  typename dash::Future<GlobOutputIt>::test_func_t test_func =
+    [=]() mutable {
+      return dash::internal::test_local_completion(req_handles);
+    };
 #endif
   dash::Future<GlobOutputIt> result([=]() mutable {
     // Wait for all get requests to complete:
@@ -603,7 +625,7 @@ dash::Future<GlobOutputIt> copy_async_impl(
     DASH_LOG_TRACE("dash::copy_async_impl [Future] >",
                    "  async requests completed, _out:", _out);
     return _out;
-  });
+  }, test_func);
   DASH_LOG_TRACE("dash::copy_async_impl >", "  returning future");
   return result;
 }
@@ -640,7 +662,7 @@ dash::Future<ValueType *> copy_async(
   DASH_LOG_TRACE("dash::copy_async()", "async, global to local");
   if (in_first == in_last) {
     DASH_LOG_TRACE("dash::copy_async", "input range empty");
-    return dash::Future<ValueType *>([=]() { return out_first; });
+    return dash::make_ready_future(out_first);
   }
   ValueType * dest_first = out_first;
   // Return value, initialize with begin of output range, indicating no values
@@ -681,7 +703,7 @@ dash::Future<ValueType *> copy_async(
     }
     DASH_LOG_TRACE("dash::copy_async", "finished local copy of",
                    (out_last - out_first), "elements");
-    return dash::Future<ValueType *>([=]() { return out_last; });
+    return dash::make_ready_future(out_last);
   }
 
   DASH_LOG_TRACE("dash::copy_async", "local range:",
@@ -810,19 +832,12 @@ dash::Future<ValueType *> copy_async(
     out_last = out_first + total_copy_elem;
   }
   DASH_LOG_TRACE("dash::copy_async", "preparing future");
-  dash::Future<ValueType *> fut_result([=]() mutable {
-    ValueType * _out = out_last;
-    DASH_LOG_TRACE("dash::copy_async [Future]()",
-                   "wait for", futures.size(), "async copy requests");
-    DASH_LOG_TRACE("dash::copy_async [Future]", "  futures:", futures);
-    DASH_LOG_TRACE("dash::copy_async [Future]", "  _out:", _out);
-    for (auto f : futures) {
-      f.wait();
-    }
-    DASH_LOG_TRACE("dash::copy_async [Future] >", "async requests completed",
-                   "futures:", futures, "_out:", _out);
-    return _out;
-  });
+  auto fut_result = dash::when_all(futures).then(
+    [=](std::vector<ValueType *> &) {
+      DASH_LOG_TRACE("dash::copy_async [Future] >",
+                     "async requests completed, _out:", out_last);
+      return out_last;
+    });
   DASH_LOG_TRACE("dash::copy_async >", "finished,",
                  "expected out_last:", out_last);
   return fut_result;
@@ -1165,13 +1180,12 @@ copy_async(
   if (l_in_first != nullptr && l_in_last != nullptr) {
     l_range.begin = l_in_first;
     l_range.end   = l_in_last;
-    return dash::Future< dash::LocalRange<ValueType> >(
-             [=]() { return l_range; });
+    return dash::make_ready_future(l_range);
   }
   auto fut_copy_end = dash::copy_async(in_first, in_last, out_first);
-  return dash::Future< dash::LocalRange<ValueType> >([=]() {
+  return fut_copy_end.then([=](ValueType * out_last) mutable {
            l_range.begin = out_first;
-           l_range.end   = fut_copy_end.get();
+           l_range.end   = out_last;
            return l_range;
          });
 }
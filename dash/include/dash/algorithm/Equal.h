@@ -5,93 +5,94 @@
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Reduce.h>
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
+#include <functional>
+
 namespace dash {
 
 /**
  * Returns true if the range \c [first1, last1) is equal to the range
- * \c [first2, first2 + (last1 - first1)), and false otherwise.
+ * \c [first2, first2 + (last1 - first1)) with respect to a specified
+ * predicate, and false otherwise.
+ *
+ * Every unit compares the elements of the first range in its local
+ * memory to the corresponding elements of the second range, which are
+ * local as well if both ranges have the same pattern and offset.
+ *
+ * Collective operation, the result is returned at all units.
  *
  * \ingroup     DashAlgorithms
  */
 template <
   typename ElementType,
-  class    PatternType >
+  class    PatternType,
+  class    BinaryPredicate >
 bool equal(
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first_1,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last_1,
-  GlobIter<ElementType, PatternType>   first_2)
+  GlobIter<ElementType, PatternType>   first_2,
+  BinaryPredicate                      pred)
 {
   auto & team        = first_1.team();
-  auto myid          = team.myid();
-  // Global iterators to local range:
-  auto index_range   = dash::local_range(first_1, last_1);
-  auto l_first_1     = index_range.begin;
-  auto l_last_1      = index_range.end;
-  auto l_result      = std::equal(l_first_1, l_last_1, first_2);
-
-  dash::Array<bool> l_results(team.size());
+  auto & pattern     = first_1.pattern();
+  // Local index range of the first range:
+  auto index_range   = dash::local_index_range(first_1, last_1);
+  auto l_begin_index = index_range.begin;
+  auto l_end_index   = index_range.end;
+  bool l_result      = true;
 
-  l_results.local[0] = l_result;
-  bool return_result = true;
-
-  // wait for all units to contribute their data
-  team.barrier();
-
-  // All local offsets stored in l_results
-  if (myid == 0) {
-    for (int u = 0; u < team.size(); u++) {
-      return_result &= l_results.local[u];
+  if (l_begin_index < l_end_index) {
+    const ElementType * l_first_1 = first_1.globmem().lbegin();
+    if (first_1.pos() == first_2.pos() &&
+        pattern == first_2.pattern()) {
+      // Corresponding elements in the second range are local:
+      const ElementType * l_first_2 = first_2.globmem().lbegin();
+      l_result = std::equal(l_first_1 + l_begin_index,
+                            l_first_1 + l_end_index,
+                            l_first_2 + l_begin_index,
+                            pred);
+    } else {
+      // Global position in the second range, GlobIter::operator[]
+      // expects an absolute position:
+      auto g_shift = first_2.pos() - first_1.pos();
+      for (auto l_idx = l_begin_index; l_idx < l_end_index; ++l_idx) {
+        auto g_index = pattern.global(l_idx) + g_shift;
+        if (!pred(l_first_1[l_idx],
+                  static_cast<ElementType>(first_2[g_index]))) {
+          l_result = false;
+          break;
+        }
+      }
     }
   }
-  return return_result;
+  return dash::internal::team_all(l_result, team);
 }
 
 /**
  * Returns true if the range \c [first1, last1) is equal to the range
- * \c [first2, first2 + (last1 - first1)) with respect to a specified
- * predicate, and false otherwise.
+ * \c [first2, first2 + (last1 - first1)), and false otherwise.
+ *
+ * Collective operation, the result is returned at all units.
  *
  * \ingroup     DashAlgorithms
  */
 template <
   typename ElementType,
-  class    PatternType,
-  class    BinaryPredicate >
+  class    PatternType >
 bool equal(
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first_1,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last_1,
-  GlobIter<ElementType, PatternType>   first_2,
-  BinaryPredicate                      pred)
+  GlobIter<ElementType, PatternType>   first_2)
 {
-  auto & team        = first_1.team();
-  auto myid          = team.myid();
-  // Global iterators to local range:
-  auto index_range   = dash::local_range(first_1, last_1);
-  auto l_first_1     = index_range.begin;
-  auto l_last_1      = index_range.end;
-  auto l_result      = std::equal(l_first_1, l_last_1, first_2, pred);
-
-  dash::Array<bool> l_results(team.size());
-
-  l_results.local[0] = l_result;
-
-  bool return_result = true;
-
-  team.barrier();
-
-  // All local offsets stored in l_results
-  if (myid == 0) {
-    for (int u = 0; u < team.size(); u++) {
-      return_result &= l_results.local[u];
-    }
-  }
-  return return_result;
+  return dash::equal(first_1, last_1, first_2,
+                     std::equal_to<ElementType>());
 }
 
 } // namespace dash
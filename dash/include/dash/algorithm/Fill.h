@@ -1,27 +1,73 @@
 #ifndef DASH__ALGORITHM__FILL_H__
 #define DASH__ALGORITHM__FILL_H__
 
+#include <dash/Execution.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
-
-#include <dash/util/UnitLocality.h>
+#include <dash/algorithm/internal/Parallel.h>
 
 #include <dash/dart/if/dart_communication.h>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
-
 
 namespace dash {
 
+/**
+ * Assigns the given value to the elements in the range [first, last),
+ * executing the local phase in the given execution policy.
+ *
+ * Being a collaborative operation, each unit will assign the value to
+ * its local elements only.
+ * When filling a newly allocated container, \c dash::execution::par
+ * places memory pages in the NUMA domains of the threads accessing them
+ * in subsequent algorithms executed with a parallel policy.
+ *
+ * \tparam      ExecutionPolicy  Execution policy type, for example
+ *                               \c dash::execution::parallel_policy
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \see         DashExecutionPolicies
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobIterType >
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+fill(
+  /// Execution policy of the local phase
+  ExecutionPolicy && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIterType       first,
+  /// Iterator to the final position in the sequence
+  GlobIterType       last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const typename GlobIterType::value_type & value)
+{
+  typedef typename GlobIterType::value_type value_t;
+
+  // Global iterators to local range:
+  auto        index_range = dash::local_range(first, last);
+  value_t   * lfirst      = index_range.begin;
+  std::size_t nlocal      = index_range.end - index_range.begin;
+  DASH_LOG_TRACE("dash::fill", "local elements:", nlocal);
+
+  dash::internal::local_parallel_for(
+    policy,
+    nlocal,
+    [&](std::size_t lt) {
+      lfirst[lt] = value;
+    });
+}
+
 /**
  * Assigns the given value to the elements in the range [first, last)
  *
  * Being a collaborative operation, each unit will assign the value to
  * its local elements only.
+ * Local elements are assigned in execution policy
+ * \c dash::execution::par.
  *
  * \tparam      ElementType  Type of the elements in the sequence
  * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
@@ -38,41 +84,7 @@ void fill(
   /// Value which will be assigned to the elements in range [first, last)
   const typename GlobIterType::value_type & value)
 {
-  typedef typename GlobIterType::index_type index_t;
-  typedef typename GlobIterType::value_type value_t;
-
-  // Global iterators to local range:
-  auto      index_range = dash::local_range(first, last);
-  value_t * lfirst      = index_range.begin;
-  value_t * llast       = index_range.end;
-  auto      nlocal      = llast - lfirst;
-
-#if 0
-  for (index_t lt = 0; lt < nlocal; lt++) {
-    lfirst[lt] = value;
-  }
-#else
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::fill", "thread capacity:",  n_threads);
-  #pragma omp parallel num_threads(n_threads)
-  for (index_t lt = 0; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-  #pragma omp parallel num_threads(n_threads)
-  for (index_t lt = 1; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-#else
-  for (index_t lt = 0; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-  for (index_t lt = 1; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-#endif
-#endif
+  dash::fill(dash::execution::par, first, last, value);
 }
 
 } // namespace dash
@@ -1,143 +1,366 @@
 #ifndef DASH__ALGORITHM__FIND_H__
 #define DASH__ALGORITHM__FIND_H__
 
-#include <dash/Array.h>
+#include <dash/Execution.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
 #include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 namespace dash {
+namespace internal {
 
 /**
- * Returns an iterator to the first element in the range \c [first,last) that
- * compares equal to \c val.
- * If no such element is found, the function returns \c last.
+ * Returns a pointer to the first element in the local range
+ * \c [l_first, l_last) for which \c predicate returns \c true, or
+ * \c l_last if no such element is found.
+ * With a parallel execution policy, threads search their chunks and the
+ * hit in the lowest chunk is returned.
+ */
+template<
+  class ExecutionPolicy,
+  class ElementType,
+  class UnaryPredicate >
+ElementType * local_find_if(
+  const ExecutionPolicy & policy,
+  ElementType           * l_first,
+  ElementType           * l_last,
+  UnaryPredicate          predicate)
+{
+  std::size_t l_size    = l_last - l_first;
+  int         n_threads = local_num_threads(policy, l_size);
+  // Offset of the first hit in the chunk of every thread:
+  std::vector<std::size_t> t_hits(n_threads, l_size);
+  local_parallel_chunks(
+    n_threads,
+    l_size,
+    [&](int t_id, std::size_t t_begin, std::size_t t_end) {
+      t_hits[t_id] = std::find_if(l_first + t_begin, l_first + t_end,
+                                  predicate)
+                     - l_first;
+      if (t_hits[t_id] == t_end) {
+        t_hits[t_id] = l_size;
+      }
+    });
+  return l_first + *std::min_element(t_hits.begin(), t_hits.end());
+}
+
+/**
+ * Number of local elements searched by every thread in \c dash::find_if
+ * before units check whether a preceding match has been found at another
+ * unit.
+ */
+constexpr std::size_t find_poll_elements_per_thread = 16384;
+
+/**
+ * Returns the global index of the first element in the range
+ * \c [first,last) for which \c predicate returns \c true, or the maximum
+ * value of the pattern's index type if no such element is found.
  *
- * \ingroup     DashAlgorithms
+ * Units search their local range in chunks. A unit publishing a match
+ * reduces its global index into a minimum allocated at the first unit in
+ * the team using a one-sided \c DART_OP_MIN accumulate. Between chunks,
+ * units poll this minimum with a non-blocking get and stop searching if
+ * it precedes the global index of their next chunk.
+ * Polling requires the global indices of local elements to increase with
+ * their local offsets, it is therefore only enabled for one-dimensional
+ * patterns.
+ *
+ * Collective operation, the result is returned at all units.
  */
 template<
+  class    ExecutionPolicy,
   typename ElementType,
-  class    PatternType>
-GlobIter<ElementType, PatternType> find(
-  /// Iterator to the initial position in the sequence
+  class    PatternType,
+  class    UnaryPredicate >
+typename PatternType::index_type find_if_global_index(
+  const ExecutionPolicy              & policy,
   GlobIter<ElementType, PatternType>   first,
-  /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last,
-  /// Value which will be assigned to the elements in range [first, last)
-  const ElementType                  & value)
+  UnaryPredicate                     & predicate)
 {
-  using p_index_t = typename PatternType::index_type;
+  typedef typename PatternType::index_type index_t;
 
-  if(first >= last) {
-    return last;
-  }
+  const index_t   no_hit = std::numeric_limits<index_t>::max();
+  dart_datatype_t dtype  = dart_datatype<index_t>::value;
 
-  p_index_t g_index;
-  auto & pattern     = first.pattern();
-  auto & team        = pattern.team();
-  auto index_range   = dash::local_index_range(first, last);
-  auto l_begin_index = index_range.begin;
-  auto l_end_index   = index_range.end;
-  auto first_offset  = first.pos();
-  if(l_begin_index == l_end_index){
-    g_index = std::numeric_limits<p_index_t>::max();
-  } else {
-   auto g_begin_index = pattern.global(l_begin_index);
-
-    // Pointer to first element in local memory:
-    const ElementType * lbegin        = first.globmem().lbegin(
-                                          dash::Team::GlobalUnitID());
-    // Pointers to first / final element in local range:
-    const ElementType * l_range_begin = lbegin + l_begin_index;
-    const ElementType * l_range_end   = lbegin + l_end_index;
-
-    DASH_LOG_DEBUG("local index range", l_begin_index, l_end_index);
-
-    auto l_result = std::find(l_range_begin, l_range_end, value);
-    if(l_result == l_range_end){
-      DASH_LOG_DEBUG("Not found in local range");
-      g_index = std::numeric_limits<p_index_t>::max();
-    } else {
-      auto l_hit_index = l_result - lbegin;
-      g_index = pattern.global(l_hit_index);
-    }
-  }
-  team.barrier();
+  auto & pattern       = first.pattern();
+  auto & team          = pattern.team();
+  auto index_range     = dash::local_index_range(first, last);
+  std::size_t l_begin  = index_range.begin;
+  std::size_t l_end    = index_range.end;
+  std::size_t l_size   = l_end - l_begin;
+  bool early_exit      = PatternType::ndim() == 1 && team.size() > 1;
 
-  // receive buffer for global maximal index
-  p_index_t g_hit_idx;
+  DASH_LOG_DEBUG("dash::find_if", "local index range", l_begin, l_end);
 
-  DASH_ASSERT_RETURNS(
-      dart_allreduce(
-        &g_index,
-        &g_hit_idx,
-        1,
-        dart_datatype<p_index_t>::value,
-        DART_OP_MIN,
+  // Minimum global index of matches found at any unit, allocated at the
+  // first unit in the team:
+  dart_gptr_t g_hit_gptr = DART_GPTR_NULL;
+  if (early_exit) {
+    if (team.myid() == 0) {
+      index_t * g_hit_lptr;
+      DASH_ASSERT_RETURNS(
+        dart_memalloc(1, dtype, &g_hit_gptr),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_gptr_getaddr(
+          g_hit_gptr, reinterpret_cast<void **>(&g_hit_lptr)),
+        DART_OK);
+      *g_hit_lptr = no_hit;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_bcast(
+        &g_hit_gptr,
+        sizeof(dart_gptr_t),
+        DART_TYPE_BYTE,
+        dash::team_unit_t(0),
         team.dart_id()),
       DART_OK);
+  }
+
+  index_t       l_hit        = no_hit;
+  // Last value of the global minimum received in a poll:
+  index_t       g_hit_polled = no_hit;
+  index_t       poll_buf     = no_hit;
+  dart_handle_t poll_handle  = nullptr;
+  bool          poll_pending = false;
 
-  if (g_hit_idx == std::numeric_limits<p_index_t>::max()) {
-    DASH_LOG_DEBUG("element not found");
-  } else {
-    return first + g_hit_idx;
+  std::size_t chunk_size = l_size;
+  if (early_exit) {
+    chunk_size = local_num_threads(policy, l_size)
+                 * find_poll_elements_per_thread;
   }
-  return last;
+  ElementType * lbegin = first.globmem().lbegin(dash::Team::GlobalUnitID());
+  for (std::size_t l_chunk = l_begin; l_chunk < l_end;
+       l_chunk += chunk_size) {
+    if (early_exit) {
+      if (poll_pending) {
+        int32_t poll_done;
+        DASH_ASSERT_RETURNS(
+          dart_test_local(poll_handle, &poll_done),
+          DART_OK);
+        if (poll_done) {
+          DASH_ASSERT_RETURNS(dart_wait(poll_handle), DART_OK);
+          g_hit_polled = std::min(g_hit_polled, poll_buf);
+          poll_pending = false;
+        }
+      }
+      if (g_hit_polled <= pattern.global(static_cast<index_t>(l_chunk))) {
+        DASH_LOG_DEBUG("dash::find_if", "match at global index",
+                       g_hit_polled, "precedes local index", l_chunk);
+        break;
+      }
+      if (!poll_pending) {
+        DASH_ASSERT_RETURNS(
+          dart_get_handle(&poll_buf, g_hit_gptr, 1, dtype, &poll_handle),
+          DART_OK);
+        poll_pending = true;
+      }
+    }
+    std::size_t   l_chunk_end = std::min(l_chunk + chunk_size, l_end);
+    ElementType * l_result    = local_find_if(
+                                  policy,
+                                  lbegin + l_chunk,
+                                  lbegin + l_chunk_end,
+                                  predicate);
+    if (l_result != lbegin + l_chunk_end) {
+      l_hit = pattern.global(static_cast<index_t>(l_result - lbegin));
+      DASH_LOG_DEBUG("dash::find_if", "local match at global index", l_hit);
+      if (early_exit) {
+        DASH_ASSERT_RETURNS(
+          dart_accumulate(g_hit_gptr, &l_hit, 1, dtype, DART_OP_MIN,
+                          team.dart_id()),
+          DART_OK);
+        DASH_ASSERT_RETURNS(dart_flush(g_hit_gptr), DART_OK);
+      }
+      break;
+    }
+  }
+  if (poll_pending) {
+    DASH_ASSERT_RETURNS(dart_wait(poll_handle), DART_OK);
+  }
+
+  // The first match is the minimum of the first local matches of all
+  // units, the allreduce also completes all accesses to the shared
+  // minimum before it is freed:
+  index_t g_hit;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_hit,
+      &g_hit,
+      1,
+      dtype,
+      DART_OP_MIN,
+      team.dart_id()),
+    DART_OK);
+  if (early_exit && team.myid() == 0) {
+    DASH_ASSERT_RETURNS(dart_memfree(g_hit_gptr), DART_OK);
+  }
+  return g_hit;
 }
 
+} // namespace internal
+
 /**
+ * Returns an iterator to the first element in the range \c [first,last)
+ * for which \c predicate returns \c true, executing the local phase in
+ * the given execution policy.
+ * If no such element is found, the function returns \c last.
+ *
+ * Units stop searching their local range as soon as a match preceding
+ * their remaining elements has been found at another unit, so the
+ * duration of the search depends on the position of the first match
+ * rather than on the size of the range.
+ *
+ * \see         DashExecutionPolicies
  * \ingroup     DashAlgorithms
  */
 template<
+  class    ExecutionPolicy,
   typename ElementType,
   class    PatternType,
-	class    UnaryPredicate >
-GlobIter<ElementType, PatternType> find_if(
+  class    UnaryPredicate >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+find_if(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last,
   /// Predicate which will be applied to the elements in range [first, last)
-	UnaryPredicate                       predicate)
+  UnaryPredicate                       predicate)
 {
   typedef typename PatternType::index_type index_t;
 
-  auto & team        = first.pattern().team();
-  auto myid          = team.myid();
-  /// Global iterators to local range:
-  auto index_range   = dash::local_range(first, last);
-  auto l_first       = index_range.begin;
-  auto l_last        = index_range.end;
-
-  auto l_result      = std::find_if(l_first, l_last, predicate);
-  auto l_offset      = std::distance(l_first, l_result);
-  if (l_result == l_last) {
-    l_offset = -1;
+  if (first >= last) {
+    return last;
   }
+  index_t g_hit_idx = dash::internal::find_if_global_index(
+                        policy, first, last, predicate);
+  if (g_hit_idx == std::numeric_limits<index_t>::max()) {
+    DASH_LOG_DEBUG("dash::find_if", "element not found");
+    return last;
+  }
+  return first + (g_hit_idx - first.pos());
+}
 
-  dash::Array<index_t> l_results(team.size());
-
-  l_results.local[0] = l_offset;
-
-  team.barrier();
+/**
+ * Returns an iterator to the first element in the range \c [first,last)
+ * for which \c predicate returns \c true.
+ * If no such element is found, the function returns \c last.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+	class    UnaryPredicate >
+GlobIter<ElementType, PatternType> find_if(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate which will be applied to the elements in range [first, last)
+	UnaryPredicate                       predicate)
+{
+  return dash::find_if(dash::execution::seq, first, last, predicate);
+}
 
-  // All local offsets stored in l_results
-  auto result = last;
+/**
+ * Returns an iterator to the first element in the range \c [first,last)
+ * that compares equal to \c val, executing the local phase in the given
+ * execution policy.
+ * If no such element is found, the function returns \c last.
+ *
+ * \see         dash::find_if
+ * \see         DashExecutionPolicies
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType>
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+find(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const ElementType                  & value)
+{
+  return dash::find_if(policy, first, last,
+                       [&](const ElementType & e) {
+                         return e == value;
+                       });
+}
 
-  for (auto u = 0; u < team.size(); u++) {
-    if (l_results[u] >= 0) {
-      auto g_offset = first.pattern()
-                           .global_index(
-                              u,
-                              { l_results[u] });
-      result = first + g_offset - first.pos();
-      break;
-    }
-  }
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * compares equal to \c val.
+ * If no such element is found, the function returns \c last.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType>
+GlobIter<ElementType, PatternType> find(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const ElementType                  & value)
+{
+  return dash::find(dash::execution::seq, first, last, value);
+}
 
-  team.barrier();
-  return result;
+/**
+ * Returns an iterator to the first element in the range \c [first,last)
+ * for which \c predicate returns \c false, executing the local phase in
+ * the given execution policy.
+ * If no such element is found, the function returns \c last.
+ *
+ * \see         DashExecutionPolicies
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate>
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+find_if_not(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate which will be applied to the elements in range [first, last)
+  UnaryPredicate                       predicate)
+{
+  return dash::find_if(policy, first, last,
+                       [&](const ElementType & e) {
+                         return !predicate(e);
+                       });
 }
 
 /**
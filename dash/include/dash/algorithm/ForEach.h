@@ -1,12 +1,118 @@
 #ifndef DASH__ALGORITHM__FOR_EACH_H__
 #define DASH__ALGORITHM__FOR_EACH_H__
 
+#include <dash/Execution.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Parallel.h>
 #include <dash/internal/Logging.h>
 
 namespace dash {
 
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * executing the local phase in the given execution policy.
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only.
+ *
+ * \code
+ *   dash::for_each(dash::execution::par,
+ *                  array.begin(), array.end(),
+ *                  [](double & e) { e = std::sqrt(e); });
+ * \endcode
+ *
+ * \tparam      ExecutionPolicy  Execution policy type, for example
+ *                               \c dash::execution::parallel_policy
+ * \tparam      UnaryFunction    Function invoked on non-const references
+ *                               of local elements
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \see         DashExecutionPolicies
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunction >
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+for_each(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Function to invoke on every element in the range
+  UnaryFunction                        func)
+{
+  auto & team     = first.pattern().team();
+  auto   l_range  = dash::local_range(first, last);
+  ElementType * l_first = l_range.begin;
+  std::size_t   l_size  = l_range.end - l_range.begin;
+  DASH_LOG_TRACE("dash::for_each", "local elements:", l_size);
+  dash::internal::local_parallel_for(
+    policy,
+    l_size,
+    [&](std::size_t i) {
+      func(l_first[i]);
+    });
+  team.barrier();
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * executing the local phase in the given execution policy.
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only. The index passed to the function
+ * is a global index.
+ *
+ * \tparam      ExecutionPolicy  Execution policy type, for example
+ *                               \c dash::execution::parallel_policy
+ * \tparam      BinaryFunction   Function invoked on non-const references
+ *                               of local elements and their global index
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \see         DashExecutionPolicies
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    BinaryFunction >
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+for_each_with_index(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Function to invoke on every element and its global index
+  BinaryFunction                       func)
+{
+  typedef typename PatternType::index_type index_t;
+
+  auto & team        = first.pattern().team();
+  auto & pattern     = first.pattern();
+  auto   index_range = dash::local_index_range(first, last);
+  auto   l_range     = dash::local_range(first, last);
+  ElementType * l_first       = l_range.begin;
+  index_t       l_begin_index = index_range.begin;
+  std::size_t   l_size        = l_range.end - l_range.begin;
+  DASH_LOG_TRACE("dash::for_each_with_index", "local elements:", l_size);
+  dash::internal::local_parallel_for(
+    policy,
+    l_size,
+    [&](std::size_t i) {
+      func(l_first[i], pattern.global(l_begin_index + i));
+    });
+  team.barrier();
+}
+
 /**
  * Invoke a function on every element in a range distributed by a pattern.
  * This function has the same signature as \c std::for_each but
@@ -33,20 +139,7 @@ void for_each(
   /// Function to invoke on every index in the range
   ::std::function<void(const ElementType &)> & func)
 {
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto pattern      = first.pattern();
-    // Local range to native pointers:
-    auto lrange_begin = (first + pattern.global(lbegin_index)).local();
-    auto lrange_end   = lrange_begin + lend_index;
-    std::for_each(lrange_begin, lrange_end, func);
-  }
-  team.barrier();
+  dash::for_each(dash::execution::seq, first, last, func);
 }
 
 /**
@@ -74,20 +167,7 @@ void for_each(
   /// Function to invoke on every index in the range
   ::std::function<void(ElementType &)> & func)
 {
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto pattern      = first.pattern();
-    // Local range to native pointers:
-    auto lrange_begin = (first + pattern.global(lbegin_index)).local();
-    auto lrange_end   = lrange_begin + lend_index;
-    std::for_each(lrange_begin, lrange_end, func);
-  }
-  team.barrier();
+  dash::for_each(dash::execution::seq, first, last, func);
 }
 
 /**
@@ -116,25 +196,13 @@ void for_each_with_index(
   /// Function to invoke on every index in the range
   ::std::function<void(const ElementType &, IndexType)> & func)
 {
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto pattern = first.pattern();
-    // Iterate local index range:
-    for (IndexType lindex = lbegin_index;
-         lindex != lend_index;
-         ++lindex) {
-      IndexType gindex  = pattern.global(lindex);
-      auto first_offset = first.pos();
-      auto element_it   = first + (gindex - first_offset);
-      func(*element_it, gindex);
-    }
-  }
-  team.barrier();
+  dash::for_each_with_index(
+    dash::execution::seq,
+    first,
+    last,
+    [&](const ElementType & e, typename PatternType::index_type gindex) {
+      func(e, static_cast<IndexType>(gindex));
+    });
 }
 
 } // namespace dash
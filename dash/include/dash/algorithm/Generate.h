@@ -1,13 +1,61 @@
 #ifndef DASH__ALGORITHM__GENERATE_H__
 #define DASH__ALGORITHM__GENERATE_H__
 
+#include <dash/Execution.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
 #include <dash/dart/if/dart_communication.h>
 
 namespace dash {
 
+/**
+ *  Assigns each element in range [first, last) a value generated by the
+ *  given function object g, executing the local phase in the given
+ *  execution policy.
+ *
+ *  Being a collaborative operation, each unit will invoke the given
+ *  function on its local elements only.
+ *  With a parallel execution policy, \c g is invoked concurrently by
+ *  multiple threads.
+ *
+ * \tparam      ExecutionPolicy  Execution policy type, for example
+ *                               \c dash::execution::parallel_policy
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \see         DashExecutionPolicies
+ * \ingroup     DashAlgorithms
+ */
+template<
+    class    ExecutionPolicy,
+    typename ElementType,
+    class    PatternType,
+    class    Generator >
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+generate (
+    /// Execution policy of the local phase
+    ExecutionPolicy                 && policy,
+    /// Iterator to the initial position in the sequence
+    GlobIter<ElementType, PatternType> first,
+    /// Iterator to the final position in the sequence
+    GlobIter<ElementType, PatternType> last,
+    /// Generator function
+    Generator                          g) {
+    /// Global iterators to local range:
+    auto          lrange = dash::local_range(first, last);
+    ElementType * lfirst = lrange.begin;
+    std::size_t   lsize  = lrange.end - lrange.begin;
+
+    dash::internal::local_parallel_for(
+      policy,
+      lsize,
+      [&](std::size_t i) {
+        lfirst[i] = g();
+      });
+}
+
 /**
  *  Assigns each element in range [first, last) a value generated by the
  *  given function object g.
@@ -31,12 +79,7 @@ void generate (
     GlobIter<ElementType, PatternType> last,
     /// Generator function
     ::std::function<ElementType(void)> & g) {
-    /// Global iterators to local range:
-    auto lrange = dash::local_range(first, last);
-    auto lfirst = lrange.begin;
-    auto llast  = lrange.end;
-
-    std::generate(lfirst, llast, g);
+    dash::generate(dash::execution::seq, first, last, g);
 }
 
 } // namespace dash
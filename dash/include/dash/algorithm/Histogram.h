@@ -0,0 +1,278 @@
+#ifndef DASH__ALGORITHM__HISTOGRAM_H__INCLUDED
+#define DASH__ALGORITHM__HISTOGRAM_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Execution.h>
+#include <dash/UpdateBuffer.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Strategies of \c dash::histogram to combine the bin counts of units.
+ *
+ * \ingroup  DashAlgorithms
+ */
+enum class HistogramStrategy
+{
+  /// Every unit selects \c dense if the number of bins does not exceed
+  /// the number of its keys by more than
+  /// \c dash::internal::histogram_dense_max_bins_per_key, and \c sparse
+  /// otherwise.
+  automatic,
+  /// Every unit counts its keys in a private histogram of all bins, the
+  /// private histograms are reduced to the owners of the bins in one
+  /// accumulate operation per unit.
+  dense,
+  /// Every unit sends its keys as aggregated updates of the bins using a
+  /// \c dash::UpdateBuffer, private histograms are not allocated.
+  sparse
+};
+
+namespace internal {
+
+/**
+ * Maximum ratio of bins to local keys for which a unit counts its keys in
+ * a private histogram in \c dash::histogram. Reducing a private
+ * histogram transfers all bins in few bulk operations, while aggregated
+ * updates of random keys mostly result in one accumulate operation per
+ * key.
+ */
+constexpr std::size_t histogram_dense_max_bins_per_key = 64;
+
+/**
+ * Counts the keys \c key_fn(e) of local elements \c e in
+ * \c [l_first, l_last) in a private histogram of \c nbins bins, in chunks
+ * of threads in the given execution policy.
+ */
+template<
+  class CountType,
+  class ExecutionPolicy,
+  class ElementType,
+  class KeyFunction >
+std::vector<CountType> local_histogram(
+  const ExecutionPolicy & policy,
+  const ElementType     * l_first,
+  const ElementType     * l_last,
+  std::size_t             nbins,
+  KeyFunction           & key_fn)
+{
+  std::size_t l_size    = l_last - l_first;
+  int         n_threads = local_num_threads(policy, l_size);
+  std::vector< std::vector<CountType> > t_hist(n_threads);
+  local_parallel_chunks(
+    n_threads,
+    l_size,
+    [&](int t_id, std::size_t begin, std::size_t end) {
+      auto & hist = t_hist[t_id];
+      hist.assign(nbins, CountType(0));
+      for (std::size_t i = begin; i < end; ++i) {
+        auto bin = static_cast<long long>(key_fn(l_first[i]));
+        if (bin >= 0 && static_cast<std::size_t>(bin) < nbins) {
+          ++hist[bin];
+        }
+      }
+    });
+  // Merge private histograms of threads into the histogram of thread 0:
+  for (int t_id = 1; t_id < n_threads; ++t_id) {
+    auto & t_counts = t_hist[t_id];
+    auto & counts   = t_hist[0];
+    local_parallel_for(
+      policy,
+      nbins,
+      [&](std::size_t bin) {
+        counts[bin] += t_counts[bin];
+      });
+  }
+  return std::move(t_hist[0]);
+}
+
+} // namespace internal
+
+/**
+ * Counts the elements \c e in the range \c [first, last) by their bin
+ * index \c key_fn(e) in the distributed bin array \c bins, executing the
+ * local phase in the given execution policy.
+ * Bin indices outside of \c [0, bins.size()) are ignored, previous
+ * values of \c bins are overwritten.
+ *
+ * Units count their local elements and combine their counts in the bins
+ * using one of two strategies:
+ *
+ * - Dense: every unit counts its elements in a private histogram of all
+ *   bins, using a private histogram per thread with parallel execution
+ *   policies. Private histograms are reduce-scattered to the owners of
+ *   the bins in one accumulate operation per unit, independent of the
+ *   number of elements.
+ * - Sparse: every unit sends an update of the bin of every element,
+ *   aggregated in a \c dash::UpdateBuffer. Memory and communication are
+ *   proportional to the number of local elements, independent of the
+ *   number of bins.
+ *
+ * Strategies are selected per unit, see \c dash::HistogramStrategy.
+ * The range may have any distribution, \c bins must be a one-dimensional
+ * container of a count type supported by DART accumulate operations, like
+ * \c dash::Array<int>.
+ *
+ * Collective operation.
+ *
+ * \see      DashExecutionPolicies
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    BinsType,
+  class    KeyFunction >
+dash::internal::enable_if_execution_policy<ExecutionPolicy>
+histogram(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Distributed bin counts
+  BinsType                           & bins,
+  /// Function returning the bin index of an element
+  KeyFunction                          key_fn,
+  /// Strategy to combine bin counts of units
+  HistogramStrategy                    strategy = HistogramStrategy::automatic)
+{
+  typedef typename BinsType::value_type count_t;
+  typedef typename BinsType::index_type index_t;
+
+  static_assert(
+    BinsType::pattern_type::ndim() == 1,
+    "dash::histogram requires a one-dimensional bin container");
+  static_assert(
+    dash::dart_datatype<count_t>::value != DART_TYPE_UNDEFINED,
+    "dash::histogram cannot accumulate unknown count type");
+
+  auto &      b_pattern = bins.pattern();
+  auto &      b_team    = b_pattern.team();
+  std::size_t nunits    = b_team.size();
+  std::size_t myid      = b_team.myid();
+  std::size_t nbins     = bins.size();
+  auto        l_range   = dash::local_range(first, last);
+  std::size_t l_size    = l_range.end - l_range.begin;
+
+  if (strategy == HistogramStrategy::automatic) {
+    strategy = (nbins <= l_size *
+                         dash::internal::histogram_dense_max_bins_per_key)
+               ? HistogramStrategy::dense
+               : HistogramStrategy::sparse;
+  }
+  DASH_LOG_DEBUG("dash::histogram", "bins:", nbins, "local elements:",
+                 l_size, "dense:", strategy == HistogramStrategy::dense);
+
+  std::fill(bins.lbegin(), bins.lend(), count_t(0));
+  b_team.barrier();
+
+  if (strategy == HistogramStrategy::dense) {
+    auto l_hist = dash::internal::local_histogram<count_t>(
+                    policy, l_range.begin, l_range.end, nbins, key_fn);
+    // Private counts grouped by units owning the bins:
+    std::vector<count_t>     send_buf(nbins);
+    std::vector<std::size_t> u_offsets(nunits + 1, 0);
+    for (std::size_t u = 0; u < nunits; ++u) {
+      auto u_size = b_pattern.local_size(team_unit_t(u));
+      for (std::size_t l = 0; l < u_size; ++l) {
+        send_buf[u_offsets[u] + l] = l_hist[
+          b_pattern.global_index(
+            team_unit_t(u),
+            std::array<index_t, 1> {{ static_cast<index_t>(l) }})];
+      }
+      u_offsets[u + 1] = u_offsets[u] + u_size;
+    }
+    // Reduce-scatter, starting at the next unit to spread the accumulate
+    // operations of all units to different targets:
+    for (std::size_t r = 1; r <= nunits; ++r) {
+      std::size_t u      = (myid + r) % nunits;
+      std::size_t u_size = u_offsets[u + 1] - u_offsets[u];
+      if (u_size == 0) {
+        continue;
+      }
+      DASH_ASSERT_RETURNS(
+        dart_accumulate(
+          bins.begin().globmem().at(team_unit_t(u), 0).dart_gptr(),
+          send_buf.data() + u_offsets[u],
+          u_size,
+          dash::dart_datatype<count_t>::value,
+          DART_OP_SUM,
+          b_team.dart_id()),
+        DART_OK);
+    }
+    DASH_ASSERT_RETURNS(
+      dart_flush_all(bins.begin().dart_gptr()),
+      DART_OK);
+  } else {
+    dash::UpdateBuffer<BinsType, dash::plus<count_t>> bin_updates(bins);
+    for (auto it = l_range.begin; it != l_range.end; ++it) {
+      auto bin = static_cast<long long>(key_fn(*it));
+      if (bin >= 0 && static_cast<std::size_t>(bin) < nbins) {
+        bin_updates.update(static_cast<index_t>(bin), count_t(1));
+      }
+    }
+    bin_updates.flush();
+  }
+  b_team.barrier();
+}
+
+/**
+ * Counts the elements \c e in the range \c [first, last) by their bin
+ * index \c key_fn(e) in the distributed bin array \c bins.
+ * Bin indices outside of \c [0, bins.size()) are ignored, previous
+ * values of \c bins are overwritten.
+ *
+ * Collective operation.
+ *
+ * \code
+ *   dash::Array<int> keys(num_keys);
+ *   dash::Array<int> key_histo(max_key);
+ *   dash::histogram(keys.begin(), keys.end(), key_histo,
+ *                   [](int key) { return key; });
+ * \endcode
+ *
+ * \see      dash::histogram(ExecutionPolicy &&, GlobIter, GlobIter, BinsType &, KeyFunction, HistogramStrategy)
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    BinsType,
+  class    KeyFunction >
+void histogram(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Distributed bin counts
+  BinsType                           & bins,
+  /// Function returning the bin index of an element
+  KeyFunction                          key_fn,
+  /// Strategy to combine bin counts of units
+  HistogramStrategy                    strategy = HistogramStrategy::automatic)
+{
+  dash::histogram(dash::execution::par, first, last, bins, key_fn,
+                  strategy);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__HISTOGRAM_H__INCLUDED
@@ -5,8 +5,11 @@
 
 #include <dash/Array.h>
 #include <dash/Allocator.h>
+#include <dash/Execution.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/algorithm/internal/Reduce.h>
 
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
@@ -16,150 +19,324 @@
 #include <dash/internal/Logging.h>
 
 #include <algorithm>
+#include <functional>
+#include <limits>
 #include <memory>
-
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <type_traits>
+#include <vector>
 
 
 namespace dash {
+namespace internal {
+
+/**
+ * The DART reduce operation equivalent to selecting elements with
+ * comparison function \c Compare in \c dash::min_element, or
+ * \c DART_OP_UNDEFINED if the comparison or the value type are not
+ * supported by DART.
+ */
+template< typename ValueType, class Compare >
+struct min_element_dart_operation
+{
+  static constexpr dart_operation_t value = DART_OP_UNDEFINED;
+};
+
+template< typename ValueType >
+struct min_element_dart_operation<ValueType, std::less<ValueType> >
+{
+  static constexpr dart_operation_t value =
+    (std::is_arithmetic<ValueType>::value &&
+     dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED)
+    ? DART_OP_MIN
+    : DART_OP_UNDEFINED;
+};
+
+template< typename ValueType >
+struct min_element_dart_operation<ValueType, std::greater<ValueType> >
+{
+  static constexpr dart_operation_t value =
+    (std::is_arithmetic<ValueType>::value &&
+     dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED)
+    ? DART_OP_MAX
+    : DART_OP_UNDEFINED;
+};
+
+/**
+ * Sequential search of the minimum element with an arbitrary comparison
+ * function.
+ */
+template< typename ElementType, class Compare >
+const ElementType * local_min_element_seq(
+  const ElementType * l_first,
+  const ElementType * l_last,
+  Compare           & compare,
+  std::false_type     /* arithmetic */)
+{
+  return std::min_element(l_first, l_last, compare);
+}
+
+/**
+ * Sequential search of the minimum element of arithmetic type with
+ * comparison \c std::less or \c std::greater.
+ * The extremal value is determined in a loop without data-dependent
+ * branches that is vectorized as \c omp \c simd reduction, its first
+ * occurrence is located in a second pass.
+ */
+template< typename ElementType, class Compare >
+const ElementType * local_min_element_seq(
+  const ElementType * l_first,
+  const ElementType * l_last,
+  Compare           & compare,
+  std::true_type      /* arithmetic */)
+{
+  std::size_t l_size  = l_last - l_first;
+  ElementType ext_val = *l_first;
+  if (min_element_dart_operation<ElementType, Compare>::value
+      == DART_OP_MIN) {
+#if DASH__OPENMP_VERSION >= 40
+    #pragma omp simd reduction(min:ext_val)
+#endif
+    for (std::size_t i = 0; i < l_size; ++i) {
+      ext_val = l_first[i] < ext_val ? l_first[i] : ext_val;
+    }
+  } else {
+#if DASH__OPENMP_VERSION >= 40
+    #pragma omp simd reduction(max:ext_val)
+#endif
+    for (std::size_t i = 0; i < l_size; ++i) {
+      ext_val = l_first[i] > ext_val ? l_first[i] : ext_val;
+    }
+  }
+  const ElementType * l_ext = std::find(l_first, l_last, ext_val);
+  if (l_ext == l_last) {
+    // Only if values are not comparable, e.g. NaN:
+    return std::min_element(l_first, l_last, compare);
+  }
+  return l_ext;
+}
+
+} // namespace internal
 
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
- * Specialization for local range, delegates to std::min_element.
+ * Specialization for local range, distributed to the unit's threads in
+ * execution policy \c dash::execution::par.
+ *
+ * The comparison function is inlined. For arithmetic types compared with
+ * \c std::less or \c std::greater, the search is vectorized.
  *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
  *
  * \tparam      ElementType  Type of the elements in the sequence
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \tparam      Compare      Element comparison function type
+ * \complexity  O(nl), with \c nl local elements within the range
  *
  * \ingroup     DashAlgorithms
  */
-template<typename ElementType>
+template<
+  typename ElementType,
+  class    Compare = std::less<ElementType> >
 const ElementType * min_element(
   /// Iterator to the initial position in the sequence
   const ElementType * l_range_begin,
   /// Iterator to the final position in the sequence
   const ElementType * l_range_end,
   /// Element comparison function, defaults to std::less
-  const std::function<
-          bool(const ElementType &, const ElementType)
-        > & compare
-        = std::less<const ElementType &>())
+  Compare             compare = Compare())
 {
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::min_element", "thread capacity:",  n_threads);
-
-  // TODO: Should also restrict on elements/units > ~10240.
-  //       Find a model for the minimum work laod.
-  if (n_threads > 1) {
-    auto          l_size     = l_range_end - l_range_begin;
-    int           min_idx_l  = 0;
-    ElementType   min_val_l  = *l_range_begin;
-
-    typedef struct min_pos_t { ElementType val; size_t idx; } min_pos;
-
-    DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size);
-    int       align_bytes      = uloc.cache_line_size(0);
-    size_t    min_vals_t_size  = n_threads + 1 +
-                                 (align_bytes / sizeof(min_pos));
-    size_t    min_vals_t_bytes = min_vals_t_size * sizeof(min_pos);
-    min_pos * min_vals_t_raw   = new min_pos[min_vals_t_size];
-    void    * min_vals_t_alg   = min_vals_t_raw;
-    min_pos * min_vals_t       = static_cast<min_pos *>(
-                                   dash::align(
-                                     align_bytes,
-                                     sizeof(min_pos),
-                                     min_vals_t_alg,
-                                     min_vals_t_bytes));
-    DASH_LOG_TRACE("dash::min_element", "min * alloc:",   min_vals_t_raw);
-    DASH_LOG_TRACE("dash::min_element", "min * aligned:", min_vals_t);
-    DASH_LOG_TRACE("dash::min_element", "min * size:",    min_vals_t_bytes);
-    DASH_ASSERT_GE(min_vals_t_bytes, n_threads * sizeof(min_pos),
-                   "Aligned buffer of min_pos has insufficient size");
-    DASH_ASSERT_MSG(nullptr != min_vals_t,
-                    "Aligned allocation of min_pos returned nullptr");
-
-    // Cannot use user-defined reduction (OpenMP 4.0) as the compare
-    // predicate cannot be used in `omp declare reduction`.
-    // Avoid omp for + omp critical section by using array of
-    // thread-local minimum values, aligned to prevent false sharing:
-    int t_id;
-    #pragma omp parallel num_threads(n_threads) private(t_id)
-    {
-      // Documentation of Intel MIC intrinsics, see:
-      // https://software.intel.com/de-de/node/523533
-      // https://software.intel.com/de-de/node/523387
-      t_id = omp_get_thread_num();
-      DASH_LOG_TRACE("dash::min_element", "starting thread", t_id);
-      min_vals_t[t_id].idx = min_idx_l;
-      min_vals_t[t_id].val = min_val_l;
-      // Cannot use explicit private(min_val_t) as ElementType might
-      // not be default-constructible:
-      #pragma omp for schedule(static)
-//    #pragma ivdep
-//    #pragma vector aligned nontemporal
-      for (int i = 0; i < l_size; i++) {
-        const ElementType & val_t = *(l_range_begin + i);
-        if (compare(val_t, min_vals_t[t_id].val)) {
-          min_vals_t[t_id].val = val_t;
-          min_vals_t[t_id].idx = i;
-        }
-      }
-      DASH_LOG_TRACE("dash::min_element", "local minimum at thread", t_id,
-                     "idx:", min_vals_t[t_id].idx,
-                     "val:", min_vals_t[t_id].val);
-    }
-    min_pos min_pos_l = min_vals_t[0];
-    for (int t = 1; t < n_threads; t++) {
-      const min_pos & mpt = min_vals_t[t];
-      if (compare(mpt.val, min_pos_l.val)) {
-        min_pos_l = mpt;
+  typedef std::integral_constant<
+            bool,
+            dash::internal::min_element_dart_operation<
+              ElementType, Compare >::value != DART_OP_UNDEFINED >
+    is_arithmetic_compare;
+
+  if (l_range_begin == l_range_end) {
+    return l_range_end;
+  }
+  std::size_t l_size    = l_range_end - l_range_begin;
+  int         n_threads = dash::internal::local_num_threads(
+                            dash::execution::par, l_size);
+  DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size,
+                 "threads:", n_threads);
+  // Offset of the minimum in the chunk of every thread:
+  std::vector<std::size_t> t_min_idx(n_threads, l_size);
+  dash::internal::local_parallel_chunks(
+    n_threads,
+    l_size,
+    [&](int t_id, std::size_t t_begin, std::size_t t_end) {
+      if (t_begin < t_end) {
+        t_min_idx[t_id] = dash::internal::local_min_element_seq(
+                            l_range_begin + t_begin,
+                            l_range_begin + t_end,
+                            compare,
+                            is_arithmetic_compare())
+                          - l_range_begin;
       }
+    });
+  // Combine thread results in order of their chunks so the first
+  // occurrence of the minimum is returned:
+  std::size_t min_idx = t_min_idx[0];
+  for (int t = 1; t < n_threads; t++) {
+    if (t_min_idx[t] < l_size &&
+        compare(l_range_begin[t_min_idx[t]], l_range_begin[min_idx])) {
+      min_idx = t_min_idx[t];
     }
-    delete[] min_vals_t_raw;
-    return (l_range_begin + min_pos_l.idx);
   }
-#endif // DASH_ENABLE_OPENMP
-  return ::std::min_element(l_range_begin, l_range_end, compare);
+  return l_range_begin + min_idx;
 }
 
+namespace internal {
+
+/**
+ * Selects the global minimum of local minima of all units in two
+ * \c dart_allreduce operations: the extremal value and the smallest
+ * global index of units holding it.
+ * Replaces \c MPI_MINLOC / \c MPI_MAXLOC, DART has no value-index pair
+ * types.
+ */
+template<
+  typename ElementType,
+  typename IndexType,
+  class    Compare >
+IndexType min_element_team_reduce(
+  const ElementType * lmin,
+  IndexType           g_index_lmin,
+  Compare           & /* compare */,
+  dash::Team        & team,
+  std::true_type      /* dart operation */)
+{
+  const dart_operation_t dart_op =
+    min_element_dart_operation<ElementType, Compare>::value;
+  ElementType l_value = (nullptr != lmin)
+                        ? *lmin
+                        : reduce_identity<ElementType>(dart_op);
+  ElementType g_value;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_value,
+      &g_value,
+      1,
+      dash::dart_datatype<ElementType>::value,
+      dart_op,
+      team.dart_id()),
+    DART_OK);
+  IndexType l_g_index = (nullptr != lmin && *lmin == g_value)
+                        ? g_index_lmin
+                        : std::numeric_limits<IndexType>::max();
+  IndexType g_index;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_g_index,
+      &g_index,
+      1,
+      dash::dart_datatype<IndexType>::value,
+      DART_OP_MIN,
+      team.dart_id()),
+    DART_OK);
+  return g_index == std::numeric_limits<IndexType>::max() ? -1 : g_index;
+}
+
+/**
+ * Selects the global minimum of local minima of all units using an
+ * arbitrary comparison function, allgathers the local minima.
+ */
+template<
+  typename ElementType,
+  typename IndexType,
+  class    Compare >
+IndexType min_element_team_reduce(
+  const ElementType * lmin,
+  IndexType           g_index_lmin,
+  Compare           & compare,
+  dash::Team        & team,
+  std::false_type     /* dart operation */)
+{
+  typedef struct {
+    ElementType value;
+    IndexType   g_index;
+  } local_min_t;
+
+  std::vector<local_min_t> local_min_values(team.size());
+
+  // Set global index of local minimum to -1 if no local minimum has been
+  // found:
+  local_min_t local_min;
+  local_min.value   = (nullptr == lmin) ? ElementType() : *lmin;
+  local_min.g_index = (nullptr == lmin) ? -1 : g_index_lmin;
+
+  DASH_LOG_TRACE("dash::min_element", "dart_allgather()");
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &local_min,
+      local_min_values.data(),
+      sizeof(local_min_t),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+
+  auto gmin_elem_it = ::std::min_element(
+                        local_min_values.begin(),
+                        local_min_values.end(),
+                        [&](const local_min_t & a,
+                            const local_min_t & b) {
+                          // Ignore elements with global index -1 (no
+                          // element found), prefer the first occurrence
+                          // of equal elements:
+                          if (a.g_index < 0 || b.g_index < 0) {
+                            return b.g_index < 0 && a.g_index >= 0;
+                          }
+                          return compare(a.value, b.value) ||
+                                 (!compare(b.value, a.value) &&
+                                  a.g_index < b.g_index);
+                        });
+  return gmin_elem_it->g_index;
+}
+
+} // namespace internal
+
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
  *
+ * The local minima of units are reduced in a single collective operation.
+ * For arithmetic types compared with \c std::less or \c std::greater,
+ * this is a \c dart_allreduce of the extremal value followed by a
+ * \c dart_allreduce of its smallest global index, otherwise local minima
+ * are allgathered.
+ *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
  *
  * \tparam      ElementType  Type of the elements in the sequence
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \tparam      Compare      Element comparison function type
+ * \complexity  O(d) + O(nl) + O(log p), with \c d dimensions in the
+ *              global iterators' pattern, \c nl local elements within the
+ *              global range and \c p units
  *
  * \ingroup     DashAlgorithms
  */
 template<
   typename ElementType,
-  class    PatternType>
+  class    PatternType,
+  class    Compare = std::less<ElementType> >
 GlobIter<ElementType, PatternType> min_element(
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
   const GlobIter<ElementType, PatternType> & last,
   /// Element comparison function, defaults to std::less
-  const std::function<
-          bool(const ElementType &, const ElementType)
-        > & compare
-        = std::less<const ElementType &>())
+  Compare                                    compare = Compare())
 {
   typedef dash::GlobIter<ElementType, PatternType> globiter_t;
   typedef PatternType                               pattern_t;
   typedef typename pattern_t::index_type              index_t;
+  typedef std::integral_constant<
+            bool,
+            dash::internal::min_element_dart_operation<
+              ElementType, Compare >::value != DART_OP_UNDEFINED >
+    is_dart_operation;
 
   // return last for empty array
   if (first == last) {
@@ -172,17 +349,15 @@ GlobIter<ElementType, PatternType> min_element(
 
   auto & pattern = first.pattern();
   auto & team    = pattern.team();
-  DASH_LOG_DEBUG("dash::min_element()",
-                 "allocate minarr, size", team.size());
   // Global position of end element in range:
   auto    gi_last            = last.gpos();
   // Find the local min. element in parallel
   // Get local address range between global iterators:
   auto    local_idx_range    = dash::local_index_range(first, last);
-  // Pointer to local minimum element:
+  // Pointer to local minimum element, or nullptr if no element found:
   const   ElementType * lmin = nullptr;
-  // Local offset of local minimum element, or -1 if no element found:
-  index_t l_idx_lmin         = -1;
+  // Global index of local minimum element:
+  index_t g_idx_lmin         = -1;
   if (local_idx_range.begin == local_idx_range.end) {
     // local range is empty
     DASH_LOG_DEBUG("dash::min_element", "local range empty");
@@ -200,87 +375,22 @@ GlobIter<ElementType, PatternType> min_element(
 
     if (lmin != l_range_end) {
       DASH_LOG_TRACE_VAR("dash::min_element", *lmin);
-      // Offset of local minimum in local memory:
-      l_idx_lmin = lmin - lbegin;
+      // Global index of local minimum:
+      g_idx_lmin = pattern.global(lmin - lbegin);
+    } else {
+      lmin = nullptr;
     }
 
     trace.exit_state("local");
   }
   DASH_LOG_TRACE("dash::min_element",
-                 "local index of local minimum:", l_idx_lmin);
-  DASH_LOG_TRACE("dash::min_element",
-                 "waiting for local min of other units");
-
-  trace.enter_state("barrier");
-  team.barrier();
-  trace.exit_state("barrier");
+                 "global index of local minimum:", g_idx_lmin);
 
-  typedef struct {
-    ElementType value;
-    index_t     g_index;
-  } local_min_t;
-
-  std::vector<local_min_t> local_min_values(team.size());
-
-  // Set global index of local minimum to -1 if no local minimum has been
-  // found:
-  local_min_t local_min;
-  local_min.value   = l_idx_lmin < 0
-                      ? ElementType()
-                      : *lmin;
-  local_min.g_index = l_idx_lmin < 0
-                      ? -1
-                      : pattern.global(l_idx_lmin);
-
-  DASH_LOG_TRACE("dash::min_element", "sending local minimum: {",
-                 "value:",   local_min.value,
-                 "g.index:", local_min.g_index, "}");
-
-  DASH_LOG_TRACE("dash::min_element", "dart_allgather()");
-  trace.enter_state("allgather");
-  DASH_ASSERT_RETURNS(
-    dart_allgather(
-      &local_min,
-      local_min_values.data(),
-      sizeof(local_min_t),
-      DART_TYPE_BYTE,
-      team.dart_id()),
-    DART_OK);
-  trace.exit_state("allgather");
-
-#ifdef DASH_ENABLE_LOGGING
-  for (int lmin_u = 0; lmin_u < local_min_values.size(); lmin_u++) {
-    auto lmin_entry = local_min_values[lmin_u];
-    DASH_LOG_TRACE("dash::min_element", "dart_allgather >",
-                   "unit:",    lmin_u,
-                   "value:",   lmin_entry.value,
-                   "g_index:", lmin_entry.g_index);
-  }
-#endif
-
-  auto gmin_elem_it  = ::std::min_element(
-                           local_min_values.begin(),
-                           local_min_values.end(),
-                           [&](const local_min_t & a,
-                               const local_min_t & b) {
-                             // Ignore elements with global index -1 (no
-                             // element found):
-                             return (b.g_index < 0 ||
-                                     (a.g_index > 0 &&
-                                      compare(a.value, b.value)));
-                           });
-
-  if (gmin_elem_it == local_min_values.end()) {
-    DASH_LOG_DEBUG_VAR("dash::min_element >", last);
-    return last;
-  }
-
-  auto gi_minimum    = gmin_elem_it->g_index;
-
-  DASH_LOG_TRACE("dash::min_element",
-                 "min. value:", gmin_elem_it->value,
-                 "at unit:",    (gmin_elem_it - local_min_values.begin()),
-                 "global idx:", gi_minimum);
+  trace.enter_state("reduce");
+  auto gi_minimum = dash::internal::min_element_team_reduce(
+                      lmin, g_idx_lmin, compare, team,
+                      is_dart_operation());
+  trace.exit_state("reduce");
 
   DASH_LOG_TRACE_VAR("dash::min_element", gi_minimum);
   if (gi_minimum < 0 || gi_minimum == gi_last) {
@@ -291,8 +401,7 @@ GlobIter<ElementType, PatternType> min_element(
   // of its referenced container (= container.begin()), then apply global
   // offset of minimum element:
   globiter_t minimum = (first - first.gpos()) + gi_minimum;
-  DASH_LOG_DEBUG("dash::min_element >", minimum,
-                 "=", static_cast<ElementType>(*minimum));
+  DASH_LOG_DEBUG("dash::min_element >", minimum);
 
   return minimum;
 }
@@ -312,17 +421,15 @@ GlobIter<ElementType, PatternType> min_element(
  */
 template<
   typename ElementType,
-  class    PatternType>
+  class    PatternType,
+  class    Compare = std::greater<ElementType> >
 GlobIter<ElementType, PatternType> max_element(
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
   const GlobIter<ElementType, PatternType> & last,
-  /// Element comparison function, defaults to std::less
-  const std::function<
-          bool(const ElementType &, const ElementType)
-        > & compare
-        = std::greater<const ElementType &>())
+  /// Element comparison function, defaults to std::greater
+  Compare                                    compare = Compare())
 {
   // Same as min_element with different compare function
   return dash::min_element(first, last, compare);
@@ -331,7 +438,7 @@ GlobIter<ElementType, PatternType> max_element(
 /**
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
- * Specialization for local range, delegates to std::min_element.
+ * Specialization for local range, delegates to dash::min_element.
  *
  * \return      An iterator to the first occurrence of the greatest value
  *              in the range, or \c last if the range is empty.
@@ -342,17 +449,16 @@ GlobIter<ElementType, PatternType> max_element(
  *
  * \ingroup     DashAlgorithms
  */
-template< typename ElementType >
+template<
+  typename ElementType,
+  class    Compare = std::greater<ElementType> >
 const ElementType * max_element(
   /// Iterator to the initial position in the sequence
   const ElementType * first,
   /// Iterator to the final position in the sequence
   const ElementType * last,
-  /// Element comparison function, defaults to std::less
-  const std::function<
-          bool(const ElementType &, const ElementType)
-        > & compare
-        = std::greater<const ElementType &>())
+  /// Element comparison function, defaults to std::greater
+  Compare             compare = Compare())
 {
   // Same as min_element with different compare function
   return dash::min_element(first, last, compare);
@@ -0,0 +1,41 @@
+#ifndef DASH__ALGORITHM__NONE_OF_H__
+#define DASH__ALGORITHM__NONE_OF_H__
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Reduce.h>
+
+#include <algorithm>
+
+
+namespace dash {
+
+/**
+ * Returns true if the predicate holds for no element in the range
+ * \c [first, last), or if the range is empty.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  typename UnaryPredicate >
+bool none_of(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                       p)
+{
+  auto index_range = dash::local_range(first, last);
+  return !dash::internal::team_any(
+           std::any_of(index_range.begin, index_range.end, p),
+           first.team());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__NONE_OF_H__
@@ -0,0 +1,105 @@
+#ifndef DASH__ALGORITHM__NTH_ELEMENT_H__INCLUDED
+#define DASH__ALGORITHM__NTH_ELEMENT_H__INCLUDED
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Partition.h>
+#include <dash/algorithm/internal/Select.h>
+
+#include <dash/internal/Logging.h>
+
+#include <functional>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Reorders the elements in the range \c [first, last) such that the
+ * element at position \c nth is the element that would be at this
+ * position if the range was sorted with respect to the comparison
+ * function \c comp, no element preceding \c nth is greater and no element
+ * following \c nth is less than this element.
+ *
+ * The selected element is determined without moving elements, in rounds
+ * of weighted median pivot sampling and collective counting, see
+ * \c dash::internal::select_kth. Elements are then moved to their side of
+ * \c nth using two stable \c dash::partition operations.
+ * To obtain the value of the selected element without reordering the
+ * range, like for medians, see \c dash::partial_sort_copy.
+ *
+ * The local elements of every unit in the range must be a contiguous
+ * subrange, like in one-dimensional \c dash::BLOCKED distributions.
+ *
+ * Collective operation.
+ *
+ * \throws  dash::exception::InvalidArgument  if the local elements of a
+ *          unit in the range are not contiguous
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    Compare >
+void nth_element(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the position of the selected element
+  GlobIter<ElementType, PatternType>   nth,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Comparison function returning true if the first argument is less
+  /// than the second
+  Compare                              comp)
+{
+  if (first >= last || nth >= last) {
+    return;
+  }
+  auto l_range = dash::local_range(first, last);
+  std::vector<ElementType> l_values(l_range.begin, l_range.end);
+  ElementType nth_value = dash::internal::select_kth(
+                            l_values.data(), l_values.size(),
+                            nth - first, comp, first.team());
+  DASH_LOG_DEBUG("dash::nth_element", "selected element of rank",
+                 nth - first);
+  auto g_lower = dash::partition(
+                   first, last,
+                   [&](const ElementType & e) {
+                     return comp(e, nth_value);
+                   });
+  dash::partition(
+    g_lower, last,
+    [&](const ElementType & e) {
+      return !comp(nth_value, e);
+    });
+}
+
+/**
+ * Reorders the elements in the range \c [first, last) such that the
+ * element at position \c nth is the element that would be at this
+ * position if the range was sorted in ascending order.
+ *
+ * Collective operation.
+ *
+ * \see  dash::nth_element(GlobIter, GlobIter, GlobIter, Compare)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType >
+void nth_element(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the position of the selected element
+  GlobIter<ElementType, PatternType>   nth,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last)
+{
+  dash::nth_element(first, nth, last, std::less<ElementType>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__NTH_ELEMENT_H__INCLUDED
@@ -112,6 +112,63 @@ public:
   }
 };
 
+/**
+ * Reduce operands to their bitwise AND.
+ *
+ * \see      dart_operation_t::DART_OP_BAND
+ *
+ * \ingroup  DashReduceOperations
+ */
+template< typename ValueType >
+struct bit_and : public ReduceOperation<ValueType, DART_OP_BAND> {
+
+public:
+
+  ValueType operator()(
+    const ValueType & lhs,
+    const ValueType & rhs) const {
+    return lhs & rhs;
+  }
+};
+
+/**
+ * Reduce operands to their bitwise OR.
+ *
+ * \see      dart_operation_t::DART_OP_BOR
+ *
+ * \ingroup  DashReduceOperations
+ */
+template< typename ValueType >
+struct bit_or : public ReduceOperation<ValueType, DART_OP_BOR> {
+
+public:
+
+  ValueType operator()(
+    const ValueType & lhs,
+    const ValueType & rhs) const {
+    return lhs | rhs;
+  }
+};
+
+/**
+ * Reduce operands to their bitwise XOR.
+ *
+ * \see      dart_operation_t::DART_OP_BXOR
+ *
+ * \ingroup  DashReduceOperations
+ */
+template< typename ValueType >
+struct bit_xor : public ReduceOperation<ValueType, DART_OP_BXOR> {
+
+public:
+
+  ValueType operator()(
+    const ValueType & lhs,
+    const ValueType & rhs) const {
+    return lhs ^ rhs;
+  }
+};
+
 }  // namespace dash
 
 #endif // DASH__ALGORITHM__OPERATION_H__
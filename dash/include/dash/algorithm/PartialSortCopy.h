@@ -0,0 +1,173 @@
+#ifndef DASH__ALGORITHM__PARTIAL_SORT_COPY_H__INCLUDED
+#define DASH__ALGORITHM__PARTIAL_SORT_COPY_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Select.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Copies the \c k smallest elements in the range \c [first, last) with
+ * respect to the comparison function \c comp in ascending order to the
+ * local range \c [d_first, d_first + k) at every unit, where \c k is the
+ * smaller of the sizes of both ranges.
+ * Returns an iterator to the end of the copied elements in the local
+ * range.
+ *
+ * The range is not modified. The \c k-th smallest element is determined
+ * in rounds of weighted median pivot sampling and collective counting,
+ * see \c dash::internal::select_kth. Then every unit contributes its
+ * elements less than the \c k-th smallest element and, in the order of
+ * unit ids, the elements equivalent to it that complete the \c k
+ * smallest elements. Only these \c k elements and \c O(P log n) samples
+ * and counts are exchanged, instead of gathering the complete range.
+ *
+ * With \c k = 1 and a range of size \c n, the last copied element is the
+ * minimum; with \c k = n/2 + 1, it is the median of the range.
+ *
+ * Collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    RandomIt,
+  class    Compare >
+RandomIt partial_sort_copy(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Iterator to the initial position of the local destination range
+  RandomIt                             d_first,
+  /// Iterator to the final position of the local destination range
+  RandomIt                             d_last,
+  /// Comparison function returning true if the first argument is less
+  /// than the second
+  Compare                              comp)
+{
+  auto & team     = first.team();
+  auto   nunits   = team.size();
+  auto   myid     = team.myid();
+  auto   g_size   = dash::distance(first, last);
+  auto   d_size   = std::distance(d_first, d_last);
+  if (g_size <= 0 || d_size <= 0) {
+    return d_first;
+  }
+  std::size_t k = std::min<std::size_t>(g_size, d_size);
+
+  auto l_range = dash::local_range(first, last);
+  std::vector<ElementType> l_values(l_range.begin, l_range.end);
+  ElementType kth_value = dash::internal::select_kth(
+                            l_values.data(), l_values.size(),
+                            k - 1, comp, team);
+
+  // Number of local elements less than and not greater than the k-th
+  // smallest element of all units:
+  auto l_count = dash::internal::select_count<ElementType>(
+                   l_range.begin, l_range.end, kth_value, comp);
+  std::vector<dash::internal::SelectCount> g_counts(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_count,
+      g_counts.data(),
+      sizeof(dash::internal::SelectCount),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+
+  // Elements contributed by every unit, elements equivalent to the k-th
+  // smallest element are assigned in the order of units:
+  std::size_t n_equal_left = k;
+  for (const auto & count : g_counts) {
+    n_equal_left -= count.lower;
+  }
+  std::vector<std::size_t> u_bytes(nunits);
+  std::vector<std::size_t> u_displs(nunits);
+  std::size_t              l_equal = 0;
+  std::size_t              g_bytes = 0;
+  for (std::size_t u = 0; u < nunits; ++u) {
+    auto u_equal = std::min(g_counts[u].upper - g_counts[u].lower,
+                            n_equal_left);
+    n_equal_left -= u_equal;
+    if (u == static_cast<std::size_t>(myid)) {
+      l_equal = u_equal;
+    }
+    u_bytes[u]  = (g_counts[u].lower + u_equal) * sizeof(ElementType);
+    u_displs[u] = g_bytes;
+    g_bytes    += u_bytes[u];
+  }
+  std::vector<ElementType> l_selected;
+  l_selected.reserve(l_count.lower + l_equal);
+  for (auto it = l_range.begin; it != l_range.end; ++it) {
+    if (comp(*it, kth_value)) {
+      l_selected.push_back(*it);
+    } else if (l_equal > 0 && !comp(kth_value, *it)) {
+      l_selected.push_back(*it);
+      --l_equal;
+    }
+  }
+  DASH_LOG_DEBUG("dash::partial_sort_copy", "k:", k,
+                 "local elements:", l_selected.size());
+
+  std::vector<ElementType> g_selected(k);
+  DASH_ASSERT_RETURNS(
+    dart_allgatherv(
+      l_selected.data(),
+      l_selected.size() * sizeof(ElementType),
+      DART_TYPE_BYTE,
+      g_selected.data(),
+      u_bytes.data(),
+      u_displs.data(),
+      team.dart_id()),
+    DART_OK);
+  std::sort(g_selected.begin(), g_selected.end(), comp);
+  return std::copy(g_selected.begin(), g_selected.end(), d_first);
+}
+
+/**
+ * Copies the \c k smallest elements in the range \c [first, last) in
+ * ascending order to the local range \c [d_first, d_first + k) at every
+ * unit, where \c k is the smaller of the sizes of both ranges.
+ * Returns an iterator to the end of the copied elements in the local
+ * range.
+ *
+ * Collective operation.
+ *
+ * \see  dash::partial_sort_copy(GlobIter, GlobIter, RandomIt, RandomIt, Compare)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    RandomIt >
+RandomIt partial_sort_copy(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Iterator to the initial position of the local destination range
+  RandomIt                             d_first,
+  /// Iterator to the final position of the local destination range
+  RandomIt                             d_last)
+{
+  return dash::partial_sort_copy(first, last, d_first, d_last,
+                                 std::less<ElementType>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__PARTIAL_SORT_COPY_H__INCLUDED
@@ -0,0 +1,93 @@
+#ifndef DASH__ALGORITHM__PARTITION_H__INCLUDED
+#define DASH__ALGORITHM__PARTITION_H__INCLUDED
+
+#include <dash/Execution.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/internal/Compact.h>
+
+#include <cstddef>
+
+
+namespace dash {
+
+/**
+ * Reorders the elements in the range \c [first, last) such that all
+ * elements for which \c predicate returns \c true precede all elements
+ * for which it returns \c false, executing the local phase in the given
+ * execution policy.
+ * Returns an iterator to the first element of the second group.
+ *
+ * The relative order of elements in both groups is preserved, like in
+ * \c std::stable_partition.
+ * Every unit splits its local elements and writes both groups to the
+ * units owning their new positions, in at most two one-sided puts per
+ * target unit.
+ *
+ * The local elements of every unit in the range must be a contiguous
+ * subrange.
+ *
+ * Collective operation.
+ *
+ * \throws  dash::exception::InvalidArgument  if the local elements of a
+ *          unit in the range are not contiguous
+ *
+ * \see      DashExecutionPolicies
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+partition(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate returning true for elements of the first group
+  UnaryPredicate                       predicate)
+{
+  auto n_first = dash::internal::compact(
+                   policy, first, last,
+                   [&](const ElementType * l_first, std::size_t i) {
+                     return static_cast<bool>(predicate(l_first[i]));
+                   },
+                   true);
+  DASH_LOG_DEBUG("dash::partition", "elements in first group:", n_first);
+  return first + n_first;
+}
+
+/**
+ * Reorders the elements in the range \c [first, last) such that all
+ * elements for which \c predicate returns \c true precede all elements
+ * for which it returns \c false.
+ * Returns an iterator to the first element of the second group.
+ *
+ * Collective operation.
+ *
+ * \see      dash::partition(ExecutionPolicy &&, GlobIter, GlobIter, UnaryPredicate)
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+GlobIter<ElementType, PatternType> partition(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate returning true for elements of the first group
+  UnaryPredicate                       predicate)
+{
+  return dash::partition(dash::execution::par, first, last, predicate);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__PARTITION_H__INCLUDED
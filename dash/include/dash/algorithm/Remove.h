@@ -0,0 +1,152 @@
+#ifndef DASH__ALGORITHM__REMOVE_H__INCLUDED
+#define DASH__ALGORITHM__REMOVE_H__INCLUDED
+
+#include <dash/Execution.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/internal/Compact.h>
+
+#include <cstddef>
+
+
+namespace dash {
+
+/**
+ * Removes all elements in the range \c [first, last) for which
+ * \c predicate returns \c true, executing the local phase in the given
+ * execution policy.
+ * Returns an iterator to the new end of the range.
+ *
+ * Remaining elements are moved to the beginning of the range in their
+ * relative order, so they are densely distributed in the range's pattern,
+ * like in one-dimensional \c dash::BLOCKED distributions.
+ * Every unit filters its local elements and writes the remaining elements
+ * to the units owning their new positions, in a single one-sided put per
+ * target unit. Values of elements behind the returned iterator are
+ * unspecified.
+ *
+ * The local elements of every unit in the range must be a contiguous
+ * subrange.
+ *
+ * Collective operation.
+ *
+ * \throws  dash::exception::InvalidArgument  if the local elements of a
+ *          unit in the range are not contiguous
+ *
+ * \see      DashExecutionPolicies
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+remove_if(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate returning true for elements to be removed
+  UnaryPredicate                       predicate)
+{
+  auto n_kept = dash::internal::compact(
+                  policy, first, last,
+                  [&](const ElementType * l_first, std::size_t i) {
+                    return !predicate(l_first[i]);
+                  },
+                  false);
+  DASH_LOG_DEBUG("dash::remove_if", "remaining elements:", n_kept);
+  return first + n_kept;
+}
+
+/**
+ * Removes all elements in the range \c [first, last) for which
+ * \c predicate returns \c true.
+ * Returns an iterator to the new end of the range.
+ *
+ * Collective operation.
+ *
+ * \see      dash::remove_if(ExecutionPolicy &&, GlobIter, GlobIter, UnaryPredicate)
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+GlobIter<ElementType, PatternType> remove_if(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate returning true for elements to be removed
+  UnaryPredicate                       predicate)
+{
+  return dash::remove_if(dash::execution::par, first, last, predicate);
+}
+
+/**
+ * Removes all elements in the range \c [first, last) that compare equal
+ * to \c value, executing the local phase in the given execution policy.
+ * Returns an iterator to the new end of the range.
+ *
+ * Collective operation.
+ *
+ * \see      dash::remove_if
+ * \see      DashExecutionPolicies
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+remove(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Value of elements to be removed
+  const ElementType                  & value)
+{
+  return dash::remove_if(
+           policy, first, last,
+           [&](const ElementType & e) {
+             return e == value;
+           });
+}
+
+/**
+ * Removes all elements in the range \c [first, last) that compare equal
+ * to \c value.
+ * Returns an iterator to the new end of the range.
+ *
+ * Collective operation.
+ *
+ * \see      dash::remove_if
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType >
+GlobIter<ElementType, PatternType> remove(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Value of elements to be removed
+  const ElementType                  & value)
+{
+  return dash::remove(dash::execution::par, first, last, value);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__REMOVE_H__INCLUDED
@@ -9,6 +9,7 @@
 #include <dash/util/Trace.h>
 
 #include <utility>
+#include <vector>
 
 // Prefer MKL if available:
 #ifdef DASH_ENABLE_MKL
@@ -362,8 +363,7 @@ void summa(
 #else
     dash::copy(block_a.begin(), block_a.end(),
                local_block_a_comp);
-    get_a = dash::Future<value_type *>(
-              [=]() { return local_block_a_comp + block_a.size(); });
+    get_a = dash::make_ready_future(local_block_a_comp + block_a.size());
 #endif
   } else {
     local_block_a_comp_bac = local_block_a_comp;
@@ -382,25 +382,20 @@ void summa(
 #else
     dash::copy(block_b.begin(), block_b.end(),
                local_block_b_comp);
-    get_b = dash::Future<value_type *>(
-              [=]() { return local_block_b_comp + block_b.size(); });
+    get_b = dash::make_ready_future(local_block_b_comp + block_b.size());
 #endif
   } else {
     local_block_b_comp_bac = local_block_b_comp;
     local_block_b_comp     = block_b_lptr;
   }
 #ifdef DASH_ALGORITHM_SUMMA_ASYNC_INIT_PREFETCH
-  if (block_a_lptr == nullptr) {
-    DASH_LOG_TRACE("dash::summa", "summa.prefetch.block.a.wait",
-                   "waiting for prefetching of block A from unit",
-                   block_a.begin().lpos().unit);
-    get_a.wait();
-  }
-  if (block_b_lptr == nullptr) {
-    DASH_LOG_TRACE("dash::summa", "summa.prefetch.block.b.wait",
-                   "waiting for prefetching of block B from unit",
-                   block_b.begin().lpos().unit);
-    get_b.wait();
+  {
+    std::vector< dash::Future<value_type *> > prefetch;
+    if (block_a_lptr == nullptr) { prefetch.push_back(get_a); }
+    if (block_b_lptr == nullptr) { prefetch.push_back(get_b); }
+    DASH_LOG_TRACE("dash::summa", "summa.prefetch.wait",
+                   "waiting for prefetching of", prefetch.size(), "blocks");
+    dash::when_all(prefetch).wait();
   }
 #endif
   trace.exit_state("prefetch");
@@ -531,18 +526,13 @@ void summa(
         // Wait for local copies:
         // -------------------------------------------------------------------
         trace.enter_state("prefetch");
-        if (block_a_lptr == nullptr) {
-          DASH_LOG_TRACE("dash::summa", "summa.prefetch.block.a.wait",
-                         "waiting for prefetching of block A from unit",
-                         block_a.begin().lpos().unit);
-          get_a.wait();
-        }
-        if (block_b_lptr == nullptr) {
-          DASH_LOG_TRACE("dash::summa", "summa.prefetch.block.b.wait",
-                         "waiting for prefetching of block B from unit",
-                         block_b.begin().lpos().unit);
-          get_b.wait();
-        }
+        std::vector< dash::Future<value_type *> > prefetch;
+        if (block_a_lptr == nullptr) { prefetch.push_back(get_a); }
+        if (block_b_lptr == nullptr) { prefetch.push_back(get_b); }
+        DASH_LOG_TRACE("dash::summa", "summa.prefetch.wait",
+                       "waiting for prefetching of", prefetch.size(),
+                       "blocks");
+        dash::when_all(prefetch).wait();
         DASH_LOG_TRACE("dash::summa", "summa.prefetch.completed",
                        "local copies of next blocks received");
         trace.exit_state("prefetch");
@@ -0,0 +1,372 @@
+#ifndef DASH__ALGORITHM__SCAN_H__INCLUDED
+#define DASH__ALGORITHM__SCAN_H__INCLUDED
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Reduce.h>
+#include <dash/algorithm/internal/Subrange.h>
+
+#include <dash/Exception.h>
+#include <dash/internal/IndexedTransfer.h>
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <dash/util/UnitLocality.h>
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Writes the prefix reduction of the local range \c [l_first, l_last),
+ * combined with the given prefix, to \c l_out.
+ * If \c exclusive is set, the i-th output element does not include the
+ * i-th input element and \c prefix must be valid.
+ * Distributed to the unit's threads if OpenMP is enabled, threads scan
+ * chunks of the range seeded with the reduction of their preceding
+ * chunks.
+ */
+template<
+  typename ValueType,
+  class    BinaryOperation >
+void local_scan(
+  const ValueType                    * l_first,
+  const ValueType                    * l_last,
+  ValueType                          * l_out,
+  const LocalReduceResult<ValueType> & prefix,
+  BinaryOperation                      op,
+  bool                                 exclusive)
+{
+  auto l_size = std::distance(l_first, l_last);
+  if (l_size <= 0) {
+    return;
+  }
+  auto scan_chunk = [&](std::ptrdiff_t                 c_begin,
+                        std::ptrdiff_t                 c_end,
+                        LocalReduceResult<ValueType>   c_prefix) {
+    auto      i   = c_begin;
+    ValueType acc = c_prefix.value;
+    if (!c_prefix.valid) {
+      // Inclusive scan without preceding elements:
+      acc      = l_first[i];
+      l_out[i] = acc;
+      ++i;
+    }
+    // Input and output range may be identical:
+    if (exclusive) {
+      for (; i < c_end; ++i) {
+        ValueType in = l_first[i];
+        l_out[i]     = acc;
+        acc          = op(acc, in);
+      }
+    } else {
+      for (; i < c_end; ++i) {
+        acc      = op(acc, l_first[i]);
+        l_out[i] = acc;
+      }
+    }
+  };
+#ifdef DASH_ENABLE_OPENMP
+  int n_threads = local_num_threads(dash::execution::par, l_size);
+  if (n_threads > 1) {
+    DASH_LOG_DEBUG("dash::internal::local_scan", "threads:", n_threads);
+    std::vector< LocalReduceResult<ValueType> > t_results(n_threads);
+    #pragma omp parallel num_threads(n_threads)
+    {
+      int  t_id    = omp_get_thread_num();
+      auto t_range = local_chunk(t_id, n_threads, l_size);
+      auto t_begin = static_cast<decltype(l_size)>(t_range.begin);
+      auto t_end   = static_cast<decltype(l_size)>(t_range.end);
+      if (t_begin < t_end) {
+        ValueType t_val = l_first[t_begin];
+        for (auto i = t_begin + 1; i < t_end; ++i) {
+          t_val = op(t_val, l_first[i]);
+        }
+        t_results[t_id] = LocalReduceResult<ValueType> { t_val, true };
+      }
+      #pragma omp barrier
+      // Reduction of preceding chunks:
+      LocalReduceResult<ValueType> t_prefix = prefix;
+      for (int t = 0; t < t_id; ++t) {
+        if (t_results[t].valid) {
+          t_prefix.value = t_prefix.valid
+                           ? op(t_prefix.value, t_results[t].value)
+                           : t_results[t].value;
+          t_prefix.valid = true;
+        }
+      }
+      if (t_begin < t_end) {
+        scan_chunk(t_begin, t_end, t_prefix);
+      }
+    }
+    return;
+  }
+#endif // DASH_ENABLE_OPENMP
+  scan_chunk(0, l_size, prefix);
+}
+
+/**
+ * Common implementation of \c dash::inclusive_scan and
+ * \c dash::exclusive_scan.
+ *
+ * 1. Every unit reduces its local elements.
+ * 2. The local results of units with preceding subranges are combined in
+ *    an exclusive prefix reduction over the team.
+ * 3. Every unit scans its local elements seeded with the result of its
+ *    preceding units and writes them to the output range.
+ */
+template<
+  typename ValueType,
+  class    PatternType,
+  class    BinaryOperation >
+GlobIter<ValueType, PatternType> scan(
+  GlobIter<ValueType, PatternType>     first,
+  GlobIter<ValueType, PatternType>     last,
+  GlobIter<ValueType, PatternType>     d_first,
+  BinaryOperation                      op,
+  LocalReduceResult<ValueType>         init,
+  bool                                 exclusive)
+{
+  static_assert(
+    PatternType::ndim() == 1,
+    "dash::scan requires a one-dimensional range");
+
+  auto d_last = d_first + (last - first);
+  if (first >= last) {
+    return d_last;
+  }
+  auto & team     = first.team();
+  auto & pattern  = first.pattern();
+  auto   l_range  = local_subrange(first, last);
+  auto   l_size   = l_range.l_size;
+  auto   g_offset = l_range.g_offset;
+  const ValueType * l_first = first.globmem().lbegin() + l_range.l_begin;
+  // Subranges of all units, throws at every unit if any unit's elements
+  // are not contiguous:
+  auto u_ranges = gather_subranges(l_range, team, "dash::scan");
+  auto units    = subrange_units(u_ranges);
+
+  // Local pass:
+  auto l_result = local_reduce<ValueType>(
+                    l_first, l_first + l_size,
+                    [](const ValueType & v) { return v; }, op);
+  // Prefix reduction over units in order of their subranges:
+  auto prefix   = std::is_sorted(units.begin(), units.end())
+                  ? team_exscan(l_result, op, team)
+                  : team_exscan(l_result, op, team, units);
+  if (init.valid) {
+    prefix.value = prefix.valid ? op(init.value, prefix.value) : init.value;
+    prefix.valid = true;
+  }
+  DASH_LOG_TRACE("dash::internal::scan", "l_size:", l_size,
+                 "g_offset:", g_offset, "prefix valid:", prefix.valid);
+
+  // Fix-up pass, output range in local memory if it has the same
+  // distribution as the input range:
+  if (d_first.pos() == first.pos() && pattern == d_first.pattern()) {
+    ValueType * l_out = d_first.globmem().lbegin() + l_range.l_begin;
+    local_scan(l_first, l_first + l_size, l_out, prefix, op, exclusive);
+  } else {
+    std::vector<ValueType> l_out(l_size);
+    local_scan(l_first, l_first + l_size, l_out.data(), prefix, op,
+               exclusive);
+    // Output range may overlap with input elements of other units:
+    team.barrier();
+    if (l_size > 0) {
+      std::vector<typename PatternType::index_type> g_indices(l_size);
+      std::iota(g_indices.begin(), g_indices.end(),
+                d_first.pos() + g_offset);
+      dash::internal::scatter_indexed(
+        d_first.globmem(),
+        d_first.pattern(),
+        d_first.globmem().lbegin(),
+        g_indices,
+        l_out.data()).wait();
+    }
+  }
+  team.barrier();
+  return d_last;
+}
+
+} // namespace internal
+
+/**
+ * Computes the inclusive prefix reduction of the range \c [first, last)
+ * using the binary operation \c op, combined with \c init, and writes
+ * the results to the range beginning at \c d_first:
+ *
+ *   <tt>d_first[i] = init op first[0] op ... op first[i]</tt>
+ *
+ * The operation must be associative. The output range may be identical
+ * to the input range. If it has the same distribution as the input range,
+ * results are written to local memory only.
+ *
+ * Every unit reduces its local elements, the results of units with
+ * preceding subranges are combined in a single \c dart_exscan for
+ * operations supported by DART if the subranges are in the order of unit
+ * ids, and every unit then scans its local elements seeded with the
+ * result of preceding units.
+ * The local elements of every unit in the range must be a contiguous
+ * subrange, like in one-dimensional \c dash::BLOCKED distributions.
+ *
+ * Collective operation.
+ *
+ * \returns  Iterator to the element past the last element written
+ *
+ * \throws  dash::exception::InvalidArgument  if the local elements of a
+ *          unit in the range are not contiguous
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class    PatternType,
+  class    BinaryOperation >
+GlobIter<ValueType, PatternType> inclusive_scan(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ValueType, PatternType>     first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ValueType, PatternType>     last,
+  /// Iterator to the initial position in the output sequence
+  GlobIter<ValueType, PatternType>     d_first,
+  /// Reduce operation
+  BinaryOperation                      op,
+  /// Value combined with the first element
+  ValueType                            init)
+{
+  return dash::internal::scan(
+           first, last, d_first, op,
+           dash::internal::LocalReduceResult<ValueType> { init, true },
+           false);
+}
+
+/**
+ * Computes the inclusive prefix reduction of the range \c [first, last)
+ * using the binary operation \c op.
+ *
+ * Collective operation.
+ *
+ * \see  dash::inclusive_scan(first, last, d_first, op, init)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class    PatternType,
+  class    BinaryOperation >
+GlobIter<ValueType, PatternType> inclusive_scan(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ValueType, PatternType>     first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ValueType, PatternType>     last,
+  /// Iterator to the initial position in the output sequence
+  GlobIter<ValueType, PatternType>     d_first,
+  /// Reduce operation
+  BinaryOperation                      op)
+{
+  return dash::internal::scan(
+           first, last, d_first, op,
+           dash::internal::LocalReduceResult<ValueType> { ValueType(), false },
+           false);
+}
+
+/**
+ * Computes the inclusive prefix sum of the range \c [first, last).
+ *
+ * Collective operation.
+ *
+ * \see  dash::inclusive_scan(first, last, d_first, op, init)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class    PatternType >
+GlobIter<ValueType, PatternType> inclusive_scan(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ValueType, PatternType>     first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ValueType, PatternType>     last,
+  /// Iterator to the initial position in the output sequence
+  GlobIter<ValueType, PatternType>     d_first)
+{
+  return dash::inclusive_scan(first, last, d_first,
+                              dash::plus<ValueType>());
+}
+
+/**
+ * Computes the exclusive prefix reduction of the range \c [first, last)
+ * using the binary operation \c op, starting with \c init, and writes the
+ * results to the range beginning at \c d_first:
+ *
+ *   <tt>d_first[0] = init</tt> \n
+ *   <tt>d_first[i] = init op first[0] op ... op first[i-1]</tt>
+ *
+ * Collective operation.
+ *
+ * \returns  Iterator to the element past the last element written
+ *
+ * \see  dash::inclusive_scan(first, last, d_first, op, init)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class    PatternType,
+  class    BinaryOperation >
+GlobIter<ValueType, PatternType> exclusive_scan(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ValueType, PatternType>     first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ValueType, PatternType>     last,
+  /// Iterator to the initial position in the output sequence
+  GlobIter<ValueType, PatternType>     d_first,
+  /// Value of the first output element
+  ValueType                            init,
+  /// Reduce operation
+  BinaryOperation                      op)
+{
+  return dash::internal::scan(
+           first, last, d_first, op,
+           dash::internal::LocalReduceResult<ValueType> { init, true },
+           true);
+}
+
+/**
+ * Computes the exclusive prefix sum of the range \c [first, last),
+ * starting with \c init.
+ *
+ * Collective operation.
+ *
+ * \see  dash::exclusive_scan(first, last, d_first, init, op)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class    PatternType >
+GlobIter<ValueType, PatternType> exclusive_scan(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ValueType, PatternType>     first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ValueType, PatternType>     last,
+  /// Iterator to the initial position in the output sequence
+  GlobIter<ValueType, PatternType>     d_first,
+  /// Value of the first output element
+  ValueType                            init)
+{
+  return dash::exclusive_scan(first, last, d_first, init,
+                              dash::plus<ValueType>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SCAN_H__INCLUDED
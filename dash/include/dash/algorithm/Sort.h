@@ -0,0 +1,201 @@
+#ifndef DASH__ALGORITHM__SORT_H__INCLUDED
+#define DASH__ALGORITHM__SORT_H__INCLUDED
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Sort.h>
+#include <dash/algorithm/internal/Subrange.h>
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Sorts the elements in the range \c [first, last) in ascending order
+ * with respect to the comparison function \c comp.
+ * The order of equal elements is not preserved.
+ *
+ * Elements remain in the distribution of the range: after sorting, the
+ * element at global position \c i is the \c i-th smallest element in the
+ * range. The local elements of every unit in the range must be a
+ * contiguous subrange, like in one-dimensional \c dash::BLOCKED
+ * distributions.
+ *
+ * Sorting proceeds in four phases:
+ *
+ * 1. Every unit sorts its local elements, using threads if OpenMP is
+ *    enabled.
+ * 2. The partition of sorted local elements at the global positions of
+ *    every unit's subrange is determined by histogramming of sampled
+ *    splitters, see \c dash::internal::sort_partition.
+ * 3. Units exchange the partitions of variable size, writing them to
+ *    their target units in one-sided put operations.
+ * 4. Every unit merges the sorted runs it received.
+ *
+ * Collective operation.
+ *
+ * \throws  dash::exception::InvalidArgument  if the local elements of a
+ *          unit in the range are not contiguous
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    Compare >
+void sort(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Comparison function returning true if the first argument is less
+  /// than the second
+  Compare                              comp)
+{
+  static_assert(
+    PatternType::ndim() == 1,
+    "dash::sort requires a one-dimensional range");
+  static_assert(
+    std::is_trivially_copyable<ElementType>::value,
+    "dash::sort requires trivially copyable element type");
+
+  if (first >= last) {
+    return;
+  }
+  auto & team    = first.team();
+  auto   nunits  = team.size();
+  auto   myid    = team.myid();
+  auto   l_range = dash::internal::local_subrange(first, last);
+  ElementType * l_mem = first.globmem().lbegin();
+  DASH_LOG_TRACE("dash::sort", "l_begin:", l_range.l_begin,
+                 "l_size:", l_range.l_size, "g_offset:", l_range.g_offset);
+
+  // Phase 1: sort copy of local elements, the local elements are
+  // overwritten by other units in phase 3:
+  std::vector<ElementType> l_sorted(
+                             l_mem + l_range.l_begin,
+                             l_mem + l_range.l_begin + l_range.l_size);
+  dash::internal::local_sort(l_sorted.begin(), l_sorted.end(), comp);
+
+  // Local ranges of all units, also ensures that every unit copied its
+  // local elements:
+  auto u_ranges = dash::internal::gather_subranges(
+                    l_range, team, "dash::sort");
+  // Units with elements in the range in order of their subranges:
+  auto targets  = dash::internal::subrange_units(u_ranges);
+  std::vector<std::size_t> u_sizes(nunits);
+  for (std::size_t u = 0; u < nunits; ++u) {
+    u_sizes[u] = u_ranges[u].l_size;
+  }
+
+  // Phase 2: partition sorted elements of all units at the first global
+  // position of every target unit and the end of the range:
+  std::vector<std::size_t> g_ranks;
+  g_ranks.reserve(targets.size() + 1);
+  for (auto t : targets) {
+    g_ranks.push_back(u_ranges[t].g_offset);
+  }
+  g_ranks.push_back(last - first);
+  auto splits = dash::internal::sort_partition(
+                  l_sorted.data(), u_sizes, g_ranks, comp, team);
+
+  // Phase 3: every unit writes its partition for every target unit to the
+  // target unit's local memory, after the partitions of lower units:
+  std::vector<dart_handle_t> handles;
+  std::vector<std::size_t>   run_offsets;
+  for (std::size_t ti = 0; ti < targets.size(); ++ti) {
+    auto        t        = targets[ti];
+    const auto  split_lo = splits.data() + ti * nunits;
+    const auto  split_hi = splits.data() + (ti + 1) * nunits;
+    std::size_t t_offset = 0;
+    for (std::size_t u = 0; u < myid; ++u) {
+      t_offset += split_hi[u] - split_lo[u];
+    }
+    if (t == static_cast<std::size_t>(myid)) {
+      // Offsets of runs received from all units:
+      run_offsets.push_back(0);
+      for (std::size_t u = 0; u < nunits; ++u) {
+        run_offsets.push_back(run_offsets.back() +
+                              split_hi[u] - split_lo[u]);
+      }
+    }
+    auto nelem = split_hi[myid] - split_lo[myid];
+    if (nelem == 0) {
+      continue;
+    }
+    if (t == static_cast<std::size_t>(myid)) {
+      std::copy(l_sorted.begin() + split_lo[myid],
+                l_sorted.begin() + split_hi[myid],
+                l_mem + l_range.l_begin + t_offset);
+      continue;
+    }
+    DASH_LOG_TRACE("dash::sort", "put", nelem, "elements to unit", t,
+                   "at offset", t_offset);
+    auto           gptr   = first.globmem().at(
+                              team_unit_t(t),
+                              u_ranges[t].l_begin + t_offset).dart_gptr();
+    dart_storage_t ds     = dash::dart_storage<ElementType>(nelem);
+    dart_handle_t  handle;
+    DASH_ASSERT_RETURNS(
+      dart_put_handle(
+        gptr,
+        l_sorted.data() + split_lo[myid],
+        ds.nelem,
+        ds.dtype,
+        &handle),
+      DART_OK);
+    if (handle != NULL) {
+      handles.push_back(handle);
+    }
+  }
+  if (!handles.empty()) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall(handles.data(), handles.size()),
+      DART_OK);
+  }
+  team.barrier();
+
+  // Phase 4: merge sorted runs received from all units:
+  if (!run_offsets.empty()) {
+    run_offsets.erase(std::unique(run_offsets.begin(), run_offsets.end()),
+                      run_offsets.end());
+    dash::internal::merge_sorted_runs(
+      l_mem + l_range.l_begin, run_offsets, comp);
+  }
+  team.barrier();
+}
+
+/**
+ * Sorts the elements in the range \c [first, last) in ascending order.
+ *
+ * Collective operation.
+ *
+ * \see  dash::sort(GlobIter, GlobIter, Compare)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType >
+void sort(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last)
+{
+  dash::sort(first, last, std::less<ElementType>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SORT_H__INCLUDED
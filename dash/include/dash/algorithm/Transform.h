@@ -3,23 +3,24 @@
 
 #include <dash/GlobRef.h>
 #include <dash/GlobAsyncRef.h>
+#include <dash/Execution.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 #include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/internal/OwnerComputes.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/algorithm/internal/Reduce.h>
 
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/util/Trace.h>
 
 #include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
 
 #include <iterator>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
-
 namespace dash {
 
 /**
@@ -136,16 +137,18 @@ GlobOutputIt transform(
  */
 template<
   typename ValueType,
+  class ExecutionPolicy,
   class InputAIt,
   class InputBIt,
   class OutputIt,
   class BinaryOperation >
 OutputIt transform_local(
-  InputAIt        in_a_first,
-  InputAIt        in_a_last,
-  InputBIt        in_b_first,
-  OutputIt        out_first,
-  BinaryOperation binary_op)
+  const ExecutionPolicy & policy,
+  InputAIt                in_a_first,
+  InputAIt                in_a_last,
+  InputBIt                in_b_first,
+  OutputIt                out_first,
+  BinaryOperation         binary_op)
 {
   DASH_LOG_DEBUG("dash::transform_local()");
   DASH_ASSERT_MSG(in_a_first.pattern() == in_b_first.pattern(),
@@ -154,53 +157,64 @@ OutputIt transform_local(
   DASH_ASSERT_MSG(in_a_first.pattern() == out_first.pattern(),
                   "dash::transform_local: "
                   "distributions of input- and output ranges differ");
+  // Number of elements in global ranges:
+  auto num_gvalues       = dash::distance(in_a_first, in_a_last);
+  DASH_LOG_TRACE_VAR("dash::transform_local", num_gvalues);
   // Local subrange of input range a:
-  auto local_range_a   = dash::local_range(in_a_first, in_a_last);
-  ValueType * lbegin_a = local_range_a.begin;
-  ValueType * lend_a   = local_range_a.end;
+  auto local_range_a     = dash::local_range(in_a_first, in_a_last);
+  ValueType * lbegin_a   = local_range_a.begin;
+  ValueType * lend_a     = local_range_a.end;
   if (lbegin_a == lend_a) {
     // Local input range is empty, return initial output iterator to indicate
     // that no values have been transformed:
     DASH_LOG_DEBUG("dash::transform_local", "local range empty");
     return out_first;
   }
-  // Global offset of first local element:
-  auto g_offset_first    = in_a_first.pattern().global(0);
-  // Number of elements in global ranges:
-  auto num_gvalues       = dash::distance(in_a_first, in_b_first);
-  DASH_LOG_TRACE_VAR("dash::transform_local", num_gvalues);
   // Number of local elements:
-  DASH_LOG_TRACE("dash::transform_local", "local elements:", lend_a-lbegin_a);
+  std::size_t l_size     = lend_a - lbegin_a;
+  DASH_LOG_TRACE("dash::transform_local", "local elements:", l_size);
   // Local subrange of input range b:
-  ValueType * lbegin_b   = dash::local(in_b_first + g_offset_first);
+  auto in_b_last         = in_b_first + num_gvalues;
+  ValueType * lbegin_b   = dash::local_range(in_b_first, in_b_last).begin;
   // Local pointer of initial output element:
-  ValueType * lbegin_out = dash::local(out_first  + g_offset_first);
+  auto out_last          = out_first + num_gvalues;
+  ValueType * lbegin_out = dash::local_range(out_first, out_last).begin;
   // Generate output values:
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::transform_local", "thread capacity:",  n_threads);
-  if (n_threads > 1) {
-    auto l_size = lend_a - lbegin_a;
-    // TODO: Vectorize.
-    // Documentation of Intel MIC intrinsics, see:
-    // https://software.intel.com/de-de/node/523533
-    // https://software.intel.com/de-de/node/523387
-    #pragma omp parallel for num_threads(n_threads) schedule(static)
-    for (int i = 0; i < l_size; i++) {
+  dash::internal::local_parallel_for(
+    policy,
+    l_size,
+    [&](std::size_t i) {
       lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
-    }
-    return out_first + num_gvalues;
-  }
-#endif
-  // No OpenMP or insufficient number of threads for parallelization:
-  for (; lbegin_a != lend_a; ++lbegin_a, ++lbegin_b, ++lbegin_out) {
-    *lbegin_out = binary_op(*lbegin_a, *lbegin_b);
-  }
+    });
   // Return out_end iterator past final transformed element;
   return out_first + num_gvalues;
 }
 
+/**
+ * Transform operation on ranges with identical distribution and start
+ * offset, executing the local phase in execution policy
+ * \c dash::execution::par.
+ *
+ * \see dash::transform_local
+ */
+template<
+  typename ValueType,
+  class InputAIt,
+  class InputBIt,
+  class OutputIt,
+  class BinaryOperation >
+OutputIt transform_local(
+  InputAIt        in_a_first,
+  InputAIt        in_a_last,
+  InputBIt        in_b_first,
+  OutputIt        out_first,
+  BinaryOperation binary_op)
+{
+  return dash::transform_local<ValueType>(
+           dash::execution::par,
+           in_a_first, in_a_last, in_b_first, out_first, binary_op);
+}
+
 /**
  * Local lhs input ranges on global output range.
  *
@@ -275,41 +289,200 @@ GlobOutputIt transform(
 }
 
 /**
- * Specialization of \c dash::transform for global lhs input range.
+ * Apply a given function to every element in a global range and store the
+ * result in another global range, beginning at \c out_first, executing
+ * the local phase in the given execution policy.
+ *
+ * Owner-computes: every unit assigns the output elements in its local
+ * memory. Input elements are read in place if input and output range have
+ * identical distribution and start offset, otherwise they are fetched
+ * in blocks from the units owning them.
+ * The function is not executed atomically on elements, \c unary_op may be
+ * any function object. The output range must not overlap the input range
+ * unless both ranges are identical.
+ *
+ * \returns  Output iterator to the element past the last element
+ *           transformed.
+ *
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
  */
 template<
+  class ExecutionPolicy,
+  typename ValueType,
+  class PatternType,
+  class GlobOutputIt,
+  class UnaryOperation >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, GlobOutputIt>
+transform(
+  ExecutionPolicy               && policy,
+  GlobIter<ValueType, PatternType> in_first,
+  GlobIter<ValueType, PatternType> in_last,
+  GlobOutputIt                     out_first,
+  UnaryOperation                   unary_op)
+{
+  DASH_LOG_DEBUG("dash::transform(policy, gf, gl, goutf, unop)");
+  dash::util::Trace trace("transform");
+  trace.enter_state("owner_computes");
+  auto out_last = dash::internal::transform_owner_computes(
+                    policy,
+                    out_first,
+                    out_first + dash::distance(in_first, in_last),
+                    unary_op,
+                    in_first);
+  trace.exit_state("owner_computes");
+  return out_last;
+}
+
+/**
+ * Apply a given function to pairs of elements from two global ranges and
+ * store the result in another global range, beginning at \c out_first,
+ * executing the local phase in the given execution policy.
+ *
+ * Owner-computes: every unit assigns the output elements in its local
+ * memory. Input elements are read in place if all ranges have identical
+ * distribution and start offset, otherwise they are fetched in blocks
+ * from the units owning them.
+ * The function is not executed atomically on elements, \c binary_op may
+ * be any function object. The output range must not overlap the input
+ * ranges unless the overlapping ranges are identical.
+ *
+ * \returns  Output iterator to the element past the last element
+ *           transformed.
+ *
+ * \see      dash::zip_transform
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
   typename ValueType,
   class PatternType,
   class GlobInputIt,
   class GlobOutputIt,
   class BinaryOperation >
-GlobOutputIt transform(
+dash::internal::enable_if_execution_policy<ExecutionPolicy, GlobOutputIt>
+transform(
+  ExecutionPolicy               && policy,
   GlobIter<ValueType, PatternType> in_a_first,
   GlobIter<ValueType, PatternType> in_a_last,
   GlobInputIt                      in_b_first,
   GlobOutputIt                     out_first,
-  BinaryOperation                  binary_op = dash::plus<ValueType>())
+  BinaryOperation                  binary_op)
 {
-  DASH_LOG_DEBUG("dash::transform(gaf, gal, gbf, goutf, binop)");
-  auto in_first = in_a_first;
-  auto in_last  = in_a_last;
-  // dash::Array<ValueType> in_range;
-  if (in_b_first == out_first) {
-    // Output range is rhs input range: C += A
-    // Input is (in_a_first, in_a_last).
-  } else {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::transform is only implemented for out = op(in,out)");
-    // Output range different from rhs input range: C = A+B
-    // Input is (in_a_first, in_a_last) + (in_b_first, in_b_last):
+  DASH_LOG_DEBUG("dash::transform(policy, gaf, gal, gbf, goutf, binop)");
+  dash::util::Trace trace("transform");
+  trace.enter_state("owner_computes");
+  auto out_last = dash::internal::transform_owner_computes(
+                    policy,
+                    out_first,
+                    out_first + dash::distance(in_a_first, in_a_last),
+                    binary_op,
+                    in_a_first,
+                    in_b_first);
+  trace.exit_state("owner_computes");
+  return out_last;
+}
 
-    // TODO:
-    // in_range.allocate(...);
-    // in_first = in_range.begin();
-    // in_last  = in_range.end();
-  }
+/**
+ * Apply a given function to tuples of corresponding elements in any
+ * number of global input ranges and store the result in the global
+ * output range \c [out_first, out_last), executing the local phase in the
+ * given execution policy.
+ *
+ * Semantics:
+ *
+ *   out[i] = op(in_0[i], in_1[i], ..., in_n[i])
+ *
+ * Like binary \c dash::transform, the output is computed at the units
+ * owning the output elements, the intermediate results of nested
+ * operations are not stored in temporary ranges.
+ *
+ * Example:
+ * \code
+ *   // a = x * y + z
+ *   dash::zip_transform(dash::execution::par,
+ *                       a.begin(), a.end(),
+ *                       [](double x, double y, double z) {
+ *                         return x * y + z;
+ *                       },
+ *                       x.begin(), y.begin(), z.begin());
+ * \endcode
+ *
+ * \returns  Iterator \c out_last
+ *
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  class    GlobOutputIt,
+  class    Operation,
+  class... GlobInputIts >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, GlobOutputIt>
+zip_transform(
+  ExecutionPolicy  && policy,
+  GlobOutputIt        out_first,
+  GlobOutputIt        out_last,
+  Operation           op,
+  GlobInputIts ...    in_firsts)
+{
+  DASH_LOG_DEBUG("dash::zip_transform(policy, goutf, goutl, op, ginf...)");
+  dash::util::Trace trace("zip_transform");
+  trace.enter_state("owner_computes");
+  auto result = dash::internal::transform_owner_computes(
+                  policy, out_first, out_last, op, in_firsts...);
+  trace.exit_state("owner_computes");
+  return result;
+}
 
+/**
+ * Apply a given function to tuples of corresponding elements in any
+ * number of global input ranges and store the result in the global
+ * output range \c [out_first, out_last).
+ *
+ * \see      dash::zip_transform
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class    PatternType,
+  class    Operation,
+  class... GlobInputIts >
+GlobIter<ValueType, PatternType> zip_transform(
+  GlobIter<ValueType, PatternType>   out_first,
+  GlobIter<ValueType, PatternType>   out_last,
+  Operation                          op,
+  GlobInputIts ...                   in_firsts)
+{
+  return dash::zip_transform(dash::execution::par,
+                             out_first, out_last, op, in_firsts...);
+}
+
+namespace internal {
+
+/**
+ * Transform \c out = \c op(in, out) of global ranges as atomic
+ * \c dart_accumulate of local input elements.
+ */
+template<
+  typename ValueType,
+  class PatternType,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation >
+GlobOutputIt transform_accumulate(
+  GlobIter<ValueType, PatternType> in_a_first,
+  GlobIter<ValueType, PatternType> in_a_last,
+  GlobInputIt                      in_b_first,
+  GlobOutputIt                     out_first,
+  BinaryOperation                  binary_op,
+  std::true_type                   /* dart operation */)
+{
   dash::util::Trace trace("transform");
 
   // Pattern of input ranges a and b, and output range:
@@ -317,26 +490,6 @@ GlobOutputIt transform(
   auto pattern_in_b = in_b_first.pattern();
   auto pattern_out  = out_first.pattern();
 
-#if __NON_ATOMIC__
-  // Fast path: check if transform operation is local-only:
-  if (pattern_in_a == pattern_in_b &&
-      pattern_in_a == pattern_out) {
-    // Identical pattern in all ranges
-    if (in_a_first.pos() == in_b_first.pos() &&
-        in_a_first.pos() == out_first.pos()) {
-      trace.enter_state("local");
-      // All units operate on local ranges that have identical distribution:
-      auto out_last = dash::transform_local<ValueType>(
-                        in_a_first,
-                        in_a_last,
-                        in_b_first,
-                        out_first,
-                        binary_op);
-      trace.exit_state("local");
-      return out_last;
-    }
-  }
-#endif
   // Resolve teams from global iterators:
   dash::Team & team_in_a        = pattern_in_a.team();
   DASH_ASSERT_MSG(
@@ -374,6 +527,73 @@ GlobOutputIt transform(
   return out_first + global_offset + num_local_elements;
 }
 
+/**
+ * Transform \c out = \c op(in, out) of global ranges for operations
+ * without DART equivalent, computed by the owners of output elements.
+ */
+template<
+  typename ValueType,
+  class PatternType,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation >
+GlobOutputIt transform_accumulate(
+  GlobIter<ValueType, PatternType> in_a_first,
+  GlobIter<ValueType, PatternType> in_a_last,
+  GlobInputIt                      in_b_first,
+  GlobOutputIt                     out_first,
+  BinaryOperation                  binary_op,
+  std::false_type                  /* dart operation */)
+{
+  return dash::transform(dash::execution::par,
+                         in_a_first, in_a_last, in_b_first, out_first,
+                         binary_op);
+}
+
+} // namespace internal
+
+/**
+ * Specialization of \c dash::transform for global lhs input range.
+ *
+ * If the output range is the rhs input range (<tt>out = op(in, out)</tt>)
+ * and \c binary_op is a DASH reduce operation like \c dash::plus, local
+ * input elements are accumulated atomically into the output range.
+ * Otherwise, the transform is computed by the owners of output elements
+ * as in \c dash::transform with execution policy \c dash::execution::par.
+ */
+template<
+  typename ValueType,
+  class PatternType,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation >
+GlobOutputIt transform(
+  GlobIter<ValueType, PatternType> in_a_first,
+  GlobIter<ValueType, PatternType> in_a_last,
+  GlobInputIt                      in_b_first,
+  GlobOutputIt                     out_first,
+  BinaryOperation                  binary_op = dash::plus<ValueType>())
+{
+  DASH_LOG_DEBUG("dash::transform(gaf, gal, gbf, goutf, binop)");
+  // Iterators only compare positions, compare referenced elements:
+  dart_gptr_t in_b_gptr = in_b_first.dart_gptr();
+  dart_gptr_t out_gptr  = out_first.dart_gptr();
+  if (DART_GPTR_EQUAL(in_b_gptr, out_gptr)) {
+    // Output range is rhs input range: C += A
+    return dash::internal::transform_accumulate(
+             in_a_first, in_a_last, in_b_first, out_first, binary_op,
+             std::integral_constant<
+               bool,
+               dash::internal::reduce_dart_operation_of(
+                 static_cast<const BinaryOperation *>(nullptr))
+               != DART_OP_UNDEFINED >());
+  }
+  // Output range different from rhs input range: C = A+B
+  return dash::transform(dash::execution::par,
+                         in_a_first, in_a_last, in_b_first, out_first,
+                         binary_op);
+}
+
 /**
  * Specialization of \c dash::transform as non-blocking operation.
  *
@@ -0,0 +1,208 @@
+#ifndef DASH__ALGORITHM__TRANSFORM_REDUCE_H__INCLUDED
+#define DASH__ALGORITHM__TRANSFORM_REDUCE_H__INCLUDED
+
+#include <dash/Execution.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/OwnerComputes.h>
+#include <dash/algorithm/internal/Reduce.h>
+
+namespace dash {
+
+/**
+ * Applies \c transform_op to every element in the range
+ * \c [first, last) and reduces the results and \c init using the binary
+ * operation \c reduce_op, executing the local phase in the given
+ * execution policy.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * \see      dash::transform_reduce
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType>
+transform_reduce(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  ValueType          init,
+  BinaryOperation    reduce_op,
+  UnaryOperation     transform_op)
+{
+  typedef typename GlobInputIt::value_type element_t;
+
+  auto & team      = in_first.team();
+  auto index_range = dash::local_range(in_first, in_last);
+  auto l_result    = dash::internal::local_reduce<ValueType>(
+                       policy,
+                       index_range.begin,
+                       index_range.end,
+                       [&](const element_t & e) {
+                         return static_cast<ValueType>(transform_op(e));
+                       },
+                       reduce_op);
+  return dash::internal::team_reduce(l_result, init, reduce_op, team);
+}
+
+/**
+ * Applies \c transform_op to every element in the range
+ * \c [first, last) and reduces the results and \c init using the binary
+ * operation \c reduce_op.
+ *
+ * Unlike with \c dash::transform followed by \c dash::accumulate, the
+ * transformed values are not stored in a temporary range. The reduce
+ * operation must be associative. Reduce operations supported by DART
+ * like \c dash::plus and \c std::plus are combined in a single
+ * \c dart_allreduce.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) f(in[0]) (+) f(in[1]) (+) ... (+) f(in[n])
+ *
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+ValueType transform_reduce(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init,
+  BinaryOperation reduce_op,
+  UnaryOperation  transform_op)
+{
+  return dash::transform_reduce(dash::execution::par, in_first, in_last,
+                                init, reduce_op, transform_op);
+}
+
+/**
+ * Applies \c transform_op to pairs of corresponding elements in the
+ * ranges \c [in_a_first, in_a_last) and \c [in_b_first, ...) and reduces
+ * the results and \c init using the binary operation \c reduce_op,
+ * executing the local phase in the given execution policy.
+ *
+ * Every unit transforms and reduces the elements of the first range in
+ * its local memory. Corresponding elements of the second range are read
+ * in place if both ranges have identical distribution and start offset,
+ * otherwise they are fetched in blocks from the units owning them.
+ * Transformed values are never stored. The ranges must have
+ * one-dimensional patterns.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) f(a[0], b[0]) (+) f(a[1], b[1]) (+) ... (+) f(a[n], b[n])
+ *
+ * \see      dash::transform_reduce
+ * \see      DashExecutionPolicies
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename ElementType,
+  class PatternType,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryReduceOperation,
+  class BinaryTransformOperation >
+dash::internal::enable_if_execution_policy<ExecutionPolicy, ValueType>
+transform_reduce(
+  ExecutionPolicy                  && policy,
+  GlobIter<ElementType, PatternType>  in_a_first,
+  GlobIter<ElementType, PatternType>  in_a_last,
+  GlobInputIt                         in_b_first,
+  ValueType                           init,
+  BinaryReduceOperation               reduce_op,
+  BinaryTransformOperation            transform_op)
+{
+  static_assert(
+    PatternType::ndim() == 1,
+    "dash::transform_reduce of two ranges requires one-dimensional "
+    "patterns");
+  typedef typename PatternType::index_type index_t;
+
+  auto & team = in_a_first.team();
+  auto l_a = in_a_first.globmem().lbegin(dash::Team::GlobalUnitID());
+  dash::internal::LocalReduceResult<ValueType> l_result { init, false };
+  dash::internal::for_each_local_run(
+    in_a_first,
+    in_a_last,
+    [&](const dash::internal::LocalRun<index_t> & run) {
+      const ElementType * l_a_run = l_a + run.l_offset;
+      dash::internal::RunInput<GlobInputIt> in_b(
+        in_b_first + (run.g_offset - in_a_first.pos()),
+        run.size);
+      auto run_result = dash::internal::local_reduce<ValueType>(
+                          policy,
+                          l_a_run,
+                          l_a_run + run.size,
+                          [&](const ElementType & a) {
+                            return static_cast<ValueType>(
+                                     transform_op(
+                                       a, in_b.values()[&a - l_a_run]));
+                          },
+                          reduce_op);
+      if (run_result.valid) {
+        l_result.value = l_result.valid
+                         ? reduce_op(l_result.value, run_result.value)
+                         : run_result.value;
+        l_result.valid = true;
+      }
+    });
+  return dash::internal::team_reduce(l_result, init, reduce_op, team);
+}
+
+/**
+ * Applies \c transform_op to pairs of corresponding elements in the
+ * ranges \c [in_a_first, in_a_last) and \c [in_b_first, ...) and reduces
+ * the results and \c init using the binary operation \c reduce_op.
+ *
+ * Like \c std::inner_product, but the reduce operation must be
+ * associative.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * \see      dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class PatternType,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryReduceOperation,
+  class BinaryTransformOperation >
+ValueType transform_reduce(
+  GlobIter<ElementType, PatternType>  in_a_first,
+  GlobIter<ElementType, PatternType>  in_a_last,
+  GlobInputIt                         in_b_first,
+  ValueType                           init,
+  BinaryReduceOperation               reduce_op,
+  BinaryTransformOperation            transform_op)
+{
+  return dash::transform_reduce(dash::execution::par,
+                                in_a_first, in_a_last, in_b_first,
+                                init, reduce_op, transform_op);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__TRANSFORM_REDUCE_H__INCLUDED
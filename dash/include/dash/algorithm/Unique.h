@@ -0,0 +1,168 @@
+#ifndef DASH__ALGORITHM__UNIQUE_H__INCLUDED
+#define DASH__ALGORITHM__UNIQUE_H__INCLUDED
+
+#include <dash/Execution.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Compact.h>
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Removes all but the first element from every group of consecutive
+ * elements in the range \c [first, last) for which \c predicate returns
+ * \c true, executing the local phase in the given execution policy.
+ * Returns an iterator to the new end of the range.
+ *
+ * Every unit compares its first local element in the range with the
+ * preceding element at another unit, which is fetched before elements are
+ * moved. Remaining elements are redistributed like in
+ * \c dash::remove_if, values of elements behind the returned iterator are
+ * unspecified.
+ *
+ * The local elements of every unit in the range must be a contiguous
+ * subrange.
+ *
+ * Collective operation.
+ *
+ * \throws  dash::exception::InvalidArgument  if the local elements of a
+ *          unit in the range are not contiguous
+ *
+ * \see      dash::remove_if
+ * \see      DashExecutionPolicies
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    BinaryPredicate >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+unique(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate returning true if two elements are equivalent
+  BinaryPredicate                      predicate)
+{
+  if (first >= last) {
+    return last;
+  }
+  // Fetch the element preceding the unit's local elements in the range:
+  // Holds the preceding element if it exists, so ElementType is not
+  // required to be default-constructible:
+  auto                     index_range = dash::local_index_range(first, last);
+  std::vector<ElementType> prev;
+  if (index_range.begin < index_range.end) {
+    auto g_offset = first.pattern().global(index_range.begin)
+                    - first.pos();
+    if (g_offset > 0) {
+      prev.push_back(static_cast<ElementType>(first[g_offset - 1]));
+    }
+  }
+  bool has_prev = !prev.empty();
+  auto n_kept = dash::internal::compact(
+                  policy, first, last,
+                  [&](const ElementType * l_first, std::size_t i) {
+                    if (i > 0) {
+                      return !predicate(l_first[i - 1], l_first[i]);
+                    }
+                    return !has_prev || !predicate(prev.front(), l_first[0]);
+                  },
+                  false);
+  DASH_LOG_DEBUG("dash::unique", "remaining elements:", n_kept);
+  return first + n_kept;
+}
+
+/**
+ * Removes all but the first element from every group of consecutive
+ * elements in the range \c [first, last) for which \c predicate returns
+ * \c true.
+ * Returns an iterator to the new end of the range.
+ *
+ * Collective operation.
+ *
+ * \see      dash::unique(ExecutionPolicy &&, GlobIter, GlobIter, BinaryPredicate)
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    BinaryPredicate >
+GlobIter<ElementType, PatternType> unique(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate returning true if two elements are equivalent
+  BinaryPredicate                      predicate)
+{
+  return dash::unique(dash::execution::par, first, last, predicate);
+}
+
+/**
+ * Removes all but the first element from every group of consecutive
+ * equal elements in the range \c [first, last), executing the local phase
+ * in the given execution policy.
+ * Returns an iterator to the new end of the range.
+ *
+ * Collective operation.
+ *
+ * \see      dash::unique(ExecutionPolicy &&, GlobIter, GlobIter, BinaryPredicate)
+ * \see      DashExecutionPolicies
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType >
+dash::internal::enable_if_execution_policy<
+  ExecutionPolicy,
+  GlobIter<ElementType, PatternType> >
+unique(
+  /// Execution policy of the local phase
+  ExecutionPolicy                   && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last)
+{
+  return dash::unique(policy, first, last, std::equal_to<ElementType>());
+}
+
+/**
+ * Removes all but the first element from every group of consecutive
+ * equal elements in the range \c [first, last).
+ * Returns an iterator to the new end of the range.
+ *
+ * Collective operation.
+ *
+ * \see      dash::unique(ExecutionPolicy &&, GlobIter, GlobIter, BinaryPredicate)
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType >
+GlobIter<ElementType, PatternType> unique(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last)
+{
+  return dash::unique(dash::execution::par, first, last,
+                      std::equal_to<ElementType>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__UNIQUE_H__INCLUDED
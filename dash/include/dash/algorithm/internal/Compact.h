@@ -0,0 +1,207 @@
+#ifndef DASH__ALGORITHM__INTERNAL__COMPACT_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__COMPACT_H__INCLUDED
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/algorithm/internal/Subrange.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Moves the elements in the range \c [first, last) for which
+ * \c keep(l_first, i) returns true to the beginning of the range,
+ * preserving their relative order, where \c l_first points to the calling
+ * unit's first local element in the range and \c i is the offset of the
+ * element from \c l_first.
+ * If \c keep_rest is true, the remaining elements are moved behind the
+ * kept elements in their relative order, otherwise their values after the
+ * kept elements are unspecified.
+ * Returns the number of kept elements.
+ *
+ * Compaction proceeds in three phases:
+ *
+ * 1. Every unit copies its kept and remaining local elements to a buffer,
+ *    in parallel chunks in the given execution policy.
+ * 2. Units exchange the number of their kept elements and compute the
+ *    offset of their kept elements in the range from the counts of units
+ *    preceding them.
+ * 3. Every unit writes its kept elements to the units owning their target
+ *    positions, in a single one-sided put per target unit.
+ *
+ * \c keep is evaluated exactly once per element and must not modify the
+ * range. The local elements of every unit in the range must be a
+ * contiguous subrange, like in one-dimensional \c dash::BLOCKED
+ * distributions.
+ *
+ * Collective operation.
+ *
+ * \throws  dash::exception::InvalidArgument  if the local elements of a
+ *          unit in the range are not contiguous
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    KeepFunction >
+std::size_t compact(
+  const ExecutionPolicy              & policy,
+  GlobIter<ElementType, PatternType>   first,
+  GlobIter<ElementType, PatternType>   last,
+  KeepFunction                         keep,
+  bool                                 keep_rest)
+{
+  typedef typename PatternType::index_type index_t;
+
+  static_assert(
+    PatternType::ndim() == 1,
+    "dash::internal::compact requires a one-dimensional range");
+  static_assert(
+    std::is_trivially_copyable<ElementType>::value,
+    "dash::internal::compact requires trivially copyable element type");
+
+  struct unit_range_t : unit_subrange<index_t> {
+    /// Number of the unit's elements that are kept
+    std::size_t n_kept;
+  };
+
+  if (first >= last) {
+    return 0;
+  }
+  auto & team = first.team();
+  auto   myid = team.myid();
+  ElementType * l_mem = first.globmem().lbegin();
+
+  unit_range_t             l_range;
+  unit_subrange<index_t> & l_subrange = l_range;
+  l_subrange     = local_subrange(first, last);
+  l_range.n_kept = 0;
+
+  // Phase 1: copy kept and remaining local elements in chunks of threads,
+  // the local elements are overwritten by other units in phase 3:
+  const ElementType * l_first   = l_mem + l_range.l_begin;
+  int                 n_threads = local_num_threads(policy, l_range.l_size);
+  std::vector< std::vector<ElementType> > t_kept(n_threads);
+  std::vector< std::vector<ElementType> > t_rest(n_threads);
+  local_parallel_chunks(
+    n_threads,
+    l_range.l_size,
+    [&](int t_id, std::size_t begin, std::size_t end) {
+      auto & kept = t_kept[t_id];
+      auto & rest = t_rest[t_id];
+      kept.reserve(end - begin);
+      for (std::size_t i = begin; i < end; ++i) {
+        if (keep(l_first, i)) {
+          kept.push_back(l_first[i]);
+        } else if (keep_rest) {
+          rest.push_back(l_first[i]);
+        }
+      }
+    });
+  std::vector<ElementType> l_buf;
+  l_buf.reserve(l_range.l_size);
+  for (auto & kept : t_kept) {
+    l_buf.insert(l_buf.end(), kept.begin(), kept.end());
+  }
+  l_range.n_kept = l_buf.size();
+  for (auto & rest : t_rest) {
+    l_buf.insert(l_buf.end(), rest.begin(), rest.end());
+  }
+  DASH_LOG_TRACE("dash::internal::compact", "l_begin:", l_range.l_begin,
+                 "l_size:", l_range.l_size, "g_offset:", l_range.g_offset,
+                 "kept:", l_range.n_kept);
+
+  // Phase 2: local ranges and kept counts of all units, also ensures that
+  // every unit copied its local elements:
+  auto u_ranges = gather_subranges(l_range, team,
+                                   "dash::internal::compact");
+  // Units with elements in the range in order of their subranges:
+  auto targets  = subrange_units(u_ranges);
+  // Exclusive scan of kept and remaining counts in order of subranges:
+  std::size_t n_kept      = 0;
+  std::size_t kept_offset = 0;
+  std::size_t rest_offset = 0;
+  for (auto t : targets) {
+    if (u_ranges[t].g_offset < l_range.g_offset) {
+      kept_offset += u_ranges[t].n_kept;
+      rest_offset += u_ranges[t].l_size - u_ranges[t].n_kept;
+    }
+    n_kept += u_ranges[t].n_kept;
+  }
+  rest_offset += n_kept;
+  DASH_LOG_TRACE("dash::internal::compact", "total kept:", n_kept,
+                 "kept offset:", kept_offset, "rest offset:", rest_offset);
+
+  // Phase 3: write the elements in [src, src + nelem) to the range
+  // positions starting at offset dst, one put per target unit:
+  std::vector<dart_handle_t> handles;
+  auto put_elements = [&](const ElementType * src,
+                          std::size_t         dst,
+                          std::size_t         nelem) {
+    for (auto t : targets) {
+      std::size_t t_begin = u_ranges[t].g_offset;
+      std::size_t t_end   = t_begin + u_ranges[t].l_size;
+      std::size_t o_begin = std::max(dst, t_begin);
+      std::size_t o_end   = std::min(dst + nelem, t_end);
+      if (o_begin >= o_end) {
+        continue;
+      }
+      const ElementType * o_src   = src + (o_begin - dst);
+      std::size_t         t_index = u_ranges[t].l_begin + (o_begin - t_begin);
+      if (t == static_cast<std::size_t>(myid)) {
+        std::copy(o_src, o_src + (o_end - o_begin), l_mem + t_index);
+        continue;
+      }
+      DASH_LOG_TRACE("dash::internal::compact", "put", o_end - o_begin,
+                     "elements to unit", t, "at local index", t_index);
+      auto           gptr   = first.globmem().at(
+                                team_unit_t(t), t_index).dart_gptr();
+      dart_storage_t ds     = dash::dart_storage<ElementType>(
+                                o_end - o_begin);
+      dart_handle_t  handle;
+      DASH_ASSERT_RETURNS(
+        dart_put_handle(
+          gptr,
+          o_src,
+          ds.nelem,
+          ds.dtype,
+          &handle),
+        DART_OK);
+      if (handle != NULL) {
+        handles.push_back(handle);
+      }
+    }
+  };
+  put_elements(l_buf.data(), kept_offset, l_range.n_kept);
+  if (keep_rest) {
+    put_elements(l_buf.data() + l_range.n_kept, rest_offset,
+                 l_range.l_size - l_range.n_kept);
+  }
+  if (!handles.empty()) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall(handles.data(), handles.size()),
+      DART_OK);
+  }
+  team.barrier();
+  return n_kept;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__COMPACT_H__INCLUDED
@@ -0,0 +1,376 @@
+#ifndef DASH__ALGORITHM__INTERNAL__OWNER_COMPUTES_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__OWNER_COMPUTES_H__INCLUDED
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Elements of a global range in the calling unit's local memory that are
+ * contiguous both in local memory and in global index space.
+ */
+template< typename IndexType >
+struct LocalRun
+{
+  /// Local offset of the run's first element.
+  IndexType l_offset;
+  /// Global index of the run's first element.
+  IndexType g_offset;
+  /// Number of elements in the run.
+  IndexType size;
+};
+
+/**
+ * Number of elements in the longest run of at most \c max_size local
+ * elements starting at local offset \c l_offset with consecutive global
+ * indices.
+ *
+ * Expects global indices to increase with local offsets, as in
+ * one-dimensional patterns.
+ */
+template< class PatternType >
+typename PatternType::index_type local_run_size(
+  const PatternType                & pattern,
+  typename PatternType::index_type   l_offset,
+  typename PatternType::index_type   max_size)
+{
+  typedef typename PatternType::index_type index_t;
+  index_t g_offset   = pattern.global(l_offset);
+  auto    contiguous = [&](index_t size) {
+                         return pattern.global(l_offset + size - 1)
+                                == g_offset + size - 1;
+                       };
+  if (contiguous(max_size)) {
+    return max_size;
+  }
+  // Runs of size lo are contiguous, runs of size hi are not:
+  index_t lo = 1;
+  index_t hi = max_size;
+  while (hi - lo > 1) {
+    index_t mid = lo + (hi - lo) / 2;
+    if (contiguous(mid)) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/**
+ * Number of elements in the longest run of at most \c max_size elements
+ * starting at the position of \c first that are stored contiguously at a
+ * single unit.
+ *
+ * Expects global indices to increase with local offsets, as in
+ * one-dimensional patterns.
+ */
+template< class GlobIterType >
+typename GlobIterType::index_type global_run_size(
+  const GlobIterType                & first,
+  typename GlobIterType::index_type   max_size)
+{
+  typedef typename GlobIterType::index_type index_t;
+  auto first_lpos    = first.lpos();
+  auto contiguous    = [&](index_t size) {
+                         auto last_lpos = (first + (size - 1)).lpos();
+                         return last_lpos.unit  == first_lpos.unit &&
+                                last_lpos.index == first_lpos.index
+                                                   + size - 1;
+                       };
+  if (contiguous(max_size)) {
+    return max_size;
+  }
+  index_t lo = 1;
+  index_t hi = max_size;
+  while (hi - lo > 1) {
+    index_t mid = lo + (hi - lo) / 2;
+    if (contiguous(mid)) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/**
+ * Invokes \c run_func(run) for every \c dash::internal::LocalRun of the
+ * calling unit's elements in the global range \c [first, last), in
+ * ascending order of global indices.
+ *
+ * Expects global indices to increase with local offsets, as in
+ * one-dimensional patterns.
+ */
+template<
+  class GlobIterType,
+  class RunFunction >
+void for_each_local_run(
+  const GlobIterType & first,
+  const GlobIterType & last,
+  RunFunction          run_func)
+{
+  typedef typename GlobIterType::index_type index_t;
+  auto &  pattern = first.pattern();
+  index_t g_first = first.pos();
+  index_t g_last  = last.pos();
+  index_t l_size  = pattern.local_size();
+  // Skip local elements preceding the range, global indices increase
+  // with local offsets:
+  index_t l_first = 0;
+  index_t l_count = l_size;
+  while (l_count > 0) {
+    index_t step = l_count / 2;
+    if (pattern.global(l_first + step) < g_first) {
+      l_first += step + 1;
+      l_count -= step + 1;
+    } else {
+      l_count  = step;
+    }
+  }
+  for (index_t l = l_first; l < l_size; ) {
+    index_t g = pattern.global(l);
+    if (g >= g_last) {
+      break;
+    }
+    index_t run_size = std::min<index_t>(
+                         local_run_size(pattern, l, l_size - l),
+                         g_last - g);
+    DASH_LOG_TRACE("dash::internal::for_each_local_run",
+                   "l_offset:", l, "g_offset:", g, "size:", run_size);
+    run_func(LocalRun<index_t> { l, g, run_size });
+    l += run_size;
+  }
+}
+
+/**
+ * Values of an input range of an owner-computes algorithm corresponding to
+ * a \c dash::internal::LocalRun of the output range.
+ *
+ * Values in the calling unit's local memory are referenced in place,
+ * values at other units are fetched into a buffer, one non-blocking get
+ * per contiguous block of remote elements.
+ */
+template< class GlobInputIt >
+class RunInput
+{
+private:
+  typedef typename GlobInputIt::value_type value_type;
+  typedef typename GlobInputIt::index_type index_type;
+
+public:
+  /**
+   * Input values in local memory.
+   */
+  explicit RunInput(const value_type * l_values)
+  : _values(l_values)
+  { }
+
+  /**
+   * Input values in the global range of \c num_values elements starting
+   * at \c in_first.
+   */
+  RunInput(
+    const GlobInputIt & in_first,
+    index_type          num_values)
+  : _values(nullptr)
+  {
+    std::vector<dart_handle_t> handles;
+    for (index_type num_copied = 0; num_copied < num_values; ) {
+      auto       seg_first = in_first + num_copied;
+      index_type seg_size  = global_run_size(
+                               seg_first, num_values - num_copied);
+      auto       l_seg     = seg_first.local();
+      if (seg_size == num_values && l_seg != nullptr) {
+        // All input values are contiguous in local memory:
+        _values = l_seg;
+        return;
+      }
+      _buffer.resize(num_values);
+      if (l_seg != nullptr) {
+        std::copy(l_seg, l_seg + seg_size, _buffer.data() + num_copied);
+      } else {
+        DASH_LOG_TRACE("dash::internal::RunInput",
+                       "get", seg_size, "elements from",
+                       seg_first.lpos().unit);
+        dart_handle_t  handle;
+        dart_storage_t ds = dash::dart_storage<value_type>(seg_size);
+        DASH_ASSERT_RETURNS(
+          dart_get_handle(
+            _buffer.data() + num_copied,
+            seg_first.dart_gptr(),
+            ds.nelem,
+            ds.dtype,
+            &handle),
+          DART_OK);
+        handles.push_back(handle);
+      }
+      num_copied += seg_size;
+    }
+    if (!handles.empty()) {
+      DASH_ASSERT_RETURNS(
+        dart_waitall(handles.data(), handles.size()),
+        DART_OK);
+    }
+    _values = _buffer.data();
+  }
+
+  RunInput(const RunInput & other) = delete;
+  RunInput & operator=(const RunInput & other) = delete;
+
+  /**
+   * Pointer to the first input value.
+   */
+  const value_type * values() const
+  {
+    return _values;
+  }
+
+private:
+  std::vector<value_type> _buffer;
+  const value_type *      _values;
+};
+
+/**
+ * Whether two global iterators refer to ranges with identical
+ * distribution and start offset.
+ */
+template< class GlobIterType >
+bool aligned(
+  const GlobIterType & a,
+  const GlobIterType & b)
+{
+  return a.pattern() == b.pattern() && a.pos() == b.pos();
+}
+
+template< class GlobIterTypeA, class GlobIterTypeB >
+bool aligned(
+  const GlobIterTypeA & /* a */,
+  const GlobIterTypeB & /* b */)
+{
+  return false;
+}
+
+template< class GlobOutputIt >
+bool all_aligned(
+  const GlobOutputIt & /* out_first */)
+{
+  return true;
+}
+
+/**
+ * Whether all input ranges have the same distribution and start offset as
+ * the output range.
+ */
+template<
+  class    GlobOutputIt,
+  class    GlobInputIt,
+  class... GlobInputIts >
+bool all_aligned(
+  const GlobOutputIt   & out_first,
+  const GlobInputIt    & in_first,
+  const GlobInputIts & ... in_firsts)
+{
+  return aligned(out_first, in_first) && all_aligned(out_first, in_firsts...);
+}
+
+/**
+ * Assigns \c op(in_0[i], in_1[i], ...) to \c l_out[i] for every index
+ * \c i in \c [0, size) in the given execution policy.
+ */
+template<
+  class    ExecutionPolicy,
+  class    OutputType,
+  class    Operation,
+  class... GlobInputIts >
+void transform_run(
+  const ExecutionPolicy             & policy,
+  OutputType                        * l_out,
+  std::size_t                         size,
+  Operation                         & op,
+  const RunInput<GlobInputIts>    & ... inputs)
+{
+  local_parallel_for(
+    policy,
+    size,
+    [&](std::size_t i) {
+      l_out[i] = op(inputs.values()[i]...);
+    });
+}
+
+/**
+ * Owner-computes transform of the output range \c [out_first, out_last)
+ * from input ranges of identical size starting at \c in_firsts.
+ *
+ * Every unit only writes output elements in its local memory.
+ * If all ranges have identical distribution and start offset, input
+ * values are read in place. Otherwise, remote input values corresponding
+ * to every contiguous run of local output elements are fetched in
+ * blocks. The output range must have a one-dimensional pattern.
+ */
+template<
+  class    ExecutionPolicy,
+  class    GlobOutputIt,
+  class    Operation,
+  class... GlobInputIts >
+GlobOutputIt transform_owner_computes(
+  const ExecutionPolicy & policy,
+  GlobOutputIt            out_first,
+  GlobOutputIt            out_last,
+  Operation               op,
+  GlobInputIts ...        in_firsts)
+{
+  typedef typename GlobOutputIt::index_type index_t;
+  typedef typename GlobOutputIt::pattern_type pattern_t;
+  static_assert(
+    pattern_t::ndim() == 1,
+    "dash::transform with owner-computes requires one-dimensional "
+    "patterns");
+
+  index_t num_values = dash::distance(out_first, out_last);
+  if (num_values <= 0) {
+    return out_last;
+  }
+  if (all_aligned(out_first, in_firsts...)) {
+    DASH_LOG_DEBUG("dash::internal::transform_owner_computes", "aligned");
+    auto l_out = dash::local_range(out_first, out_last);
+    transform_run(
+      policy, l_out.begin, l_out.end - l_out.begin, op,
+      RunInput<GlobInputIts>(
+        dash::local_range(in_firsts, in_firsts + num_values).begin)...);
+    return out_last;
+  }
+  DASH_LOG_DEBUG("dash::internal::transform_owner_computes", "unaligned");
+  auto l_out = out_first.globmem().lbegin(dash::Team::GlobalUnitID());
+  for_each_local_run(
+    out_first,
+    out_last,
+    [&](const LocalRun<index_t> & run) {
+      index_t offset = run.g_offset - out_first.pos();
+      transform_run(
+        policy, l_out + run.l_offset, run.size, op,
+        RunInput<GlobInputIts>(in_firsts + offset, run.size)...);
+    });
+  return out_last;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__OWNER_COMPUTES_H__INCLUDED
@@ -0,0 +1,172 @@
+#ifndef DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
+
+#include <dash/internal/Config.h>
+
+#include <dash/Execution.h>
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <cstddef>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <dash/util/UnitLocality.h>
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Minimum number of local elements for which the local phase of an
+ * algorithm is distributed to threads.
+ */
+constexpr std::size_t parallel_min_elements_per_thread = 10240;
+
+/**
+ * Number of threads processing a local range of \c l_size elements in
+ * the given execution policy.
+ */
+template< class ExecutionPolicy >
+int local_num_threads(
+  const ExecutionPolicy & /* policy */,
+  std::size_t             l_size)
+{
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  return std::max<int>(
+           1,
+           std::min<std::size_t>(
+             uloc.num_domain_threads(),
+             l_size / parallel_min_elements_per_thread));
+#else
+  return 1;
+#endif
+}
+
+inline int local_num_threads(
+  const dash::execution::sequenced_policy & /* policy */,
+  std::size_t                               /* l_size */)
+{
+  return 1;
+}
+
+/**
+ * Index range \c [begin, end) of a thread's chunk in a local range.
+ */
+struct LocalChunk
+{
+  std::size_t begin;
+  std::size_t end;
+};
+
+/**
+ * The chunk of thread \c t_id in a local range of \c l_size elements
+ * partitioned to \c n_threads threads.
+ * Chunks are contiguous and assigned in ascending order of thread ids,
+ * as in OpenMP loops with \c schedule(static).
+ */
+inline LocalChunk local_chunk(
+  int         t_id,
+  int         n_threads,
+  std::size_t l_size)
+{
+  std::size_t t_chunk = (l_size + n_threads - 1) / n_threads;
+  std::size_t t_begin = std::min<std::size_t>(t_id * t_chunk, l_size);
+  std::size_t t_end   = std::min<std::size_t>(t_begin + t_chunk, l_size);
+  return LocalChunk { t_begin, t_end };
+}
+
+/**
+ * Invokes \c chunk_func(t_id, begin, end) for the chunk of every thread
+ * in a local range of \c l_size elements partitioned to \c n_threads
+ * threads.
+ * Threads are bound close to the unit's cores so a chunk is processed on
+ * the same core in all algorithms, independent of the number of threads
+ * actually provided by the OpenMP runtime.
+ */
+template< class ChunkFunction >
+void local_parallel_chunks(
+  int           n_threads,
+  std::size_t   l_size,
+  ChunkFunction chunk_func)
+{
+#ifdef DASH_ENABLE_OPENMP
+  if (n_threads > 1) {
+    DASH_LOG_TRACE("dash::internal::local_parallel_chunks",
+                   "elements:", l_size, "threads:", n_threads);
+#if DASH__OPENMP_VERSION >= 40
+    #pragma omp parallel num_threads(n_threads) proc_bind(close)
+#else
+    #pragma omp parallel num_threads(n_threads)
+#endif
+    {
+      for (int t_id = omp_get_thread_num(); t_id < n_threads;
+           t_id += omp_get_num_threads()) {
+        auto chunk = local_chunk(t_id, n_threads, l_size);
+        chunk_func(t_id, chunk.begin, chunk.end);
+      }
+    }
+    return;
+  }
+#endif // DASH_ENABLE_OPENMP
+  chunk_func(0, 0, l_size);
+}
+
+/**
+ * Invokes \c index_func(i) for every index in \c [begin, end) in order.
+ */
+template< class ExecutionPolicy, class IndexFunction >
+void local_for(
+  const ExecutionPolicy & /* policy */,
+  std::size_t             begin,
+  std::size_t             end,
+  IndexFunction         & index_func)
+{
+  for (std::size_t i = begin; i < end; ++i) {
+    index_func(i);
+  }
+}
+
+/**
+ * Invokes \c index_func(i) for every index in \c [begin, end),
+ * vectorized if supported by the OpenMP implementation.
+ */
+template< class IndexFunction >
+void local_for(
+  const dash::execution::parallel_unsequenced_policy & /* policy */,
+  std::size_t                                          begin,
+  std::size_t                                          end,
+  IndexFunction                                      & index_func)
+{
+#if DASH__OPENMP_VERSION >= 40
+  #pragma omp simd
+#endif
+  for (std::size_t i = begin; i < end; ++i) {
+    index_func(i);
+  }
+}
+
+/**
+ * Invokes \c index_func(i) for every index in \c [0, l_size) in the given
+ * execution policy.
+ */
+template< class ExecutionPolicy, class IndexFunction >
+void local_parallel_for(
+  const ExecutionPolicy & policy,
+  std::size_t             l_size,
+  IndexFunction           index_func)
+{
+  local_parallel_chunks(
+    local_num_threads(policy, l_size),
+    l_size,
+    [&](int, std::size_t begin, std::size_t end) {
+      local_for(policy, begin, end, index_func);
+    });
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
@@ -0,0 +1,445 @@
+#ifndef DASH__ALGORITHM__INTERNAL__REDUCE_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__REDUCE_H__INCLUDED
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+template< typename ValueType, dart_operation_t OP >
+constexpr dart_operation_t reduce_dart_operation_of(
+  const dash::ReduceOperation<ValueType, OP> *)
+{
+  return OP;
+}
+
+constexpr dart_operation_t reduce_dart_operation_of(const void *)
+{
+  return DART_OP_UNDEFINED;
+}
+
+/**
+ * The DART reduce operation equivalent to a binary operation, or
+ * \c DART_OP_UNDEFINED if the operation or the value type is not
+ * supported by DART.
+ */
+template< typename ValueType, class BinaryOperation >
+struct dart_reduce_operation
+{
+  static constexpr dart_operation_t value =
+    (dash::dart_datatype<ValueType>::value == DART_TYPE_UNDEFINED)
+    ? DART_OP_UNDEFINED
+    : reduce_dart_operation_of(
+        static_cast<const BinaryOperation *>(nullptr));
+};
+
+#define DASH__INTERNAL__DART_REDUCE_OPERATION(StdOp, DartOp)         \
+template< typename ValueType, typename OpValueType >                 \
+struct dart_reduce_operation<ValueType, StdOp<OpValueType> >          \
+{                                                                     \
+  static constexpr dart_operation_t value =                           \
+    (dash::dart_datatype<ValueType>::value == DART_TYPE_UNDEFINED)    \
+    ? DART_OP_UNDEFINED                                               \
+    : DartOp;                                                         \
+};
+
+DASH__INTERNAL__DART_REDUCE_OPERATION(std::plus,        DART_OP_SUM)
+DASH__INTERNAL__DART_REDUCE_OPERATION(std::multiplies,  DART_OP_PROD)
+DASH__INTERNAL__DART_REDUCE_OPERATION(std::logical_and, DART_OP_LAND)
+DASH__INTERNAL__DART_REDUCE_OPERATION(std::logical_or,  DART_OP_LOR)
+DASH__INTERNAL__DART_REDUCE_OPERATION(std::bit_and,     DART_OP_BAND)
+DASH__INTERNAL__DART_REDUCE_OPERATION(std::bit_or,      DART_OP_BOR)
+DASH__INTERNAL__DART_REDUCE_OPERATION(std::bit_xor,     DART_OP_BXOR)
+
+#undef DASH__INTERNAL__DART_REDUCE_OPERATION
+
+/**
+ * Identity element of a DART reduce operation.
+ * Infinities are the identity of minimum and maximum for types that
+ * have them, so ranges of only infinite values are not exceeded.
+ */
+template< typename ValueType >
+ValueType reduce_identity(dart_operation_t op)
+{
+  typedef std::numeric_limits<ValueType> limits;
+  switch (op) {
+    case DART_OP_MIN  : return limits::has_infinity
+                               ? limits::infinity()
+                               : limits::max();
+    case DART_OP_MAX  : return limits::has_infinity
+                               ? -limits::infinity()
+                               : limits::lowest();
+    case DART_OP_PROD :
+    case DART_OP_LAND : return ValueType(1);
+    case DART_OP_BAND : return static_cast<ValueType>(~0ll);
+    default           : return ValueType(0);
+  }
+}
+
+/**
+ * Result of the local phase of a reduction.
+ */
+template< typename ValueType >
+struct LocalReduceResult
+{
+  ValueType value;
+  /// Whether \c value is the result of at least one element.
+  bool      valid;
+};
+
+/**
+ * Reduces the elements in the local range \c [l_first, l_last) using
+ * \c op in the given execution policy.
+ * The operation must be associative.
+ */
+template<
+  typename ValueType,
+  class    ExecutionPolicy,
+  class    LocalInputIt,
+  class    UnaryFunction,
+  class    BinaryOperation >
+LocalReduceResult<ValueType> local_reduce(
+  const ExecutionPolicy & policy,
+  LocalInputIt            l_first,
+  LocalInputIt            l_last,
+  UnaryFunction           unary_op,
+  BinaryOperation         op)
+{
+  LocalReduceResult<ValueType> l_result { ValueType(), false };
+  auto l_size = std::distance(l_first, l_last);
+  if (l_size <= 0) {
+    return l_result;
+  }
+  int n_threads = local_num_threads(policy, l_size);
+  DASH_LOG_DEBUG("dash::internal::local_reduce", "threads:", n_threads);
+  std::vector< LocalReduceResult<ValueType> > t_results(
+    n_threads, l_result);
+  local_parallel_chunks(
+    n_threads,
+    l_size,
+    [&](int t_id, std::size_t t_begin, std::size_t t_end) {
+      if (t_begin < t_end) {
+        auto      it    = l_first + t_begin;
+        ValueType t_val = unary_op(*it);
+        for (++it; it != l_first + t_end; ++it) {
+          t_val = op(t_val, unary_op(*it));
+        }
+        t_results[t_id] = LocalReduceResult<ValueType> { t_val, true };
+      }
+    });
+  // Combine thread results in order of their chunks:
+  for (const auto & t_result : t_results) {
+    if (!t_result.valid) {
+      continue;
+    }
+    l_result.value = l_result.valid
+                     ? op(l_result.value, t_result.value)
+                     : t_result.value;
+    l_result.valid = true;
+  }
+  return l_result;
+}
+
+/**
+ * Reduces the elements in the local range \c [l_first, l_last) using
+ * \c op, distributed to the unit's threads if OpenMP is enabled.
+ * The operation must be associative.
+ */
+template<
+  typename ValueType,
+  class    LocalInputIt,
+  class    UnaryFunction,
+  class    BinaryOperation >
+LocalReduceResult<ValueType> local_reduce(
+  LocalInputIt    l_first,
+  LocalInputIt    l_last,
+  UnaryFunction   unary_op,
+  BinaryOperation op)
+{
+  return local_reduce<ValueType>(
+           dash::execution::par, l_first, l_last, unary_op, op);
+}
+
+/**
+ * Reduces local results of units in a single \c dart_allreduce.
+ */
+template<
+  typename ValueType,
+  class    BinaryOperation >
+ValueType team_reduce_impl(
+  const LocalReduceResult<ValueType> & l_result,
+  const ValueType                    & init,
+  BinaryOperation                      op,
+  dash::Team                         & team,
+  std::true_type                       /* dart operation */)
+{
+  const dart_operation_t dart_op =
+    dart_reduce_operation<ValueType, BinaryOperation>::value;
+  // Units without local result contribute the operation's identity:
+  ValueType l_value = l_result.valid
+                      ? l_result.value
+                      : reduce_identity<ValueType>(dart_op);
+  ValueType g_value;
+  DASH_LOG_TRACE("dash::internal::team_reduce", "dart_allreduce",
+                 "op:", dart_op);
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_value,
+      &g_value,
+      1,
+      dash::dart_datatype<ValueType>::value,
+      dart_op,
+      team.dart_id()),
+    DART_OK);
+  return op(init, g_value);
+}
+
+/**
+ * Gathers local results of all units and applies the operation in the
+ * order of unit ids.
+ */
+template<
+  typename ValueType,
+  class    BinaryOperation >
+ValueType team_reduce_impl(
+  const LocalReduceResult<ValueType> & l_result,
+  const ValueType                    & init,
+  BinaryOperation                      op,
+  dash::Team                         & team,
+  std::false_type                      /* dart operation */)
+{
+  static_assert(
+    std::is_trivially_copyable<ValueType>::value,
+    "Reduction with custom operation requires trivially copyable type");
+  DASH_LOG_TRACE("dash::internal::team_reduce", "dart_allgather");
+  std::vector< LocalReduceResult<ValueType> > l_results(team.size());
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_result,
+      l_results.data(),
+      sizeof(LocalReduceResult<ValueType>),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+  ValueType result = init;
+  for (const auto & u_result : l_results) {
+    if (u_result.valid) {
+      result = op(result, u_result.value);
+    }
+  }
+  return result;
+}
+
+/**
+ * Reduces the local results of all units in the team using \c op and
+ * combines it with \c init.
+ * The result is available at all units.
+ *
+ * Operations supported by DART are reduced in a single
+ * \c dart_allreduce, other operations are applied to the local results
+ * gathered from all units in the order of unit ids.
+ *
+ * Collective operation.
+ *
+ * \returns  \c init (+) r[0] (+) ... (+) r[n], with \c r the valid local
+ *           results of units in the team
+ */
+template<
+  typename ValueType,
+  class    BinaryOperation >
+ValueType team_reduce(
+  const LocalReduceResult<ValueType> & l_result,
+  const ValueType                    & init,
+  BinaryOperation                      op,
+  dash::Team                         & team)
+{
+  return team_reduce_impl(
+           l_result, init, op, team,
+           std::integral_constant<
+             bool,
+             dart_reduce_operation<ValueType, BinaryOperation>::value
+               != DART_OP_UNDEFINED >());
+}
+
+/**
+ * Reduces the local results of all units preceding the calling unit in
+ * the specified order of units using \c op, applied to the local results
+ * gathered from all units.
+ *
+ * Collective operation.
+ *
+ * \returns  The reduction of the valid local results of units preceding
+ *           the calling unit in \c units, invalid if there are none.
+ */
+template<
+  typename ValueType,
+  class    BinaryOperation >
+LocalReduceResult<ValueType> team_exscan(
+  const LocalReduceResult<ValueType> & l_result,
+  BinaryOperation                      op,
+  dash::Team                         & team,
+  /// Ids of units in the team in the order of the reduction
+  const std::vector<std::size_t>     & units)
+{
+  static_assert(
+    std::is_trivially_copyable<ValueType>::value,
+    "Prefix reduction with custom operation requires trivially copyable "
+    "type");
+  DASH_LOG_TRACE("dash::internal::team_exscan", "dart_allgather");
+  std::vector< LocalReduceResult<ValueType> > l_results(team.size());
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_result,
+      l_results.data(),
+      sizeof(LocalReduceResult<ValueType>),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+  LocalReduceResult<ValueType> prefix { ValueType(), false };
+  for (auto u : units) {
+    if (u == static_cast<std::size_t>(team.myid())) {
+      break;
+    }
+    if (l_results[u].valid) {
+      prefix.value = prefix.valid
+                     ? op(prefix.value, l_results[u].value)
+                     : l_results[u].value;
+      prefix.valid = true;
+    }
+  }
+  return prefix;
+}
+
+/**
+ * Exclusive prefix reduction of local results in a single
+ * \c dart_exscan.
+ */
+template<
+  typename ValueType,
+  class    BinaryOperation >
+LocalReduceResult<ValueType> team_exscan_impl(
+  const LocalReduceResult<ValueType> & l_result,
+  BinaryOperation                      op,
+  dash::Team                         & team,
+  std::true_type                       /* dart operation */)
+{
+  const dart_operation_t dart_op =
+    dart_reduce_operation<ValueType, BinaryOperation>::value;
+  ValueType l_value = l_result.valid
+                      ? l_result.value
+                      : reduce_identity<ValueType>(dart_op);
+  LocalReduceResult<ValueType> prefix { ValueType(), false };
+  DASH_LOG_TRACE("dash::internal::team_exscan", "dart_exscan",
+                 "op:", dart_op);
+  DASH_ASSERT_RETURNS(
+    dart_exscan(
+      &l_value,
+      &prefix.value,
+      1,
+      dash::dart_datatype<ValueType>::value,
+      dart_op,
+      team.dart_id()),
+    DART_OK);
+  // Result is undefined at the first unit, units following units without
+  // local results receive the identity of the operation:
+  prefix.valid = (team.myid() > 0);
+  return prefix;
+}
+
+/**
+ * Gathers local results of all units and applies the operation to the
+ * results of preceding units.
+ */
+template<
+  typename ValueType,
+  class    BinaryOperation >
+LocalReduceResult<ValueType> team_exscan_impl(
+  const LocalReduceResult<ValueType> & l_result,
+  BinaryOperation                      op,
+  dash::Team                         & team,
+  std::false_type                      /* dart operation */)
+{
+  std::vector<std::size_t> units(team.size());
+  std::iota(units.begin(), units.end(), 0);
+  return team_exscan(l_result, op, team, units);
+}
+
+/**
+ * Reduces the local results of all units preceding the calling unit in
+ * the team using \c op.
+ *
+ * Operations supported by DART are reduced in a single \c dart_exscan,
+ * other operations are applied to the local results gathered from all
+ * units.
+ *
+ * Collective operation.
+ *
+ * \returns  r[0] (+) ... (+) r[myid-1], with \c r the valid local results
+ *           of units in the team. Invalid at the first unit. If no
+ *           preceding unit has a local result, the result is either
+ *           invalid or the identity of the operation.
+ */
+template<
+  typename ValueType,
+  class    BinaryOperation >
+LocalReduceResult<ValueType> team_exscan(
+  const LocalReduceResult<ValueType> & l_result,
+  BinaryOperation                      op,
+  dash::Team                         & team)
+{
+  return team_exscan_impl(
+           l_result, op, team,
+           std::integral_constant<
+             bool,
+             dart_reduce_operation<ValueType, BinaryOperation>::value
+               != DART_OP_UNDEFINED >());
+}
+
+/**
+ * Logical conjunction of a flag at all units in the team.
+ *
+ * Collective operation.
+ */
+inline bool team_all(bool l_flag, dash::Team & team)
+{
+  return team_reduce<int>(
+           LocalReduceResult<int> { l_flag ? 1 : 0, true },
+           1,
+           std::logical_and<int>(),
+           team) != 0;
+}
+
+/**
+ * Logical disjunction of a flag at all units in the team.
+ *
+ * Collective operation.
+ */
+inline bool team_any(bool l_flag, dash::Team & team)
+{
+  return team_reduce<int>(
+           LocalReduceResult<int> { l_flag ? 1 : 0, true },
+           0,
+           std::logical_or<int>(),
+           team) != 0;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__REDUCE_H__INCLUDED
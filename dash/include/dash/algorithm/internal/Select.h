@@ -0,0 +1,199 @@
+#ifndef DASH__ALGORITHM__INTERNAL__SELECT_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__SELECT_H__INCLUDED
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Number of local elements of all units that are less than and not
+ * greater than a value.
+ */
+struct SelectCount
+{
+  std::size_t lower;
+  std::size_t upper;
+};
+
+/**
+ * Returns the element of global rank \c k in the local sequences of all
+ * units in the team, the element that would be at position \c k if all
+ * elements were sorted with respect to \c comp.
+ * The local sequence \c [l_first, l_first + l_size) is reordered.
+ *
+ * Selection proceeds in rounds like \c dash::internal::sort_partition,
+ * but on unsorted elements: every unit contributes the median of the
+ * local elements that have not been excluded yet as sample, and the
+ * weighted median of the samples is used as pivot. Units partition their
+ * remaining elements at the pivot, and the global counts of elements less
+ * than and not greater than the pivot either identify the pivot as the
+ * selected element or exclude at least a quarter of the remaining
+ * elements.
+ * Every round consists of two \c dart_allgather operations of a single
+ * sample or count per unit, so only \c O(P log n) values are exchanged.
+ *
+ * Collective operation.
+ *
+ * \returns  The selected element, identical at all units.
+ */
+template<
+  typename ValueType,
+  class    Compare >
+ValueType select_kth(
+  /// Local elements, reordered
+  ValueType   * l_first,
+  /// Number of local elements
+  std::size_t   l_size,
+  /// Global rank of the selected element, less than the total number of
+  /// elements of all units
+  std::size_t   k,
+  Compare       comp,
+  dash::Team  & team)
+{
+  static_assert(
+    std::is_trivially_copyable<ValueType>::value,
+    "Selection requires trivially copyable type");
+
+  struct sample_t {
+    ValueType   value;
+    std::size_t weight;
+  };
+
+  const std::size_t nunits = team.size();
+
+  // Window of local elements not excluded yet, and the rank of the
+  // selected element among the elements in the windows of all units:
+  ValueType * l_lo = l_first;
+  ValueType * l_hi = l_first + l_size;
+
+  sample_t                 l_sample;
+  std::vector<sample_t>    g_samples(nunits);
+  SelectCount              l_count;
+  std::vector<SelectCount> g_counts(nunits);
+  std::vector<sample_t>    candidates;
+  candidates.reserve(nunits);
+
+  int rounds = 0;
+  while (true) {
+    ++rounds;
+    // Local sample:
+    l_sample.weight = l_hi - l_lo;
+    if (l_sample.weight > 0) {
+      auto l_mid = l_lo + (l_hi - l_lo) / 2;
+      std::nth_element(l_lo, l_mid, l_hi, comp);
+      l_sample.value = *l_mid;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        &l_sample,
+        g_samples.data(),
+        sizeof(sample_t),
+        DART_TYPE_BYTE,
+        team.dart_id()),
+      DART_OK);
+    // Weighted median of samples as pivot:
+    candidates.clear();
+    std::size_t weight_total = 0;
+    for (const auto & sample : g_samples) {
+      if (sample.weight > 0) {
+        candidates.push_back(sample);
+        weight_total += sample.weight;
+      }
+    }
+    DASH_ASSERT_GT(weight_total, k, "rank out of range");
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [&](const sample_t & lhs, const sample_t & rhs) {
+                       return comp(lhs.value, rhs.value);
+                     });
+    ValueType   pivot      = candidates.back().value;
+    std::size_t weight_acc = 0;
+    for (const auto & candidate : candidates) {
+      weight_acc += candidate.weight;
+      if (2 * weight_acc >= weight_total) {
+        pivot = candidate.value;
+        break;
+      }
+    }
+    // Partition local window into elements less than, equal to and
+    // greater than the pivot:
+    auto l_lower = std::partition(l_lo, l_hi,
+                                  [&](const ValueType & v) {
+                                    return comp(v, pivot);
+                                  });
+    auto l_upper = std::partition(l_lower, l_hi,
+                                  [&](const ValueType & v) {
+                                    return !comp(pivot, v);
+                                  });
+    l_count.lower = l_lower - l_lo;
+    l_count.upper = l_upper - l_lo;
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        &l_count,
+        g_counts.data(),
+        sizeof(SelectCount),
+        DART_TYPE_BYTE,
+        team.dart_id()),
+      DART_OK);
+    std::size_t g_lower = 0;
+    std::size_t g_upper = 0;
+    for (const auto & count : g_counts) {
+      g_lower += count.lower;
+      g_upper += count.upper;
+    }
+    if (k < g_lower) {
+      // Selected element is less than the pivot:
+      l_hi = l_lower;
+    } else if (k >= g_upper) {
+      // Selected element is greater than the pivot:
+      l_lo = l_upper;
+      k   -= g_upper;
+    } else {
+      DASH_LOG_DEBUG("dash::internal::select_kth", "rounds:", rounds);
+      return pivot;
+    }
+  }
+}
+
+/**
+ * Counts of elements less than and not greater than \c value in the local
+ * range \c [l_first, l_last).
+ */
+template<
+  typename ValueType,
+  class    Compare >
+SelectCount select_count(
+  const ValueType * l_first,
+  const ValueType * l_last,
+  const ValueType & value,
+  Compare           comp)
+{
+  SelectCount count { 0, 0 };
+  for (auto it = l_first; it != l_last; ++it) {
+    if (comp(*it, value)) {
+      ++count.lower;
+    } else if (!comp(value, *it)) {
+      ++count.upper;
+    }
+  }
+  count.upper += count.lower;
+  return count;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__SELECT_H__INCLUDED
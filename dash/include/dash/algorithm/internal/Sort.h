@@ -0,0 +1,301 @@
+#ifndef DASH__ALGORITHM__INTERNAL__SORT_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__SORT_H__INCLUDED
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <dash/util/UnitLocality.h>
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Minimum number of local elements for which local sorting is
+ * distributed to threads.
+ */
+constexpr std::size_t sort_min_elements_per_thread = 65536;
+
+/**
+ * Merges consecutive sorted runs in the range starting at \c first.
+ * Run \c r is located at offsets \c [run_offsets[r], run_offsets[r+1]),
+ * runs are merged pairwise in \c log2(runs) rounds.
+ */
+template<
+  class RandomIt,
+  class Compare >
+void merge_sorted_runs(
+  RandomIt                         first,
+  std::vector<std::size_t>         run_offsets,
+  Compare                          comp)
+{
+  while (run_offsets.size() > 2) {
+    auto n_merges = static_cast<int>((run_offsets.size() - 1) / 2);
+#ifdef DASH_ENABLE_OPENMP
+    bool parallel = n_merges > 1 &&
+                    run_offsets.back() - run_offsets.front()
+                      >= 2 * sort_min_elements_per_thread;
+    #pragma omp parallel for if (parallel)
+#endif
+    for (int m = 0; m < n_merges; ++m) {
+      std::inplace_merge(first + run_offsets[2 * m],
+                         first + run_offsets[2 * m + 1],
+                         first + run_offsets[2 * m + 2],
+                         comp);
+    }
+    // Remove offsets between merged runs:
+    std::vector<std::size_t> merged_offsets;
+    merged_offsets.reserve(run_offsets.size() / 2 + 1);
+    for (std::size_t r = 0; r < run_offsets.size(); r += 2) {
+      merged_offsets.push_back(run_offsets[r]);
+    }
+    if (merged_offsets.back() != run_offsets.back()) {
+      merged_offsets.push_back(run_offsets.back());
+    }
+    run_offsets.swap(merged_offsets);
+  }
+}
+
+/**
+ * Sorts the local range \c [first, last), distributed to the unit's
+ * threads if OpenMP is enabled.
+ */
+template<
+  class RandomIt,
+  class Compare >
+void local_sort(
+  RandomIt first,
+  RandomIt last,
+  Compare  comp)
+{
+  std::size_t l_size = std::distance(first, last);
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  int n_threads = std::min<int>(
+                    uloc.num_domain_threads(),
+                    l_size / sort_min_elements_per_thread);
+  if (n_threads > 1) {
+    DASH_LOG_DEBUG("dash::internal::local_sort", "threads:", n_threads);
+    std::vector<std::size_t> run_offsets(n_threads + 1);
+    for (int t = 0; t <= n_threads; ++t) {
+      run_offsets[t] = (l_size * t) / n_threads;
+    }
+    #pragma omp parallel for num_threads(n_threads)
+    for (int t = 0; t < n_threads; ++t) {
+      std::sort(first + run_offsets[t], first + run_offsets[t + 1], comp);
+    }
+    merge_sorted_runs(first, run_offsets, comp);
+    return;
+  }
+#endif // DASH_ENABLE_OPENMP
+  std::sort(first, last, comp);
+}
+
+/**
+ * Partitions the elements of sorted local sequences of all units in the
+ * team at the specified global ranks.
+ *
+ * For every rank \c R[b], the number of elements \c s[b][u] of every unit
+ * \c u is determined such that the elements before these positions are
+ * the \c R[b] smallest elements of all units.
+ * Equal elements are assigned to partitions in the order of unit ids.
+ *
+ * Splitters are found by histogramming: in every round, each unit
+ * contributes the median of its local elements that have not been
+ * assigned to either side of a rank yet as sample, and the weighted
+ * median of the samples is used as pivot. Global counts of the elements
+ * less than and not greater than the pivot then either resolve the
+ * partition or exclude at least a quarter of the remaining elements.
+ * Every round consists of two \c dart_allgather operations for all ranks.
+ *
+ * Collective operation.
+ *
+ * \returns  The partition positions \c s[b][u] at index
+ *           <tt>b * nunits + u</tt>, identical at all units.
+ */
+template<
+  typename ValueType,
+  class    Compare >
+std::vector<std::size_t> sort_partition(
+  /// Sorted local elements
+  const ValueType                * l_first,
+  /// Number of local elements of all units
+  const std::vector<std::size_t> & u_sizes,
+  /// Global ranks to partition at, in ascending order
+  const std::vector<std::size_t> & g_ranks,
+  Compare                          comp,
+  dash::Team                     & team)
+{
+  static_assert(
+    std::is_trivially_copyable<ValueType>::value,
+    "Partitioning requires trivially copyable type");
+
+  struct sample_t {
+    ValueType   value;
+    std::size_t weight;
+  };
+  struct count_t {
+    std::size_t lower;
+    std::size_t upper;
+  };
+
+  const std::size_t nunits  = team.size();
+  const std::size_t nranks  = g_ranks.size();
+  const std::size_t myid    = team.myid();
+  const std::size_t g_size  = std::accumulate(u_sizes.begin(),
+                                              u_sizes.end(),
+                                              std::size_t(0));
+
+  std::vector<std::size_t> splits(nranks * nunits, 0);
+  // Window of elements of every unit not assigned to a partition yet:
+  std::vector<std::size_t> lo(nranks * nunits, 0);
+  std::vector<std::size_t> hi(nranks * nunits, 0);
+  std::vector<bool>        solved(nranks, false);
+  std::size_t              n_unsolved = 0;
+
+  for (std::size_t b = 0; b < nranks; ++b) {
+    for (std::size_t u = 0; u < nunits; ++u) {
+      hi[b * nunits + u] = u_sizes[u];
+    }
+    if (g_ranks[b] == 0) {
+      solved[b] = true;
+    } else if (g_ranks[b] >= g_size) {
+      std::copy(u_sizes.begin(), u_sizes.end(),
+                splits.begin() + b * nunits);
+      solved[b] = true;
+    } else {
+      ++n_unsolved;
+    }
+  }
+
+  std::vector<sample_t> l_samples(nranks);
+  std::vector<sample_t> g_samples(nranks * nunits);
+  std::vector<count_t>  l_counts(nranks);
+  std::vector<count_t>  g_counts(nranks * nunits);
+  std::vector<ValueType> pivots(nranks);
+  std::vector<sample_t> candidates;
+  candidates.reserve(nunits);
+
+  int rounds = 0;
+  while (n_unsolved > 0) {
+    ++rounds;
+    // Local samples:
+    for (std::size_t b = 0; b < nranks; ++b) {
+      auto l_lo = lo[b * nunits + myid];
+      auto l_hi = hi[b * nunits + myid];
+      l_samples[b].weight = solved[b] ? 0 : l_hi - l_lo;
+      if (l_samples[b].weight > 0) {
+        l_samples[b].value = l_first[l_lo + (l_hi - l_lo) / 2];
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        l_samples.data(),
+        g_samples.data(),
+        nranks * sizeof(sample_t),
+        DART_TYPE_BYTE,
+        team.dart_id()),
+      DART_OK);
+    // Weighted median of samples as pivot:
+    for (std::size_t b = 0; b < nranks; ++b) {
+      if (solved[b]) {
+        continue;
+      }
+      candidates.clear();
+      std::size_t weight_total = 0;
+      for (std::size_t u = 0; u < nunits; ++u) {
+        const auto & sample = g_samples[u * nranks + b];
+        if (sample.weight > 0) {
+          candidates.push_back(sample);
+          weight_total += sample.weight;
+        }
+      }
+      std::stable_sort(candidates.begin(), candidates.end(),
+                       [&](const sample_t & lhs, const sample_t & rhs) {
+                         return comp(lhs.value, rhs.value);
+                       });
+      std::size_t weight_acc = 0;
+      for (const auto & candidate : candidates) {
+        weight_acc += candidate.weight;
+        if (2 * weight_acc >= weight_total) {
+          pivots[b] = candidate.value;
+          break;
+        }
+      }
+      // Elements less than and not greater than the pivot in the local
+      // window, elements before the window are less than the pivot:
+      auto l_lo = l_first + lo[b * nunits + myid];
+      auto l_hi = l_first + hi[b * nunits + myid];
+      auto l_lower = std::lower_bound(l_lo, l_hi, pivots[b], comp);
+      auto l_upper = std::upper_bound(l_lower, l_hi, pivots[b], comp);
+      l_counts[b].lower = l_lower - l_first;
+      l_counts[b].upper = l_upper - l_first;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        l_counts.data(),
+        g_counts.data(),
+        nranks * sizeof(count_t),
+        DART_TYPE_BYTE,
+        team.dart_id()),
+      DART_OK);
+    // Global histogram at pivots:
+    for (std::size_t b = 0; b < nranks; ++b) {
+      if (solved[b]) {
+        continue;
+      }
+      std::size_t g_lower = 0;
+      std::size_t g_upper = 0;
+      for (std::size_t u = 0; u < nunits; ++u) {
+        g_lower += g_counts[u * nranks + b].lower;
+        g_upper += g_counts[u * nranks + b].upper;
+      }
+      if (g_upper < g_ranks[b]) {
+        // Elements not greater than pivot are left of the partition:
+        for (std::size_t u = 0; u < nunits; ++u) {
+          lo[b * nunits + u] = g_counts[u * nranks + b].upper;
+        }
+      } else if (g_lower > g_ranks[b]) {
+        // Elements not less than pivot are right of the partition:
+        for (std::size_t u = 0; u < nunits; ++u) {
+          hi[b * nunits + u] = g_counts[u * nranks + b].lower;
+        }
+      } else {
+        // Pivot is the splitter, assign elements equal to the pivot in
+        // the order of units:
+        auto n_equal_left = g_ranks[b] - g_lower;
+        for (std::size_t u = 0; u < nunits; ++u) {
+          const auto & u_count = g_counts[u * nranks + b];
+          auto u_equal_left    = std::min(u_count.upper - u_count.lower,
+                                          n_equal_left);
+          splits[b * nunits + u] = u_count.lower + u_equal_left;
+          n_equal_left          -= u_equal_left;
+        }
+        solved[b] = true;
+        --n_unsolved;
+      }
+    }
+  }
+  DASH_LOG_DEBUG("dash::internal::sort_partition", "rounds:", rounds);
+  return splits;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__SORT_H__INCLUDED
@@ -0,0 +1,135 @@
+#ifndef DASH__ALGORITHM__INTERNAL__SUBRANGE_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__SUBRANGE_H__INCLUDED
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Local elements of a unit in a one-dimensional global range.
+ */
+template<typename IndexType>
+struct unit_subrange
+{
+  /// Local index of the unit's first element in the range
+  IndexType   l_begin;
+  /// Number of the unit's elements in the range
+  std::size_t l_size;
+  /// Offset of the unit's first element in the range
+  std::size_t g_offset;
+  /// Whether the unit's elements in the range are contiguous
+  bool        contiguous;
+};
+
+/**
+ * Local elements of the calling unit in the range \c [first, last).
+ */
+template<
+  typename ElementType,
+  class    PatternType >
+unit_subrange<typename PatternType::index_type> local_subrange(
+  GlobIter<ElementType, PatternType> first,
+  GlobIter<ElementType, PatternType> last)
+{
+  static_assert(
+    PatternType::ndim() == 1,
+    "dash::internal::local_subrange requires a one-dimensional range");
+
+  auto & pattern     = first.pattern();
+  auto   index_range = dash::local_index_range(first, last);
+  unit_subrange<typename PatternType::index_type> l_range;
+  l_range.l_begin    = index_range.begin;
+  l_range.l_size     = index_range.end - index_range.begin;
+  l_range.g_offset   = 0;
+  l_range.contiguous = true;
+  if (l_range.l_size > 0) {
+    auto g_begin       = pattern.global(index_range.begin);
+    auto g_last        = pattern.global(index_range.end - 1);
+    l_range.g_offset   = g_begin - first.pos();
+    l_range.contiguous = static_cast<std::size_t>(g_last - g_begin + 1)
+                         == l_range.l_size;
+  }
+  return l_range;
+}
+
+/**
+ * Gathers the local subranges of all units in the team, see
+ * \c local_subrange. \c RangeType is \c unit_subrange or a trivially
+ * copyable type derived from it.
+ *
+ * Collective operation.
+ *
+ * \throws  dash::exception::InvalidArgument  at every unit if the local
+ *          elements of any unit in the range are not contiguous
+ */
+template<class RangeType>
+std::vector<RangeType> gather_subranges(
+  const RangeType & l_range,
+  dash::Team      & team,
+  /// Name of the calling algorithm in error messages
+  const char      * context)
+{
+  static_assert(
+    std::is_trivially_copyable<RangeType>::value,
+    "dash::internal::gather_subranges requires trivially copyable type");
+
+  std::vector<RangeType> u_ranges(team.size());
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_range,
+      u_ranges.data(),
+      sizeof(RangeType),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+  for (std::size_t u = 0; u < u_ranges.size(); ++u) {
+    if (!u_ranges[u].contiguous) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        context << ": local elements of unit " << u << " in range " <<
+        "are not contiguous");
+    }
+  }
+  return u_ranges;
+}
+
+/**
+ * Units with elements in the range in order of their subranges.
+ */
+template<class RangeType>
+std::vector<std::size_t> subrange_units(
+  const std::vector<RangeType> & u_ranges)
+{
+  std::vector<std::size_t> units;
+  for (std::size_t u = 0; u < u_ranges.size(); ++u) {
+    if (u_ranges[u].l_size > 0) {
+      units.push_back(u);
+    }
+  }
+  std::sort(units.begin(), units.end(),
+            [&](std::size_t a, std::size_t b) {
+              return u_ranges[a].g_offset < u_ranges[b].g_offset;
+            });
+  return units;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__SUBRANGE_H__INCLUDED
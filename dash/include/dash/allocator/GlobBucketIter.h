@@ -16,6 +16,7 @@
 #include <dash/internal/Logging.h>
 
 #include <type_traits>
+#include <algorithm>
 #include <list>
 #include <vector>
 #include <iterator>
@@ -140,31 +141,7 @@ public:
     _idx_bucket_phase(0)
   {
     DASH_LOG_TRACE("GlobBucketIter(gmem,idx)", "gidx:", position);
-    for (auto unit_bucket_cumul_sizes : *_bucket_cumul_sizes) {
-      DASH_LOG_TRACE_VAR("GlobBucketIter(gmem,idx)",
-                         unit_bucket_cumul_sizes);
-      size_type bucket_cumul_size_prev = 0;
-      for (auto bucket_cumul_size : unit_bucket_cumul_sizes) {
-        DASH_LOG_TRACE_VAR("GlobBucketIter(gmem,idx)", bucket_cumul_size);
-        if (position < bucket_cumul_size) {
-          DASH_LOG_TRACE_VAR("GlobBucketIter(gmem,idx)", position);
-          _idx_bucket_phase -= bucket_cumul_size;
-          position           = 0;
-          _idx_local_idx     = position;
-          _idx_bucket_phase  = position - bucket_cumul_size_prev;
-          break;
-        }
-        bucket_cumul_size_prev = bucket_cumul_size;
-        ++_idx_bucket_idx;
-      }
-      if (position == 0) {
-        break;
-      }
-      // Advance to next unit, adjust position relative to next unit's
-      // local index space:
-      position -= unit_bucket_cumul_sizes.back();
-      ++_idx_unit_id;
-    }
+    set_position(position);
     DASH_LOG_TRACE("GlobBucketIter(gmem,idx)",
                    "gidx:",   _idx,
                    "unit:",   _idx_unit_id,
@@ -197,11 +174,9 @@ public:
                    "lidx:", local_index);
     DASH_ASSERT_LT(unit, _bucket_cumul_sizes->size(), "invalid unit id");
 
-    for (size_type unit = 0; unit < _idx_unit_id; ++unit) {
-      auto prec_unit_local_size = (*_bucket_cumul_sizes)[unit].back();
-      _idx += prec_unit_local_size;
-    }
-    increment(local_index);
+    const auto & unit_cumul_sizes = _globmem->unit_cumul_sizes();
+    _idx = (unit > 0 ? unit_cumul_sizes[unit - 1] : 0) + local_index;
+    set_local_position(unit, local_index);
     DASH_LOG_TRACE("GlobBucketIter(gmem,unit,lidx) >",
                    "gidx:",   _idx,
                    "maxidx:", _max_idx,
@@ -222,6 +197,7 @@ public:
     _lbegin(other._lbegin),
     _idx(other._idx),
     _max_idx(other._max_idx),
+    _myid(other._myid),
     _idx_unit_id(other._idx_unit_id),
     _idx_local_idx(other._idx_local_idx),
     _idx_bucket_idx(other._idx_bucket_idx),
@@ -240,10 +216,12 @@ public:
     _lbegin             = other._lbegin;
     _idx                = other._idx;
     _max_idx            = other._max_idx;
+    _myid               = other._myid;
     _idx_unit_id        = other._idx_unit_id;
     _idx_local_idx      = other._idx_local_idx;
     _idx_bucket_idx     = other._idx_bucket_idx;
     _idx_bucket_phase   = other._idx_bucket_phase;
+    return *this;
   }
 
   /**
@@ -430,7 +408,7 @@ public:
 
   inline self_t & operator-=(index_type offset)
   {
-    increment(offset);
+    decrement(offset);
     return *this;
   }
 
@@ -497,10 +475,66 @@ public:
   }
 
 private:
+  /**
+   * Resolve unit, bucket and bucket phase at the given position in global
+   * index space.
+   *
+   * \complexity  O(log u + log b) for u units and at most b buckets
+   *              per unit
+   */
+  void set_position(index_type position)
+  {
+    _idx = position;
+    const auto & unit_cumul_sizes = _globmem->unit_cumul_sizes();
+    // First unit with cumulative local size greater than the position,
+    // skipping units with empty local memory space:
+    auto unit_it = std::upper_bound(unit_cumul_sizes.begin(),
+                                    unit_cumul_sizes.end(),
+                                    static_cast<size_type>(position));
+    if (unit_it == unit_cumul_sizes.end()) {
+      // Position past the final element, resolved at the last unit:
+      --unit_it;
+    }
+    team_unit_t unit(std::distance(unit_cumul_sizes.begin(), unit_it));
+    index_type  unit_offset = unit > 0 ? unit_cumul_sizes[unit - 1] : 0;
+    set_local_position(unit, position - unit_offset);
+  }
+
+  /**
+   * Resolve bucket and bucket phase at the given offset in the local index
+   * space of a unit.
+   *
+   * \complexity  O(log b) for b buckets of the unit
+   */
+  void set_local_position(team_unit_t unit, index_type local_index)
+  {
+    _idx_unit_id   = unit;
+    _idx_local_idx = local_index;
+    const auto & unit_bkt_sizes = (*_bucket_cumul_sizes)[unit];
+    if (unit_bkt_sizes.empty()) {
+      _idx_bucket_idx   = 0;
+      _idx_bucket_phase = local_index;
+      return;
+    }
+    // First bucket with cumulative size greater than the local offset,
+    // skipping empty buckets:
+    auto bkt_it = std::upper_bound(unit_bkt_sizes.begin(),
+                                   unit_bkt_sizes.end(),
+                                   static_cast<size_type>(local_index));
+    if (bkt_it == unit_bkt_sizes.end()) {
+      // Offset past the unit's final element, resolved at its last bucket:
+      --bkt_it;
+    }
+    _idx_bucket_idx   = std::distance(unit_bkt_sizes.begin(), bkt_it);
+    _idx_bucket_phase = local_index - (_idx_bucket_idx > 0
+                                       ? unit_bkt_sizes[_idx_bucket_idx - 1]
+                                       : 0);
+  }
+
   /**
    * Advance pointer by specified position offset.
    */
-  void increment(int offset)
+  void increment(index_type offset)
   {
     DASH_LOG_TRACE("GlobBucketIter.increment()",
                    "gidx:",   _idx,
@@ -509,75 +543,23 @@ private:
                    "bidx:",   _idx_bucket_idx,
                    "bphase:", _idx_bucket_phase,
                    "offset:", offset);
-    _idx += offset;
-    auto current_bucket_size =
-           (*_bucket_cumul_sizes)[_idx_unit_id][_idx_bucket_idx];
-    if (_idx_local_idx + offset < current_bucket_size) {
+    if (offset < 0) {
+      decrement(-offset);
+      return;
+    }
+    const auto & unit_bkt_sizes = (*_bucket_cumul_sizes)[_idx_unit_id];
+    if (!unit_bkt_sizes.empty() &&
+        _idx_local_idx + offset <
+          static_cast<index_type>(unit_bkt_sizes[_idx_bucket_idx])) {
       DASH_LOG_TRACE("GlobBucketIter.increment", "position current bucket");
       // element is in bucket currently referenced by this iterator:
+      _idx              += offset;
       _idx_bucket_phase += offset;
       _idx_local_idx    += offset;
     } else {
       DASH_LOG_TRACE("GlobBucketIter.increment",
                      "position in succeeding bucket");
-      // iterate units:
-      auto unit_id_max = _bucket_cumul_sizes->size() - 1;
-      for (; _idx_unit_id <= unit_id_max; ++_idx_unit_id) {
-        if (offset == 0) {
-          break;
-        }
-        auto unit_bkt_sizes       = (*_bucket_cumul_sizes)[_idx_unit_id];
-        auto unit_bkt_sizes_total = unit_bkt_sizes.back();
-        auto unit_num_bkts        = unit_bkt_sizes.size();
-        DASH_LOG_TRACE("GlobBucketIter.increment",
-                       "unit:", _idx_unit_id,
-                       "remaining offset:", offset,
-                       "total local bucket size:", unit_bkt_sizes_total);
-        if (_idx_local_idx + offset >= unit_bkt_sizes_total) {
-          // offset refers to next unit:
-          DASH_LOG_TRACE("GlobBucketIter.increment",
-                         "position in remote range");
-          // subtract remaining own local size from remaining offset:
-          offset -= (unit_bkt_sizes_total - _idx_local_idx);
-          if (_idx_unit_id == unit_id_max) {
-            // end iterator, offset exceeds iteration space:
-            _idx_bucket_idx    = unit_num_bkts - 1;
-            auto last_bkt_size = unit_bkt_sizes.back();
-            if (unit_num_bkts > 1) {
-              last_bkt_size -= unit_bkt_sizes[_idx_bucket_idx-1];
-            }
-            _idx_bucket_phase  = last_bkt_size + offset;
-            _idx_local_idx    += unit_bkt_sizes_total  + offset;
-            break;
-          }
-          _idx_local_idx    = 0;
-          _idx_bucket_idx   = 0;
-          _idx_bucket_phase = 0;
-        } else {
-          // offset refers to current unit:
-          DASH_LOG_TRACE("GlobBucketIter.increment",
-                         "position in local range",
-                         "current bucket phase:", _idx_bucket_phase,
-                         "cumul. bucket sizes:",  unit_bkt_sizes);
-          _idx_local_idx += offset;
-          // iterate the unit's bucket sizes:
-          for (; _idx_bucket_idx < unit_num_bkts; ++_idx_bucket_idx) {
-            auto cumul_bucket_size = unit_bkt_sizes[_idx_bucket_idx];
-            if (_idx_local_idx < cumul_bucket_size) {
-              auto cumul_prev  = _idx_bucket_idx > 0
-                                 ? unit_bkt_sizes[_idx_bucket_idx-1]
-                                 : 0;
-              // offset refers to current bucket:
-              _idx_bucket_phase = _idx_local_idx - cumul_prev;
-              offset            = 0;
-              break;
-            }
-          }
-          if (offset == 0) {
-            break;
-          }
-        }
-      }
+      set_position(_idx + offset);
     }
     DASH_LOG_TRACE("GlobBucketIter.increment >",
                    "gidx:",   _idx,
@@ -590,7 +572,7 @@ private:
   /**
    * Decrement pointer by specified position offset.
    */
-  void decrement(int offset)
+  void decrement(index_type offset)
   {
     DASH_LOG_TRACE("GlobBucketIter.decrement()",
                    "gidx:",   _idx,
@@ -599,58 +581,21 @@ private:
                    "bidx:",   _idx_bucket_idx,
                    "bphase:", _idx_bucket_phase,
                    "offset:", -offset);
+    if (offset < 0) {
+      increment(-offset);
+      return;
+    }
     if (offset > _idx) {
       DASH_THROW(dash::exception::OutOfRange,
                  "offset " << offset << " is out of range");
     }
-    _idx -= offset;
     if (offset <= _idx_bucket_phase) {
       // element is in bucket currently referenced by this iterator:
+      _idx              -= offset;
       _idx_bucket_phase -= offset;
       _idx_local_idx    -= offset;
     } else {
-      // iterate units:
-      auto first_unit = _idx_unit_id;
-      for (; _idx_unit_id >= 0; --_idx_unit_id) {
-        auto unit_bkt_sizes       = (*_bucket_cumul_sizes)[_idx_unit_id];
-        auto unit_bkt_sizes_total = unit_bkt_sizes.back();
-        auto unit_num_bkts        = unit_bkt_sizes.size();
-        if (_idx_unit_id != first_unit) {
-          --offset;
-          _idx_bucket_idx    = unit_num_bkts - 1;
-          _idx_local_idx     = unit_bkt_sizes_total - 1;
-          auto last_bkt_size = unit_bkt_sizes.back();
-          if (unit_num_bkts > 1) {
-            last_bkt_size -= unit_bkt_sizes[_idx_bucket_idx-1];
-          }
-          _idx_bucket_phase  = last_bkt_size - 1;
-        }
-        if (offset <= _idx_local_idx) {
-          // offset refers to current unit:
-          // iterate the unit's bucket sizes:
-          for (; _idx_bucket_idx >= 0; --_idx_bucket_idx) {
-            auto bucket_size = unit_bkt_sizes[_idx_bucket_idx];
-            if (offset <= _idx_bucket_phase) {
-              // offset refers to current bucket:
-              _idx_local_idx    -= offset;
-              _idx_bucket_phase -= offset;
-              offset             = 0;
-              break;
-            } else {
-              // offset refers to preceeding bucket:
-              _idx_local_idx    -= (_idx_bucket_phase + 1);
-              offset            -= (_idx_bucket_phase + 1);
-              _idx_bucket_phase  = unit_bkt_sizes[_idx_bucket_idx-1] - 1;
-            }
-          }
-        } else {
-          // offset refers to preceeding unit:
-          offset -= _idx_local_idx;
-        }
-        if (offset == 0) {
-          break;
-        }
-      }
+      set_position(_idx - offset);
     }
     DASH_LOG_TRACE("GlobBucketIter.decrement >",
                    "gidx:",   _idx,
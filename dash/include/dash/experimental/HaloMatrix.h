@@ -6,6 +6,7 @@
 #include <dash/Pattern.h>
 #include <dash/GlobMem.h>
 #include <dash/Matrix.h>
+#include <dash/Future.h>
 
 #include <dash/experimental/Halo.h>
 #include <dash/experimental/iterator/HaloMatrixIterator.h>
@@ -163,10 +164,30 @@ public:
     return _haloblock;
   }
 
-  void updateHalosAsync()
+  /**
+   * Starts the update of all halo regions.
+   *
+   * \returns  Future that tests the pending transfers for completion and
+   *           is completed by \c waitHalosAsync. The future must not
+   *           outlive the halo matrix.
+   */
+  dash::Future<void> updateHalosAsync()
   {
     for(auto & view : _blockview_data)
       updateHaloIntern(view.first.first, view.first.second, true);
+
+    return dash::Future<void>(
+      [this]() { waitHalosAsync(); },
+      [this]() {
+        for(auto & view : _blockview_data) {
+          int32_t completed = 0;
+          dart_testall_local(view.second.handle, view.second.num_handles,
+                             &completed);
+          if(!completed)
+            return false;
+        }
+        return true;
+      });
   }
 
   void waitHalosAsync()
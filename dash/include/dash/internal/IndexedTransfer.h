@@ -0,0 +1,429 @@
+#ifndef DASH__INTERNAL__INDEXED_TRANSFER_H__INCLUDED
+#define DASH__INTERNAL__INDEXED_TRANSFER_H__INCLUDED
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/Types.h>
+#include <dash/Future.h>
+#include <dash/Onesided.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Positions in a sequence of global indices, grouped by the unit owning
+ * the referenced element and ordered by local offset at the unit.
+ *
+ * Entries with identical local offset are ordered by their position in
+ * the index sequence.
+ */
+template<typename IndexType>
+class IndexBuckets
+{
+public:
+  typedef IndexType index_type;
+
+  struct entry_t {
+    /// Local offset of the element at its owning unit
+    index_type  loffset;
+    /// Position of the index in the index sequence
+    std::size_t pos;
+  };
+
+private:
+  /// Offset of the first entry of every unit in \c _entries
+  std::vector<std::size_t> _unit_begin;
+  std::vector<entry_t>     _entries;
+
+public:
+  template<class PatternType, class IndexSequence>
+  IndexBuckets(
+    const PatternType   & pattern,
+    const IndexSequence & indices)
+  : _unit_begin(pattern.team().size() + 1, 0)
+  {
+    auto nindices = std::distance(std::begin(indices), std::end(indices));
+    std::vector<dart_unit_t> units(nindices);
+    std::vector<index_type>  loffsets(nindices);
+    std::size_t pos = 0;
+    for (const auto & g_index : indices) {
+      auto l_pos      = pattern.local(static_cast<index_type>(g_index));
+      units[pos]      = l_pos.unit;
+      loffsets[pos]   = l_pos.index;
+      ++_unit_begin[l_pos.unit + 1];
+      ++pos;
+    }
+    for (std::size_t u = 1; u < _unit_begin.size(); ++u) {
+      _unit_begin[u] += _unit_begin[u - 1];
+    }
+    // Counting sort by unit, stable in index position:
+    _entries.resize(nindices);
+    std::vector<std::size_t> cursor(_unit_begin.begin(),
+                                    _unit_begin.end() - 1);
+    for (pos = 0; pos < static_cast<std::size_t>(nindices); ++pos) {
+      _entries[cursor[units[pos]]++] = entry_t { loffsets[pos], pos };
+    }
+    for (std::size_t u = 0; u + 1 < _unit_begin.size(); ++u) {
+      std::stable_sort(_entries.begin() + _unit_begin[u],
+                       _entries.begin() + _unit_begin[u + 1],
+                       [](const entry_t & a, const entry_t & b) {
+                         return a.loffset < b.loffset;
+                       });
+    }
+  }
+
+  std::size_t nunits() const
+  {
+    return _unit_begin.size() - 1;
+  }
+
+  const entry_t * begin(team_unit_t unit) const
+  {
+    return _entries.data() + _unit_begin[unit];
+  }
+
+  const entry_t * end(team_unit_t unit) const
+  {
+    return _entries.data() + _unit_begin[unit + 1];
+  }
+};
+
+/**
+ * Global pointer to the element at the given local offset at a unit,
+ * relative to the unit's first local element.
+ */
+inline dart_gptr_t gptr_at_offset(
+  dart_gptr_t lbegin_gptr,
+  std::size_t loffset_bytes)
+{
+  dart_gptr_t gptr = lbegin_gptr;
+  gptr.addr_or_offs.offset += loffset_bytes;
+  return gptr;
+}
+
+/**
+ * Maximum gap in bytes between requested elements at the same unit that
+ * is fetched in a single transfer instead of two.
+ */
+constexpr std::size_t gather_max_gap_bytes = 64;
+
+/**
+ * Reads the elements at the given global indices into \c out.
+ *
+ * Indices are bucketed by owning unit, elements of a unit are fetched in
+ * one transfer per run of nearby local offsets, local elements are copied
+ * directly.
+ */
+template<
+  typename ValueType,
+  class    GlobMemType,
+  class    PatternType,
+  class    IndexSequence >
+dash::Future<ValueType *> gather_indexed(
+  GlobMemType         & globmem,
+  const PatternType   & pattern,
+  const ValueType     * lbegin,
+  const IndexSequence & indices,
+  ValueType           * out)
+{
+  typedef typename PatternType::index_type index_t;
+  typedef IndexBuckets<index_t>            buckets_t;
+
+  struct run_t {
+    dart_gptr_t gptr;
+    std::size_t buf_offset;
+    std::size_t nelem;
+  };
+  struct pending_t {
+    std::vector<ValueType>                             buffer;
+    std::vector<dart_handle_t>                         handles;
+    /// Pairs of output position and buffer offset
+    std::vector< std::pair<std::size_t, std::size_t> > unpack;
+  };
+
+  buckets_t buckets(pattern, indices);
+  auto      myid    = pattern.team().myid();
+  auto      max_gap = std::max<index_t>(
+                        1, gather_max_gap_bytes / sizeof(ValueType));
+  auto      pending = std::make_shared<pending_t>();
+  ValueType * out_end = out + std::distance(std::begin(indices),
+                                            std::end(indices));
+
+  std::vector<run_t> runs;
+  std::size_t        buf_size = 0;
+  for (team_unit_t u{0}; u < buckets.nunits(); ++u) {
+    auto e_first = buckets.begin(u);
+    auto e_last  = buckets.end(u);
+    if (u == myid) {
+      for (auto e = e_first; e != e_last; ++e) {
+        out[e->pos] = lbegin[e->loffset];
+      }
+      continue;
+    }
+    if (e_first == e_last) {
+      continue;
+    }
+    // Resolve the unit's memory once, runs are addressed by offset:
+    auto unit_gptr = globmem.at(u, 0).dart_gptr();
+    for (auto e = e_first; e != e_last; ) {
+      index_t run_lbegin = e->loffset;
+      auto    run_e      = e;
+      while (run_e + 1 != e_last &&
+             (run_e + 1)->loffset - run_e->loffset <= max_gap) {
+        ++run_e;
+      }
+      std::size_t run_nelem = run_e->loffset - run_lbegin + 1;
+      for (; e != run_e + 1; ++e) {
+        pending->unpack.push_back(
+          std::make_pair(e->pos, buf_size + (e->loffset - run_lbegin)));
+      }
+      runs.push_back(run_t {
+                       gptr_at_offset(unit_gptr,
+                                      run_lbegin * sizeof(ValueType)),
+                       buf_size,
+                       run_nelem });
+      buf_size += run_nelem;
+    }
+  }
+  DASH_LOG_TRACE("dash::internal::gather_indexed",
+                 "indices:", pending->unpack.size(),
+                 "remote runs:", runs.size(),
+                 "buffer size:", buf_size);
+  // Buffer must not be reallocated once transfers have been started:
+  pending->buffer.resize(buf_size);
+  for (const auto & run : runs) {
+    dart_handle_t  handle;
+    dart_storage_t ds = dash::dart_storage<ValueType>(run.nelem);
+    DASH_ASSERT_RETURNS(
+      dart_get_handle(
+        pending->buffer.data() + run.buf_offset,
+        run.gptr,
+        ds.nelem,
+        ds.dtype,
+        &handle),
+      DART_OK);
+    if (handle != NULL) {
+      pending->handles.push_back(handle);
+    }
+  }
+  return dash::Future<ValueType *>(
+           [=]() {
+             if (!pending->handles.empty()) {
+               DASH_ASSERT_RETURNS(
+                 dart_waitall_local(pending->handles.data(),
+                                    pending->handles.size()),
+                 DART_OK);
+             }
+             for (const auto & up : pending->unpack) {
+               out[up.first] = pending->buffer[up.second];
+             }
+             return out_end;
+           },
+           [=]() {
+             return test_local_completion(pending->handles);
+           });
+}
+
+/**
+ * Writes the given values to the elements at the given global indices.
+ *
+ * Values of duplicate indices are applied in sequence order, the last
+ * value is written.
+ * Elements of a unit are written in one transfer per run of consecutive
+ * local offsets, local elements are assigned directly.
+ */
+template<
+  typename ValueType,
+  class    GlobMemType,
+  class    PatternType,
+  class    IndexSequence >
+dash::Future<void> scatter_indexed(
+  GlobMemType         & globmem,
+  const PatternType   & pattern,
+  ValueType           * lbegin,
+  const IndexSequence & indices,
+  const ValueType     * values)
+{
+  typedef typename PatternType::index_type index_t;
+  typedef IndexBuckets<index_t>            buckets_t;
+
+  struct pending_t {
+    std::vector<ValueType>     buffer;
+    std::vector<dart_handle_t> handles;
+  };
+
+  buckets_t buckets(pattern, indices);
+  auto      myid    = pattern.team().myid();
+  auto      pending = std::make_shared<pending_t>();
+  pending->buffer.reserve(
+    std::distance(std::begin(indices), std::end(indices)));
+
+  std::vector< std::pair<dart_gptr_t, std::size_t> > runs;
+  for (team_unit_t u{0}; u < buckets.nunits(); ++u) {
+    auto e_first = buckets.begin(u);
+    auto e_last  = buckets.end(u);
+    if (u == myid) {
+      for (auto e = e_first; e != e_last; ++e) {
+        lbegin[e->loffset] = values[e->pos];
+      }
+      continue;
+    }
+    if (e_first == e_last) {
+      continue;
+    }
+    auto unit_gptr = globmem.at(u, 0).dart_gptr();
+    for (auto e = e_first; e != e_last; ) {
+      auto run_buf_offset = pending->buffer.size();
+      auto run_lbegin     = e->loffset;
+      auto run_lend       = e->loffset;
+      for (; e != e_last && e->loffset <= run_lend; ++e) {
+        if (e->loffset == run_lend) {
+          pending->buffer.push_back(values[e->pos]);
+          ++run_lend;
+        } else {
+          // Duplicate index, last value in sequence order is written:
+          pending->buffer.back() = values[e->pos];
+        }
+      }
+      runs.push_back(std::make_pair(
+                       gptr_at_offset(unit_gptr,
+                                      run_lbegin * sizeof(ValueType)),
+                       run_buf_offset));
+    }
+  }
+  DASH_LOG_TRACE("dash::internal::scatter_indexed",
+                 "remote runs:", runs.size(),
+                 "buffer size:", pending->buffer.size());
+  for (std::size_t r = 0; r < runs.size(); ++r) {
+    auto run_nelem = ((r + 1 < runs.size())
+                      ? runs[r + 1].second
+                      : pending->buffer.size())
+                     - runs[r].second;
+    dart_handle_t  handle;
+    dart_storage_t ds = dash::dart_storage<ValueType>(run_nelem);
+    DASH_ASSERT_RETURNS(
+      dart_put_handle(
+        runs[r].first,
+        pending->buffer.data() + runs[r].second,
+        ds.nelem,
+        ds.dtype,
+        &handle),
+      DART_OK);
+    if (handle != NULL) {
+      pending->handles.push_back(handle);
+    }
+  }
+  return dash::Future<void>(
+           [=]() {
+             if (!pending->handles.empty()) {
+               DASH_ASSERT_RETURNS(
+                 dart_waitall(pending->handles.data(),
+                              pending->handles.size()),
+                 DART_OK);
+             }
+           },
+           [=]() {
+             return test_local_completion(pending->handles);
+           });
+}
+
+/**
+ * Combines the given values with the elements at the given global indices
+ * using the reduce operation \c op, like \c MPI_Accumulate.
+ *
+ * Values of duplicate indices are combined locally before they are
+ * transferred. Elements of a unit are updated in one accumulate operation
+ * per run of consecutive local offsets, including local elements to
+ * preserve atomicity with respect to updates of other units.
+ */
+template<
+  typename ValueType,
+  class    GlobMemType,
+  class    PatternType,
+  class    IndexSequence,
+  class    ReduceOpType >
+dash::Future<void> scatter_indexed(
+  GlobMemType         & globmem,
+  const PatternType   & pattern,
+  const IndexSequence & indices,
+  const ValueType     * values,
+  ReduceOpType          op)
+{
+  static_assert(
+    dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED,
+    "Cannot accumulate unknown type!");
+
+  typedef typename PatternType::index_type index_t;
+  typedef IndexBuckets<index_t>            buckets_t;
+
+  buckets_t buckets(pattern, indices);
+  auto      dart_team = pattern.team().dart_id();
+
+  struct pending_t {
+    std::vector<ValueType>   buffer;
+    std::vector<dart_gptr_t> targets;
+  };
+  auto pending = std::make_shared<pending_t>();
+  // Buffer must not be reallocated while accumulate operations are
+  // pending:
+  pending->buffer.reserve(
+    std::distance(std::begin(indices), std::end(indices)));
+
+  for (team_unit_t u{0}; u < buckets.nunits(); ++u) {
+    auto e_first = buckets.begin(u);
+    auto e_last  = buckets.end(u);
+    if (e_first == e_last) {
+      continue;
+    }
+    auto unit_gptr = globmem.at(u, 0).dart_gptr();
+    for (auto e = e_first; e != e_last; ) {
+      auto run_buf_offset = pending->buffer.size();
+      auto run_lbegin     = e->loffset;
+      auto run_lend       = e->loffset;
+      for (; e != e_last && e->loffset <= run_lend; ++e) {
+        if (e->loffset == run_lend) {
+          pending->buffer.push_back(values[e->pos]);
+          ++run_lend;
+        } else {
+          // Combine values of duplicate indices:
+          pending->buffer.back() = op(pending->buffer.back(),
+                                      values[e->pos]);
+        }
+      }
+      DASH_ASSERT_RETURNS(
+        dart_accumulate(
+          gptr_at_offset(unit_gptr, run_lbegin * sizeof(ValueType)),
+          pending->buffer.data() + run_buf_offset,
+          pending->buffer.size() - run_buf_offset,
+          dash::dart_datatype<ValueType>::value,
+          op.dart_operation(),
+          dart_team),
+        DART_OK);
+    }
+    pending->targets.push_back(unit_gptr);
+  }
+  DASH_LOG_TRACE("dash::internal::scatter_indexed",
+                 "accumulated values:", pending->buffer.size(),
+                 "target units:", pending->targets.size());
+  // Accumulate operations do not provide handles, their remote completion
+  // requires a flush of every target unit:
+  return dash::Future<void>(
+           [=]() {
+             for (const auto & gptr : pending->targets) {
+               DASH_ASSERT_RETURNS(dart_flush(gptr), DART_OK);
+             }
+           });
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__INTERNAL__INDEXED_TRANSFER_H__INCLUDED
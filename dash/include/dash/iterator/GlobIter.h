@@ -5,6 +5,7 @@
 #include <dash/GlobRef.h>
 #include <dash/GlobPtr.h>
 
+#include <algorithm>
 #include <functional>
 #include <sstream>
 
@@ -125,6 +126,9 @@ private:
   static const dim_t      NumDimensions = PatternType::ndim();
   static const MemArrange Arrangement   = PatternType::memory_order();
 
+  typedef typename pattern_type::local_index_t
+    local_pos_t;
+
 protected:
   /// Global memory used to dereference iterated values.
   GlobMemType          * _globmem;
@@ -138,6 +142,17 @@ protected:
   team_unit_t            _myid;
   /// Pointer to first element in local memory
   local_pointer          _lbegin          = nullptr;
+  /// First global index of the cached run of elements that are contiguous
+  /// in the local memory of a single unit.
+  index_type             _lrun_gbegin     = 0;
+  /// Global index past the last element in the cached run.
+  index_type             _lrun_gend       = 0;
+  /// Unit owning the elements in the cached run.
+  team_unit_t            _lrun_unit;
+  /// Local offset of the first element in the cached run.
+  index_type             _lrun_lbegin     = 0;
+  /// Global pointer to the first element in the cached run.
+  dart_gptr_t            _lrun_gptr       = DART_GPTR_NULL;
 
 public:
   /**
@@ -202,8 +217,6 @@ public:
   operator PointerType() const
   {
     DASH_LOG_TRACE_VAR("GlobIter.GlobPtr()", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
     index_type idx    = _idx;
     index_type offset = 0;
     DASH_LOG_TRACE_VAR("GlobIter.GlobPtr()", _max_idx);
@@ -216,14 +229,8 @@ public:
     }
     DASH_LOG_TRACE_VAR("GlobIter.GlobPtr", idx);
     DASH_LOG_TRACE_VAR("GlobIter.GlobPtr", offset);
-    // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
-    DASH_LOG_TRACE_VAR("GlobIter.GlobPtr >", local_pos.unit);
-    DASH_LOG_TRACE_VAR("GlobIter.GlobPtr >", local_pos.index);
     // Create global pointer from unit and local offset:
-    PointerType gptr(
-      _globmem->at(team_unit_t(local_pos.unit), local_pos.index)
-    );
+    PointerType gptr(gptr_at(idx));
     return gptr + offset;
   }
 
@@ -236,8 +243,6 @@ public:
   dart_gptr_t dart_gptr() const
   {
     DASH_LOG_TRACE_VAR("GlobIter.dart_gptr()", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
     index_type idx    = _idx;
     index_type offset = 0;
     // Convert iterator position (_idx) to local index and unit.
@@ -250,17 +255,8 @@ public:
       DASH_LOG_TRACE_VAR("GlobIter.dart_gptr", idx);
       DASH_LOG_TRACE_VAR("GlobIter.dart_gptr", offset);
     }
-    // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
-    DASH_LOG_TRACE("GlobIter.dart_gptr",
-                   "unit:",        local_pos.unit,
-                   "local index:", local_pos.index);
     // Global pointer to element at given position:
-    dash::GlobPtr<ElementType, PatternType> gptr(
-      _globmem->at(
-        team_unit_t(local_pos.unit),
-        local_pos.index)
-    );
+    dash::GlobPtr<ElementType, PatternType> gptr(gptr_at(idx));
     DASH_LOG_TRACE_VAR("GlobIter.dart_gptr >", gptr);
     return (gptr + offset).dart_gptr();
   }
@@ -273,17 +269,9 @@ public:
   ReferenceType operator*() const
   {
     DASH_LOG_TRACE("GlobIter.*", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
-    index_type idx = _idx;
-    // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
-    DASH_LOG_TRACE_VAR("GlobIter.*", local_pos.unit);
-    DASH_LOG_TRACE_VAR("GlobIter.*", local_pos.index);
     // Global reference to element at given position:
     return ReferenceType(
-             _globmem->at(local_pos.unit,
-                          local_pos.index));
+             dash::GlobPtr<ElementType, PatternType>(gptr_at(_idx)));
   }
 
   /**
@@ -295,17 +283,9 @@ public:
     index_type g_index) const
   {
     DASH_LOG_TRACE("GlobIter.[]", g_index);
-    index_type idx = g_index;
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
-    // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
-    DASH_LOG_TRACE_VAR("GlobIter.[]", local_pos.unit);
-    DASH_LOG_TRACE_VAR("GlobIter.[]", local_pos.index);
     // Global reference to element at given position:
     return ReferenceType(
-             _globmem->at(local_pos.unit,
-                          local_pos.index));
+             dash::GlobPtr<ElementType, PatternType>(gptr_at(g_index)));
   }
 
   /**
@@ -323,8 +303,6 @@ public:
   local_pointer local() const
   {
     DASH_LOG_TRACE_VAR("GlobIter.local=()", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
     index_type idx    = _idx;
     index_type offset = 0;
     DASH_LOG_TRACE_VAR("GlobIter.local=", _max_idx);
@@ -338,7 +316,7 @@ public:
     DASH_LOG_TRACE_VAR("GlobIter.local=", idx);
     DASH_LOG_TRACE_VAR("GlobIter.local=", offset);
     // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
+    local_pos_t local_pos = local_pos_at(idx);
     DASH_LOG_TRACE_VAR("GlobIter.local= >", local_pos.unit);
     DASH_LOG_TRACE_VAR("GlobIter.local= >", local_pos.index);
     if (_myid != local_pos.unit) {
@@ -354,8 +332,6 @@ public:
   inline typename pattern_type::local_index_t lpos() const
   {
     DASH_LOG_TRACE_VAR("GlobIter.lpos()", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
     index_type idx    = _idx;
     index_type offset = 0;
     // Convert iterator position (_idx) to local index and unit.
@@ -369,7 +345,7 @@ public:
       DASH_LOG_TRACE_VAR("GlobIter.lpos", offset);
     }
     // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
+    local_pos_t local_pos = local_pos_at(idx);
     local_pos.index += offset;
     DASH_LOG_TRACE("GlobIter.lpos >",
                    "unit:",        local_pos.unit,
@@ -437,6 +413,7 @@ public:
   inline self_t & operator++()
   {
     ++_idx;
+    update_lrun();
     return *this;
   }
 
@@ -447,6 +424,7 @@ public:
   {
     self_t result = *this;
     ++_idx;
+    update_lrun();
     return result;
   }
 
@@ -456,6 +434,7 @@ public:
   inline self_t & operator--()
   {
     --_idx;
+    update_lrun();
     return *this;
   }
 
@@ -466,36 +445,36 @@ public:
   {
     self_t result = *this;
     --_idx;
+    update_lrun();
     return result;
   }
 
   inline self_t & operator+=(index_type n)
   {
     _idx += n;
+    update_lrun();
     return *this;
   }
 
   inline self_t & operator-=(index_type n)
   {
     _idx -= n;
+    update_lrun();
     return *this;
   }
 
   inline self_t operator+(index_type n) const
   {
-    self_t res(
-      _globmem,
-      *_pattern,
-      _idx + static_cast<index_type>(n));
+    // Copy of this iterator retains the cached local run:
+    self_t res(*this);
+    res._idx += static_cast<index_type>(n);
     return res;
   }
 
   inline self_t operator-(index_type n) const
   {
-    self_t res(
-      _globmem,
-      *_pattern,
-      _idx - static_cast<index_type>(n));
+    self_t res(*this);
+    res._idx -= static_cast<index_type>(n);
     return res;
   }
 
@@ -551,6 +530,109 @@ public:
     return _pattern->team();
   }
 
+private:
+  /**
+   * Unit and local offset of the element at the given global index.
+   *
+   * Resolved from the cached run of elements contiguous in local memory,
+   * the pattern is only queried if the index is outside of the cached run.
+   */
+  inline local_pos_t local_pos_at(index_type g_index) const
+  {
+    if (g_index < _lrun_gbegin || g_index >= _lrun_gend) {
+      return _pattern->local(g_index);
+    }
+    local_pos_t local_pos;
+    local_pos.unit  = _lrun_unit;
+    local_pos.index = _lrun_lbegin + (g_index - _lrun_gbegin);
+    return local_pos;
+  }
+
+  /**
+   * Global pointer to the element at the given global index.
+   */
+  inline dart_gptr_t gptr_at(index_type g_index) const
+  {
+    if (g_index < _lrun_gbegin || g_index >= _lrun_gend) {
+      local_pos_t local_pos = _pattern->local(g_index);
+      return _globmem->at(
+               team_unit_t(local_pos.unit),
+               local_pos.index).dart_gptr();
+    }
+    dart_gptr_t gptr = _lrun_gptr;
+    gptr.addr_or_offs.offset += (g_index - _lrun_gbegin) *
+                                sizeof(ElementType);
+    return gptr;
+  }
+
+  /**
+   * Resolve the cached run of elements after the iterator has been moved
+   * to a position outside of the run.
+   */
+  inline void update_lrun()
+  {
+    if ((_idx < _lrun_gbegin || _idx >= _lrun_gend) &&
+        _pattern != nullptr && _idx >= 0 && _idx <= _max_idx) {
+      resolve_lrun(_idx);
+    }
+  }
+
+  /**
+   * Resolve the run of elements containing the given global index that are
+   * stored contiguously in the local memory of a single unit.
+   *
+   * Candidate runs are the elements in the same block along the fastest
+   * dimension of the pattern's memory order. A candidate run is only
+   * accepted if the pattern maps its first and last element to the same
+   * unit and consecutive local offsets, otherwise only the element at the
+   * given index is cached.
+   */
+  void resolve_lrun(index_type g_index)
+  {
+    const dim_t fast_dim  = (Arrangement == dash::ROW_MAJOR)
+                            ? NumDimensions - 1
+                            : 0;
+    auto        g_coords  = _pattern->coords(g_index);
+    index_type  coord     = g_coords[fast_dim];
+    index_type  blocksize = _pattern->blocksize(fast_dim);
+    index_type  extent    = _pattern->extent(fast_dim);
+    index_type  run_first = g_index;
+    index_type  run_last  = g_index;
+    if (blocksize > 1) {
+      index_type phase    = coord % blocksize;
+      index_type nleft    = std::min<index_type>(
+                              blocksize - phase, extent - coord) - 1;
+      run_first = g_index - phase;
+      run_last  = g_index + nleft;
+    }
+    local_pos_t first_pos = _pattern->local(run_first);
+    if (run_last > run_first) {
+      local_pos_t last_pos = _pattern->local(run_last);
+      if (last_pos.unit  != first_pos.unit ||
+          last_pos.index != first_pos.index + (run_last - run_first)) {
+        // Pattern does not map the candidate run to contiguous local
+        // memory, fall back to single element:
+        if (run_first != g_index) {
+          first_pos = _pattern->local(g_index);
+        }
+        run_first = g_index;
+        run_last  = g_index;
+      }
+    }
+    DASH_LOG_TRACE("GlobIter.resolve_lrun",
+                   "gidx:",  g_index,
+                   "run:",   run_first, "-", run_last,
+                   "unit:",  first_pos.unit,
+                   "lidx:",  first_pos.index);
+    _lrun_gbegin = run_first;
+    _lrun_gend   = run_last + 1;
+    _lrun_unit   = team_unit_t(first_pos.unit);
+    _lrun_lbegin = first_pos.index;
+    _lrun_gptr   = _globmem->at(
+                     team_unit_t(first_pos.unit),
+                     first_pos.index).dart_gptr();
+  }
+
 }; // class GlobIter
 
 /**
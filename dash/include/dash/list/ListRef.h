@@ -101,8 +101,7 @@ public:
    */
   inline void push_back(const value_type & value)
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.push_back is not implemented");
+    _list->push_back(value);
   }
 
   /**
@@ -111,8 +110,7 @@ public:
    */
   void pop_back()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.pop_back is not implemented");
+    _list->pop_back();
   }
 
   /**
@@ -120,8 +118,7 @@ public:
    */
   reference back()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.back is not implemented");
+    return _list->back();
   }
 
   /**
@@ -132,8 +129,7 @@ public:
    */
   inline void push_front(const value_type & value)
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.push_front is not implemented");
+    _list->push_front(value);
   }
 
   /**
@@ -142,8 +138,7 @@ public:
    */
   void pop_front()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.pop_front is not implemented");
+    _list->pop_front();
   }
 
   /**
@@ -151,8 +146,7 @@ public:
    */
   reference front()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::ListRef.front is not implemented");
+    return _list->front();
   }
 
   inline Team              & team();
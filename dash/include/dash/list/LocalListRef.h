@@ -196,28 +196,43 @@ public:
     DASH_LOG_TRACE_VAR("LocalListRef.push_back", node.lnext);
     // Copy new node to target address:
     *node_lptr = node;
+    _list->_lend = _list->_lbegin + l_size_new;
     DASH_LOG_TRACE_VAR("LocalListRef.push_back", l_cap_new);
     DASH_LOG_TRACE_VAR("LocalListRef.push_back", l_size_new);
     DASH_LOG_TRACE("LocalListRef.push_back >");
   }
 
   /**
-   * Removes and destroys the last element in the list, reducing the
+   * Removes and destroys the last local element in the list, reducing the
    * container size by one.
+   * Elements published in the last barrier must not be removed if they
+   * may be removed by global pop operations of other units before the
+   * next barrier.
    */
   void pop_back()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::LocalListRef.pop_back is not implemented");
+    DASH_LOG_TRACE("LocalListRef.pop_back()");
+    auto l_size = _list->_local_sizes.local[0];
+    DASH_ASSERT_GT(l_size, 0, "pop_back on empty local list");
+    ListNode_t * node_lptr = static_cast<ListNode_t *>(
+                               _list->_globmem->lbegin() + (l_size - 1));
+    if (node_lptr->lprev != nullptr) {
+      node_lptr->lprev->lnext = nullptr;
+    }
+    _list->_local_sizes.local[0]--;
+    _list->_lend = _list->_lbegin + _list->_local_sizes.local[0];
+    DASH_LOG_TRACE("LocalListRef.pop_back >");
   }
 
   /**
-   * Accesses the last element in the list.
+   * Accesses the last local element in the list.
    */
   reference back()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::LocalListRef._back is not implemented");
+    auto l_size = _list->_local_sizes.local[0];
+    DASH_ASSERT_GT(l_size, 0, "back on empty local list");
+    return static_cast<ListNode_t *>(
+             _list->_globmem->lbegin() + (l_size - 1))->value;
   }
 
   /**
@@ -247,8 +262,9 @@ public:
    */
   reference front()
   {
-    DASH_THROW(dash::exception::NotImplemented,
-               "dash::LocalListRef.front is not implemented");
+    DASH_ASSERT_GT(_list->_local_sizes.local[0], 0,
+                   "front on empty local list");
+    return static_cast<ListNode_t *>(_list->_globmem->lbegin())->value;
   }
 
   /**
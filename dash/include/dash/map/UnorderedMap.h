@@ -7,23 +7,56 @@
 #include <dash/Exception.h>
 #include <dash/Array.h>
 #include <dash/Atomic.h>
+#include <dash/GlobMem.h>
 #include <dash/GlobDynamicMem.h>
 #include <dash/Allocator.h>
+#include <dash/Future.h>
 
 #include <dash/map/UnorderedMapLocalRef.h>
 #include <dash/map/UnorderedMapLocalIter.h>
 #include <dash/map/UnorderedMapGlobIter.h>
 
+#include <dash/dart/if/dart_communication.h>
+
 #include <iterator>
 #include <utility>
 #include <limits>
 #include <vector>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
 #include <functional>
+#include <memory>
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <thread>
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Finalizer of MurmurHash3, spreads hash values of keys in regular
+ * strides over all bits.
+ */
+inline uint64_t hash_mix(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+} // namespace internal
+
+/**
+ * Hash function of \c dash::UnorderedMap mapping every key to the unit
+ * that inserts it, elements are not distributed.
+ */
 template<typename Key>
 class HashLocal
 {
@@ -66,12 +99,77 @@ private:
   team_unit_t   _myid;
 }; // class HashLocal
 
+/**
+ * Hash function of \c dash::UnorderedMap distributing keys uniformly to
+ * the units in the team.
+ * Keys are mapped to the high bits of their mixed \c std::hash value,
+ * independent from the low bits used for the index of the unit's local
+ * elements.
+ */
+template<typename Key>
+class HashDistributed
+{
+private:
+  typedef dash::default_size_t size_type;
+
+public:
+  typedef Key          argument_type;
+  typedef team_unit_t result_type;
+
+public:
+  /**
+   * Default constructor.
+   */
+  HashDistributed()
+  : _nunits(0)
+  { }
+
+  /**
+   * Constructor.
+   */
+  HashDistributed(
+    dash::Team & team)
+  : _nunits(team.size())
+  { }
+
+  result_type operator()(
+    const argument_type & key) const
+  {
+    if (_nunits == 0) {
+      return result_type { 0 };
+    }
+    uint64_t h = dash::internal::hash_mix(
+                   static_cast<uint64_t>(std::hash<Key>()(key)));
+    // Scale upper 32 bits to the number of units:
+    return result_type(
+             static_cast<dart_unit_t>(((h >> 32) * _nunits) >> 32));
+  }
+
+private:
+  size_type    _nunits = 0;
+}; // class HashDistributed
+
+namespace internal {
+
+/**
+ * Whether a hash function of \c dash::UnorderedMap maps keys to the units
+ * that inserted them instead of mapping every key to a fixed unit, so
+ * lookups of a key cannot be routed to a single unit.
+ */
+template<typename Hash>
+struct is_local_hash : std::false_type { };
+
+template<typename Key>
+struct is_local_hash< dash::HashLocal<Key> > : std::true_type { };
+
+} // namespace internal
+
 #ifndef DOXYGEN
 
 template<
   typename Key,
   typename Mapped,
-  typename Hash    = dash::HashLocal<Key>,
+  typename Hash    = dash::HashDistributed<Key>,
   typename Pred    = std::equal_to<Key>,
   typename Alloc   = dash::allocator::DynamicAllocator<
                        std::pair<const Key, Mapped> > >
@@ -238,10 +336,31 @@ public:
   void barrier()
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.barrier()", _team->dart_id());
-    // Apply changes in local memory spaces to global memory space:
     if (_globmem != nullptr) {
+      // Apply pending asynchronous requests, which may insert elements:
+      _async_drain();
+      // Wait for slot reservations of remote insertions at all units:
+      _team->barrier();
+      _reserve_local_capacity();
+      // Apply changes in local memory spaces to global memory space:
       _globmem->commit();
+      _local_attached = _globmem->local_size();
+      // Write remote insertions that exceeded the capacity of their
+      // target unit to the memory attached in the commit:
+      _flush_remote_inserts();
+      _unstage_local_inserts();
+      _team->barrier();
+      // Erase local elements before indexing remote insertions, which may
+      // have been erased by their inserting unit already:
+      _apply_erase_requests();
+      _index_remote_inserts();
+      _reset_claims();
+      _lend = local_iterator(this, _local_sizes.local[0]);
     }
+    // Publish the local element index for lookups of remote units, the
+    // barrier of local sizes ensures completion at all units:
+    _publish_index();
+    _publish_erased();
     // Accumulate local sizes of remote units:
     _local_sizes.barrier();
     _remote_size = 0;
@@ -261,13 +380,12 @@ public:
                      "local size at unit", u, ":", local_size_u,
                      "cumulative size:", _local_cumul_sizes[u]);
     }
-    auto new_size = size();
-    DASH_LOG_TRACE("UnorderedMap.barrier", "new size:", new_size);
-    DASH_ASSERT_EQ(_remote_size, new_size - _local_sizes.local[0],
+    DASH_ASSERT_EQ(_remote_size + _local_sizes.local[0],
+                   _local_cumul_sizes.back(),
                    "invalid size after global commit");
-    _begin = iterator(this, 0);
-    _end   = iterator(this, new_size);
-    DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
+    _update_end();
+    DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier",
+                   "new size:", size());
   }
 
   bool allocate(
@@ -290,6 +408,14 @@ public:
                      "initializing with initial team");
     }
     _local_cumul_sizes = std::vector<size_type>(_team->size(), 0);
+    _index_capacities  = std::vector<size_type>(_team->size(), 0);
+    _index             = std::vector<index_slot>();
+    _index_size        = 0;
+    _index_deleted     = 0;
+    _index_next        = 0;
+    _erased_sizes      = std::vector<size_type>(_team->size(), 0);
+    _erase_requests    = std::vector< std::vector<size_type> >(
+                           _team->size());
     DASH_ASSERT_GT(_local_buffer_size, 0, "local buffer size must not be 0");
     if (nelem < _team->size() * _local_buffer_size) {
       nelem = _team->size() * _local_buffer_size;
@@ -304,6 +430,7 @@ public:
     DASH_LOG_TRACE("UnorderedMap.allocate", "initialize global memory,",
                    "local capacity:", lcap);
     _globmem     = new glob_mem_type(lcap, *_team);
+    _local_attached = _globmem->local_size();
     DASH_LOG_TRACE("UnorderedMap.allocate", "global memory initialized");
 
     // Initialize local sizes with 0:
@@ -311,6 +438,23 @@ public:
     _local_sizes.local[0] = 0;
     _local_size_gptr      = _local_sizes[_myid].dart_gptr();
 
+    // Queues of asynchronous requests, replies and their counters:
+    _async_queue    = new dash::GlobMem<async_request>(_async_capacity,
+                                                       *_team);
+    _async_replies  = new dash::GlobMem<async_reply>(_async_capacity,
+                                                     *_team);
+    _async_counters = new dash::GlobMem<size_type>(3, *_team);
+    for (size_type s = 0; s < _async_capacity; ++s) {
+      _async_queue->lbegin()[s].seq   = 0;
+      _async_replies->lbegin()[s].seq = 0;
+    }
+    std::fill(_async_counters->lbegin(), _async_counters->lend(), 0);
+    // Tables of keys inserted since the last barrier, keys are not
+    // inserted at remote units by dash::HashLocal:
+    if (!dash::internal::is_local_hash<hasher>::value) {
+      _allocate_claims(std::max(_claim_capacity, 2 * lcap));
+    }
+
     // Global iterators:
     _begin       = iterator(this, 0);
     _end         = _begin;
@@ -355,8 +499,52 @@ public:
       delete _globmem;
       _globmem = nullptr;
     }
+    if (_glob_index != nullptr) {
+      delete _glob_index;
+      _glob_index = nullptr;
+    }
+    if (_async_queue != nullptr) {
+      delete _async_queue;
+      delete _async_replies;
+      delete _async_counters;
+      _async_queue    = nullptr;
+      _async_replies  = nullptr;
+      _async_counters = nullptr;
+    }
+    if (_claim_states != nullptr) {
+      _free_claim_overflow();
+      delete _claim_states;
+      delete _claim_keys;
+      delete _claim_links;
+      _claim_states = nullptr;
+      _claim_keys   = nullptr;
+      _claim_links  = nullptr;
+    }
+    _claims_staged.clear();
+    _async_pending.clear();
+    _async_head           = 0;
+    _async_next_id        = 0;
+    _async_sent           = 0;
+    _async_processed      = 0;
+    _async_epoch          = 0;
+    _index                = std::vector<index_slot>();
+    _index_size           = 0;
+    _index_deleted        = 0;
+    _index_next           = 0;
+    _index_own.clear();
+    _erased.clear();
+    _erased_lidx.clear();
+    _erased_published     = 0;
+    _erased_sizes         = std::vector<size_type>(_team->size(), 0);
+    _erase_requests       = std::vector< std::vector<size_type> >(
+                              _team->size());
+    _remote_inserts.clear();
+    _remote_values.clear();
+    _remote_index.clear();
+    _index_capacities     = std::vector<size_type>(_team->size(), 0);
     _local_cumul_sizes    = std::vector<size_type>(_team->size(), 0);
     _local_sizes.local[0] = 0;
+    _local_attached       = 0;
     _remote_size          = 0;
     _begin                = iterator();
     _end                  = _begin;
@@ -442,7 +630,7 @@ public:
 
   inline size_type size() const noexcept
   {
-    return _remote_size + _local_sizes.local[0];
+    return _remote_size + _local_sizes.local[0] - _erased.size();
   }
 
   inline size_type capacity() const noexcept
@@ -457,7 +645,7 @@ public:
 
   inline size_type lsize() const noexcept
   {
-    return _local_sizes.local[0];
+    return _local_sizes.local[0] - _erased_lidx.size();
   }
 
   inline size_type lcapacity() const noexcept
@@ -471,6 +659,11 @@ public:
   // Element Access
   //////////////////////////////////////////////////////////////////////////
 
+  /**
+   * Reference to the mapped value of the element with the specified key,
+   * an element with a value-initialized mapped value is inserted if the
+   * map contains no such element, see \c insert.
+   */
   mapped_type_reference operator[](const key_type & key)
   {
     DASH_LOG_TRACE("UnorderedMap.[]()", "key:", key);
@@ -478,34 +671,7 @@ public:
                                    std::make_pair(key, mapped_type()))
                                 .first;
     DASH_LOG_TRACE_VAR("UnorderedMap.[]", git_value);
-    dart_gptr_t   gptr_mapped = git_value.dart_gptr();
-    value_type  * lptr_value  = static_cast<value_type *>(
-                                  git_value.local());
-    mapped_type * lptr_mapped = nullptr;
-    DASH_LOG_TRACE("UnorderedMap.[]", "gptr to element:", gptr_mapped);
-    DASH_LOG_TRACE("UnorderedMap.[]", "lptr to element:", lptr_value);
-    // Byte offset of mapped value in element type:
-    auto          mapped_offs = offsetof(value_type, second);
-    DASH_LOG_TRACE("UnorderedMap.[]", "byte offset of mapped member:",
-                   mapped_offs);
-    // Increment pointers to element by byte offset of mapped value member:
-    if (lptr_value != nullptr) {
-      // Convert to char pointer for byte-wise increment:
-      char * b_lptr_mapped  = reinterpret_cast<char *>(lptr_value);
-      b_lptr_mapped        += mapped_offs;
-      // Convert to mapped type pointer:
-      lptr_mapped           = reinterpret_cast<mapped_type *>(b_lptr_mapped);
-    }
-    if (!DART_GPTR_ISNULL(gptr_mapped)) {
-      DASH_ASSERT_RETURNS(
-        dart_gptr_incaddr(&gptr_mapped, mapped_offs),
-        DART_OK);
-    }
-    DASH_LOG_TRACE("UnorderedMap.[]", "gptr to mapped member:", gptr_mapped);
-    DASH_LOG_TRACE("UnorderedMap.[]", "lptr to mapped member:", lptr_mapped);
-    // Create global reference to mapped value member in element:
-    mapped_type_reference mapped(gptr_mapped,
-                                 lptr_mapped);
+    auto mapped = _mapped_at(git_value);
     DASH_LOG_TRACE("UnorderedMap.[] >", mapped);
     return mapped;
   }
@@ -513,8 +679,6 @@ public:
   const_mapped_type_reference at(const key_type & key) const
   {
     DASH_LOG_TRACE("UnorderedMap.at() const", "key:", key);
-    // TODO: Unoptimized, currently calls find(key) twice as operator[](key)
-    //       calls insert(key).
     const_iterator git_value = find(key);
     if (git_value == _end) {
       // No equivalent key in map, throw:
@@ -522,7 +686,7 @@ public:
         dash::exception::InvalidArgument,
         "No element in map for key " << key);
     }
-    auto mapped = this->operator[](key);
+    auto mapped = const_cast<self_t *>(this)->_mapped_at(git_value);
     DASH_LOG_TRACE("UnorderedMap.at > const", mapped);
     return mapped;
   }
@@ -530,16 +694,14 @@ public:
   mapped_type_reference at(const key_type & key)
   {
     DASH_LOG_TRACE("UnorderedMap.at()", "key:", key);
-    // TODO: Unoptimized, currently calls find(key) twice as operator[](key)
-    //       calls insert(key).
-    const_iterator git_value = find(key);
+    iterator git_value = find(key);
     if (git_value == _end) {
       // No equivalent key in map, throw:
       DASH_THROW(
         dash::exception::InvalidArgument,
         "No element in map for key " << key);
     }
-    auto mapped = this->operator[](key);
+    auto mapped = _mapped_at(git_value);
     DASH_LOG_TRACE("UnorderedMap.at >", mapped);
     return mapped;
   }
@@ -559,14 +721,21 @@ public:
     return nelem;
   }
 
+  /**
+   * Iterator to the element with the specified key, or \c end() if the
+   * map contains no such element.
+   *
+   * The key is routed to the unit returned by the hash function, only
+   * the index of this unit is probed: in local memory for the active unit
+   * and in one-sided reads of the index published in the last
+   * \c barrier() for remote units.
+   * With \c dash::HashLocal, keys are not mapped to a fixed unit and the
+   * indices of all units are probed, starting at the active unit.
+   */
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    iterator found = _find(key);
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
@@ -574,11 +743,7 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
+    const_iterator found = const_cast<self_t *>(this)->_find(key);
     DASH_LOG_TRACE("UnorderedMap.find const >", found);
     return found;
   }
@@ -587,6 +752,19 @@ public:
   // Modifiers
   //////////////////////////////////////////////////////////////////////////
 
+  /**
+   * Inserts the specified element if the map contains no element with an
+   * equivalent key. Returns an iterator to the inserted element and
+   * \c true, or an iterator to the element with an equivalent key and
+   * \c false.
+   *
+   * Keys of new elements are claimed at the unit they are mapped to by the
+   * hash function, of units inserting equivalent keys concurrently only
+   * one inserts an element and the others obtain an iterator to it.
+   * Elements exceeding the memory of their unit are written to it in the
+   * next \c barrier(), until then their mapped value is accessed with
+   * \c operator[] at all units inserting the key.
+   */
   std::pair<iterator, bool> insert(
     /// The element to insert.
     const value_type & value)
@@ -605,7 +783,7 @@ public:
     if (found != _end) {
       DASH_LOG_TRACE("UnorderedMap.insert", "key found");
       // Existing element found, no insertion:
-      result.first  = iterator(this, found.pos());
+      result.first  = found;
       result.second = false;
     } else {
       DASH_LOG_TRACE("UnorderedMap.insert", "key not found");
@@ -628,41 +806,347 @@ public:
     // Iterator past the last value in the range to insert.
     InputIterator last)
   {
-    // TODO: Calling insert() on every single element in the range could cause
-    //       multiple calls of globmem.grow(_local_buffer_size).
-    //       Could be optimized to allocate additional memory in a single call
-    //       of globmem.grow(std::distance(first,last)).
+    // Non-collective, every element is looked up and inserted separately.
+    // For collective insertion of large ranges, see insert_bulk.
     for (auto it = first; it != last; ++it) {
       insert(*it);
     }
   }
 
+  /**
+   * Inserts the elements in the range \c [first, last) of every unit,
+   * elements with keys equivalent to elements in the map or to preceding
+   * elements in the ranges are not inserted.
+   *
+   * Units group their elements by the units their keys are mapped to by
+   * the hash function and exchange all groups in a single round of
+   * one-sided puts. Every unit then inserts the elements it received in
+   * its local memory, allocating memory for all of them at once, and the
+   * map is committed in a single \c barrier().
+   *
+   * Collective operation.
+   */
+  template<class InputIterator>
+  void insert_bulk(
+    /// Iterator at first value in the range to insert.
+    InputIterator first,
+    /// Iterator past the last value in the range to insert.
+    InputIterator last)
+  {
+    DASH_LOG_DEBUG("UnorderedMap.insert_bulk()");
+    DASH_ASSERT(_globmem != nullptr);
+    std::vector< std::vector<bulk_value> > send_values(_team->size());
+    for (auto it = first; it != last; ++it) {
+      const value_type & value = *it;
+      send_values[_key_hash(value.first)].push_back(
+        bulk_value(value.first, value.second));
+    }
+    std::vector<size_type> recv_counts;
+    auto recv_values = _exchange_bulk(send_values, recv_counts);
+    _insert_local_bulk(recv_values);
+    barrier();
+    DASH_LOG_DEBUG("UnorderedMap.insert_bulk >", "size:", size());
+  }
+
+  /**
+   * Writes an iterator to the element with the key of every element in the
+   * range \c [first, last) to the range beginning at \c d_first, or
+   * \c end() if the map contains no such element.
+   * Returns an iterator past the last written iterator.
+   *
+   * Units group their keys by the units they are mapped to by the hash
+   * function and exchange all groups in a single round of one-sided puts.
+   * Every unit looks up the keys it received in its local index and
+   * returns the local offsets of the elements in a second round.
+   * Elements inserted since the last \c barrier() are not found.
+   *
+   * Collective operation.
+   */
+  template<class InputIterator, class OutputIterator>
+  OutputIterator find_bulk(
+    /// Iterator at first key in the range to look up.
+    InputIterator  first,
+    /// Iterator past the last key in the range to look up.
+    InputIterator  last,
+    /// Iterator at first position of the found elements.
+    OutputIterator d_first)
+  {
+    DASH_LOG_DEBUG("UnorderedMap.find_bulk()");
+    DASH_ASSERT(_globmem != nullptr);
+    bool      local_hash = dash::internal::is_local_hash<hasher>::value;
+    size_type nunits     = _team->size();
+    // Keys grouped by the units probed for them. Keys are not mapped to
+    // a fixed unit by dash::HashLocal and sent to all units:
+    std::vector< std::vector<key_type> > send_keys(nunits);
+    // Unit and position in the unit's group of every key:
+    std::vector< std::pair<team_unit_t, size_type> > key_pos;
+    for (auto it = first; it != last; ++it) {
+      const key_type & key  = *it;
+      team_unit_t      unit = local_hash ? team_unit_t(0) : _key_hash(key);
+      key_pos.push_back(std::make_pair(unit, send_keys[unit].size()));
+      if (local_hash) {
+        for (auto & u_keys : send_keys) {
+          u_keys.push_back(key);
+        }
+      } else {
+        send_keys[unit].push_back(key);
+      }
+    }
+    // Look up received keys in the local index:
+    std::vector<size_type> recv_counts;
+    auto recv_keys = _exchange_bulk(send_keys, recv_counts);
+    std::vector< std::vector<index_type> > send_lidx(nunits);
+    size_type recv_offset = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      for (size_type k = 0; k < recv_counts[u]; ++k) {
+        const key_type & key = recv_keys[recv_offset + k];
+        send_lidx[u].push_back(_index_find_local(key, _index_hash(key)));
+      }
+      recv_offset += recv_counts[u];
+    }
+    // Local offsets of the elements, in the order of the keys sent:
+    auto recv_lidx = _exchange_bulk(send_lidx, recv_counts);
+    std::vector<size_type> recv_offsets(nunits, 0);
+    for (size_type u = 1; u < nunits; ++u) {
+      recv_offsets[u] = recv_offsets[u - 1] + recv_counts[u - 1];
+    }
+    for (const auto & pos : key_pos) {
+      iterator found = _end;
+      for (size_type p = 0; p < (local_hash ? nunits : 1); ++p) {
+        team_unit_t u(local_hash ? p : pos.first.id);
+        index_type  lidx = recv_lidx[recv_offsets[u] + pos.second];
+        if (lidx >= 0) {
+          found = iterator(this, u, lidx);
+          break;
+        }
+      }
+      *d_first = found;
+      ++d_first;
+    }
+    DASH_LOG_DEBUG("UnorderedMap.find_bulk >", "keys:", key_pos.size());
+    return d_first;
+  }
+
+  /**
+   * Removes the element at the specified iterator position and returns an
+   * iterator to the following element.
+   *
+   * Erased elements are marked as tombstones in their unit's local
+   * memory and removed from its index, iterators skip them.
+   * Elements at remote units are erased at their unit in the next
+   * \c barrier(), until then the erasure is visible to the active unit
+   * only. Memory of erased elements is released in \c compact().
+   */
   iterator erase(
     const_iterator position)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_DEBUG("UnorderedMap.erase()", "iterator:", position);
+    auto lpos = position.lpos();
+    _erase_at(lpos.unit, lpos.index);
+    iterator next = position;
+    ++next;
+    DASH_LOG_DEBUG("UnorderedMap.erase >", next);
+    return next;
   }
 
+  /**
+   * Removes the element with the specified key, returns the number of
+   * elements removed.
+   */
   size_type erase(
     /// Key of the container element to remove.
     const key_type & key)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_DEBUG("UnorderedMap.erase()", "key:", key);
+    iterator found = find(key);
+    if (found == _end) {
+      DASH_LOG_DEBUG("UnorderedMap.erase >", "key not found");
+      return 0;
+    }
+    erase(found);
+    DASH_LOG_DEBUG("UnorderedMap.erase >", "erased");
+    return 1;
   }
 
+  /**
+   * Removes the elements in the range \c [first, last) and returns an
+   * iterator to the element following the last element removed.
+   */
   iterator erase(
     /// Iterator at first element to remove.
     const_iterator first,
     /// Iterator past the last element to remove.
     const_iterator last)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_DEBUG("UnorderedMap.erase(first,last)");
+    // Iterators skip erased elements and may step over last if it
+    // references an erased element:
+    while (first < last) {
+      first = erase(first);
+    }
+    DASH_LOG_DEBUG("UnorderedMap.erase(first,last) >", first);
+    return first;
+  }
+
+  /**
+   * Releases the memory of erased elements.
+   *
+   * Pending insertions and erasures are applied in a \c barrier(), then
+   * every unit moves its remaining elements to new global memory that is
+   * allocated for them in a single bucket, and rebuilds its index.
+   * All iterators are invalidated.
+   *
+   * Collective operation.
+   */
+  void compact()
+  {
+    DASH_LOG_DEBUG("UnorderedMap.compact()");
+    DASH_ASSERT(_globmem != nullptr);
+    barrier();
+    size_type               local_size = _local_sizes.local[0];
+    std::vector<value_type> values;
+    values.reserve(local_size - _erased_lidx.size());
+    for (size_type lidx = 0; lidx < local_size; ++lidx) {
+      if (!_is_erased(_myid, lidx)) {
+        values.push_back(*local_iterator(this, lidx));
+      }
+    }
+    DASH_LOG_TRACE("UnorderedMap.compact", "local elements:", local_size,
+                   "erased:", _erased_lidx.size());
+    // Remote units do not access the local memory of the active unit
+    // after the barrier:
+    delete _globmem;
+    _globmem = new glob_mem_type(values.size() + _local_buffer_size,
+                                 *_team);
+    _index         = std::vector<index_slot>();
+    _index_size    = 0;
+    _index_deleted = 0;
+    value_type * lptr_values = static_cast<value_type *>(
+                                 _globmem->lbegin());
+    for (size_type lidx = 0; lidx < values.size(); ++lidx) {
+      new (lptr_values + lidx) value_type(values[lidx]);
+      _index_insert(_index_hash(values[lidx].first), lidx);
+    }
+    _local_sizes.local[0] = values.size();
+    _index_next           = values.size();
+    _index_own.clear();
+    _erased.clear();
+    _erased_lidx.clear();
+    _erased_published     = 0;
+    _erased_sizes.assign(_team->size(), 0);
+    _local_cumul_sizes.assign(_team->size(), 0);
+    _remote_size          = 0;
+    _lend                 = local_iterator(this, values.size());
+    barrier();
+    DASH_LOG_DEBUG("UnorderedMap.compact >", "size:", size());
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // Asynchronous Operations
+  //////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Registers a function \c fn(mapped_type & value, const mapped_type &
+   * arg) that updates mapped values in \c async_update and returns its
+   * handle.
+   * Requests only contain the handle, all units must register their
+   * update functions in the same order.
+   */
+  template<class UpdateFunction>
+  size_type register_update(UpdateFunction fn)
+  {
+    _async_handlers.push_back(update_function(fn));
+    DASH_LOG_TRACE("UnorderedMap.register_update >",
+                   "handle:", _async_handlers.size() - 1);
+    return _async_handlers.size() - 1;
+  }
+
+  /**
+   * Applies the update function with the specified handle and argument to
+   * the mapped value of the element with the specified key at the unit
+   * owning the key, inserting an element with default-constructed mapped
+   * value if no such element exists.
+   * Returns a future of the updated mapped value.
+   *
+   * The request is written to a queue at the owning unit, which applies
+   * requests in \c progress() and writes replies back to the requesting
+   * unit. Updates of the same element are serialized at its owner.
+   * Elements inserted by remote units since the last \c barrier() are
+   * updated, but are not visible to \c async_get until the next barrier.
+   */
+  dash::Future<mapped_type> async_update(
+    const key_type    & key,
+    size_type           handle,
+    const mapped_type & arg)
+  {
+    DASH_LOG_DEBUG("UnorderedMap.async_update()", "key:", key,
+                   "handle:", handle);
+    DASH_ASSERT_LT(handle, _async_handlers.size(),
+                   "invalid update handle");
+    return _async_request(key, handle, arg);
+  }
+
+  /**
+   * Reads the mapped value of the element with the specified key at the
+   * unit owning the key.
+   * Returns a future of the mapped value, \c get() throws
+   * \c dash::exception::InvalidArgument if no element has the key.
+   *
+   * \see async_update
+   */
+  dash::Future<mapped_type> async_get(
+    const key_type & key)
+  {
+    DASH_LOG_DEBUG("UnorderedMap.async_get()", "key:", key);
+    return _async_request(key, _async_lookup(), mapped_type());
+  }
+
+  /**
+   * Applies asynchronous requests of remote units received by the active
+   * unit since the last call.
+   * Called when testing or waiting for futures of asynchronous
+   * operations and in \c barrier(), units that do not wait for their own
+   * requests should call it regularly.
+   */
+  void progress()
+  {
+    if (_async_queue == nullptr) {
+      return;
+    }
+    // Atomic read of the number of reserved tickets, also progresses
+    // one-sided operations of remote units:
+    size_type ntickets = _async_counter(_myid, 0).fetch_and_add(0);
+    while (_async_head < ntickets) {
+      dart_gptr_t gptr_req = _async_queue->at(
+                               _myid, _async_head % _async_capacity
+                             ).dart_gptr();
+      // Stop at requests that have not been written completely:
+      if (_async_load_seq<async_request>(gptr_req) != _async_head + 1) {
+        break;
+      }
+      async_request request;
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(
+          &request,
+          gptr_req,
+          sizeof(async_request),
+          DART_TYPE_BYTE),
+        DART_OK);
+      async_reply reply = _async_apply(request);
+      reply.seq         = request.id + 1;
+      _async_store(
+        _async_replies->at(
+          team_unit_t(request.origin),
+          request.id % _async_capacity
+        ).dart_gptr(),
+        reply);
+      ++_async_head;
+      ++_async_processed;
+      // Release the slot to units waiting for free slots in the queue:
+      _async_counter(_myid, 1).add(1);
+      DASH_LOG_TRACE("UnorderedMap.progress", "applied request",
+                     "origin:", request.origin, "id:", request.id);
+    }
   }
 
   //////////////////////////////////////////////////////////////////////////
@@ -677,7 +1161,7 @@ public:
   inline size_type bucket_size(size_type bucket_index) const
   {
     size_type   bsize = _local_sizes[bucket_index];
-    return bsize;
+    return bsize - _erased_sizes[bucket_index];
   }
 
   //////////////////////////////////////////////////////////////////////////
@@ -696,80 +1180,1725 @@ public:
 
 private:
   /**
-   * Insert value at specified unit.
+   * Slot in the open-addressing index of a unit's local elements.
    */
-  std::pair<iterator, bool> _insert_at(
-    team_unit_t        unit,
-    /// The element to insert.
-    const value_type & value)
+  struct index_slot
   {
-    auto key    = value.first;
-    auto mapped = value.second;
-    DASH_LOG_TRACE("UnorderedMap._insert_at()",
-                   "unit:",   unit,
-                   "key:",    key,
-                   "mapped:", mapped);
-    auto result = std::make_pair(_end, false);
-    // Increase local size first to reserve storage for the new element.
-    // Use atomic increment to prevent hazard when other units perform
-    // remote insertion at the local unit:
-    size_type old_local_size   = dash::Atomic<size_type>(
-                                    _local_size_gptr
-                                 ).fetch_and_add(1);
-    size_type new_local_size   = old_local_size + 1;
-    size_type local_capacity   = _globmem->local_size();
-    _local_cumul_sizes[unit]  += 1;
-    DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", local_capacity);
-    DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _local_buffer_size);
-    DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", old_local_size);
-    DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", new_local_size);
-    DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _local_cumul_sizes[_myid]);
-    DASH_ASSERT_GT(new_local_size, 0, "new local size is 0");
-    // Pointer to new element:
-    value_type * lptr_insert = nullptr;
-    // Acquire target pointer of new element:
-    if (new_local_size > local_capacity) {
-      DASH_LOG_TRACE("UnorderedMap._insert_at",
-                     "globmem.grow(", _local_buffer_size, ")");
-      lptr_insert = static_cast<value_type *>(
-                      _globmem->grow(_local_buffer_size));
-    } else {
-      lptr_insert = static_cast<value_type *>(
-                      _globmem->lbegin() + old_local_size);
+    /// Hash of the element's key, see \c _index_hash.
+    size_type  hash;
+    /// Local offset of the element, -1 for empty slots and -2 for slots
+    /// of erased elements.
+    index_type lidx;
+  };
+
+  /**
+   * Element inserted at a remote unit since the last barrier.
+   */
+  struct remote_insert
+  {
+    /// Target unit of the element.
+    team_unit_t unit;
+    /// Local offset of the slot reserved at the target unit.
+    size_type   lidx;
+    /// Whether the slot exceeds the target unit's attached memory and the
+    /// element is written in the next barrier.
+    bool        staged;
+  };
+
+  /**
+   * States of slots in the tables of keys inserted at every unit since the
+   * last barrier and of the links between tables, see \c _claim_key.
+   * Slots of claimed keys store the local offset of their element, see
+   * \c _claim_state.
+   */
+  enum claim_slot_state : size_type
+  {
+    /// Slot is not claimed, or no table is linked.
+    claim_free   = 0,
+    /// Slot is claimed and its key and element are being written, or the
+    /// linked table is being allocated.
+    claim_busy   = 1,
+    /// Linked table has been allocated.
+    claim_linked = 2
+  };
+
+  /**
+   * Key in a slot of the tables of keys inserted at every unit since the
+   * last barrier.
+   */
+  struct claimed_key
+  {
+    /// Hash of the key, see \c _index_hash.
+    size_type  hash;
+    /// Element with the claimed key, holds the element's value if the
+    /// element is staged and written in the next barrier.
+    value_type value;
+  };
+
+  /**
+   * Table of keys inserted at a unit since the last barrier, see
+   * \c _claim_key.
+   */
+  struct claim_table
+  {
+    /// Number of slots in the table, a power of two.
+    size_type   capacity;
+    /// States of the slots, see \c claim_slot_state.
+    dart_gptr_t states;
+    /// Keys in the slots, see \c claimed_key.
+    dart_gptr_t keys;
+    /// Link to the table probed after the table, see \c claim_link.
+    dart_gptr_t link;
+  };
+
+  /**
+   * Link to the table of claimed keys probed if no slot is free in a
+   * table, allocated by the first unit following the link.
+   */
+  struct claim_link
+  {
+    /// State of the link, see \c claim_slot_state.
+    size_type   state;
+    /// The linked table.
+    claim_table next;
+  };
+
+  /**
+   * Result of claiming a key in the tables of keys inserted at a unit
+   * since the last barrier, see \c _claim_key.
+   */
+  struct key_claim
+  {
+    /// \c claim_busy if the key has been claimed by the active unit, the
+    /// state of the slot if the key has been claimed by another unit, or
+    /// \c claim_free if keys are not claimed.
+    size_type   state;
+    /// State of the slot of the key.
+    dart_gptr_t state_gptr;
+    /// Key and element in the slot of the key.
+    dart_gptr_t key_gptr;
+  };
+
+  /**
+   * Element in bulk exchanges between units, see \c _exchange_bulk.
+   */
+  typedef std::pair<key_type, mapped_type> bulk_value;
+
+  /**
+   * Asynchronous request in the queue of the unit owning its key, see
+   * \c async_update.
+   */
+  struct async_request
+  {
+    key_type    key;
+    /// Argument of the update function.
+    mapped_type arg;
+    /// Handle of the update function, or \c _async_lookup() for reads.
+    size_type   handle;
+    /// Id of the request at the requesting unit.
+    size_type   id;
+    /// Team-relative id of the requesting unit.
+    size_type   origin;
+    /// Ticket of the request in the queue plus one, written after the
+    /// other members.
+    size_type   seq;
+  };
+
+  /**
+   * Reply to an asynchronous request, written to the requesting unit.
+   */
+  struct async_reply
+  {
+    /// Mapped value of the element after the request has been applied.
+    mapped_type value;
+    /// Whether an element with the requested key exists.
+    size_type   found;
+    /// Id of the request plus one, written after the other members.
+    size_type   seq;
+  };
+
+  /**
+   * Function applied to mapped values in asynchronous updates, see
+   * \c register_update.
+   */
+  typedef std::function<void(mapped_type &, const mapped_type &)>
+    update_function;
+
+  /**
+   * Sends the elements in \c send_values[u] to unit \c u for every unit
+   * in the team in a single round of one-sided puts. Returns the received
+   * elements, grouped by the units that sent them in ascending order of
+   * unit ids, and sets \c recv_counts[u] to the number of elements
+   * received from unit \c u.
+   *
+   * Units exchange the number of elements they send to every unit and
+   * allocate a receive buffer for the maximum number of elements received
+   * by any unit, where every sender writes its elements at the offset
+   * following the elements of the preceding senders.
+   *
+   * Collective operation.
+   */
+  template<typename ValueType>
+  std::vector<ValueType> _exchange_bulk(
+    const std::vector< std::vector<ValueType> > & send_values,
+    std::vector<size_type>                      & recv_counts)
+  {
+    size_type nunits = _team->size();
+    // Number of elements sent by unit s to unit u at s * nunits + u:
+    std::vector<size_type> l_counts(nunits);
+    std::vector<size_type> g_counts(nunits * nunits);
+    for (size_type u = 0; u < nunits; ++u) {
+      l_counts[u] = send_values[u].size();
     }
-    // Assign new value to insert position.
-    DASH_LOG_TRACE("UnorderedMap._insert_at", "value target address:",
-                   lptr_insert);
-    DASH_ASSERT(lptr_insert != nullptr);
-    // Using placement new to avoid assignment/copy as value_type is
-    // const:
-    new (lptr_insert) value_type(value);
-    // Convert local iterator to global iterator:
-    DASH_LOG_TRACE("UnorderedMap._insert_at", "converting to global iterator",
-                   "unit:", unit, "lidx:", old_local_size);
-    result.first  = iterator(this, unit, old_local_size);
-    result.second = true;
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        l_counts.data(),
+        g_counts.data(),
+        nunits * sizeof(size_type),
+        DART_TYPE_BYTE,
+        _team->dart_id()),
+      DART_OK);
+    size_type max_recv = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      size_type u_recv = 0;
+      for (size_type s = 0; s < nunits; ++s) {
+        u_recv += g_counts[s * nunits + u];
+      }
+      max_recv = std::max(max_recv, u_recv);
+    }
+    recv_counts.resize(nunits);
+    size_type n_recv = 0;
+    for (size_type s = 0; s < nunits; ++s) {
+      recv_counts[s] = g_counts[s * nunits + _myid];
+      n_recv        += recv_counts[s];
+    }
+    DASH_LOG_TRACE("UnorderedMap._exchange_bulk", "received:", n_recv,
+                   "max. received by any unit:", max_recv);
+    std::vector<ValueType> recv_values(n_recv);
+    if (max_recv == 0) {
+      return recv_values;
+    }
+    dash::GlobMem<ValueType> recv_buf(max_recv, *_team);
+    dart_gptr_t gptr_last = DART_GPTR_NULL;
+    for (size_type u = 0; u < nunits; ++u) {
+      if (l_counts[u] == 0) {
+        continue;
+      }
+      // Offset following the elements of the preceding senders:
+      size_type offset = 0;
+      for (size_type s = 0; s < static_cast<size_type>(_myid); ++s) {
+        offset += g_counts[s * nunits + u];
+      }
+      if (u == static_cast<size_type>(_myid)) {
+        std::copy(send_values[u].begin(), send_values[u].end(),
+                  recv_buf.lbegin() + offset);
+        continue;
+      }
+      gptr_last = recv_buf.at(team_unit_t(u), offset).dart_gptr();
+      dart_storage_t ds = dash::dart_storage<ValueType>(l_counts[u]);
+      DASH_ASSERT_RETURNS(
+        dart_put(
+          gptr_last,
+          send_values[u].data(),
+          ds.nelem,
+          ds.dtype),
+        DART_OK);
+    }
+    if (!DART_GPTR_ISNULL(gptr_last)) {
+      DASH_ASSERT_RETURNS(
+        dart_flush_all(gptr_last),
+        DART_OK);
+    }
+    _team->barrier();
+    std::copy(recv_buf.lbegin(), recv_buf.lbegin() + n_recv,
+              recv_values.begin());
+    return recv_values;
+  }
 
-    if (unit != _myid) {
-      DASH_LOG_TRACE("UnorderedMap.insert", "remote insertion");
-      // Mark inserted element for move to remote unit in next commit:
-      _move_elements.push_back(result.first);
+  /**
+   * Inserts elements in local memory, elements with keys equivalent to
+   * local elements or to preceding elements are not inserted.
+   * Memory for all elements is allocated in a single call of
+   * \c globmem.grow().
+   * Remote units must not insert elements at the active unit concurrently.
+   */
+  void _insert_local_bulk(
+    const std::vector<bulk_value> & values)
+  {
+    size_type local_size     = _local_sizes.local[0];
+    size_type local_capacity = _globmem->local_size();
+    if (local_size + values.size() > local_capacity) {
+      size_type grow_size = std::max(
+                              _local_buffer_size,
+                              local_size + values.size() - local_capacity);
+      DASH_LOG_TRACE("UnorderedMap._insert_local_bulk",
+                     "globmem.grow(", grow_size, ")");
+      _globmem->grow(grow_size);
+    }
+    size_type old_local_size = local_size;
+    for (const auto & value : values) {
+      size_type hash = _index_hash(value.first);
+      if (_index_find_local(value.first, hash) >= 0) {
+        continue;
+      }
+      value_type * lptr_insert = static_cast<value_type *>(
+                                   _globmem->lbegin() + local_size);
+      new (lptr_insert) value_type(value.first, value.second);
+      _index_insert(hash, local_size);
+      _index_own.push_back(local_size);
+      ++local_size;
     }
+    _local_sizes.local[0] = local_size;
+    _extend_known_size(_myid, local_size);
+    _update_end();
+    DASH_LOG_TRACE("UnorderedMap._insert_local_bulk", "received:",
+                   values.size(), "inserted:", local_size - old_local_size);
+  }
 
-    // Update iterators as global memory space has been changed for the
-    // active unit:
-    auto new_size = size();
-    DASH_LOG_TRACE("UnorderedMap._insert_at", "new size:", new_size);
-    DASH_LOG_TRACE("UnorderedMap._insert_at", "updating _begin");
-    _begin        = iterator(this, 0);
-    DASH_LOG_TRACE("UnorderedMap._insert_at", "updating _end");
-    _end          = iterator(this, new_size);
-    DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _begin);
-    DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _end);
-    DASH_LOG_DEBUG("UnorderedMap._insert_at >",
-                   (result.second ? "inserted" : "existing"), ":",
-                   result.first);
-    return result;
+  /**
+   * Hash of a key in the index of local elements, independent from the
+   * mapping of keys to units by the hash function of the map.
+   */
+  static size_type _index_hash(const key_type & key)
+  {
+    // Mixed to spread keys in regular strides like the keys mapped to a
+    // single unit by a cyclic hash function:
+    return static_cast<size_type>(
+             dash::internal::hash_mix(
+               static_cast<uint64_t>(std::hash<key_type>()(key))));
+  }
+
+  /**
+   * Places a slot at the first empty position of its probe sequence.
+   */
+  static void _index_place(
+    std::vector<index_slot> & slots,
+    const index_slot        & slot)
+  {
+    size_type mask = slots.size() - 1;
+    size_type s    = slot.hash & mask;
+    while (slots[s].lidx >= 0) {
+      s = (s + 1) & mask;
+    }
+    slots[s] = slot;
+  }
+
+  /**
+   * Adds the local element at the specified local offset to the index of
+   * local elements. The index is rehashed such that at least half of its
+   * slots are empty, removing slots of erased elements.
+   */
+  void _index_insert(
+    size_type  hash,
+    index_type lidx)
+  {
+    if (2 * (_index_size + _index_deleted + 1) > _index.size()) {
+      size_type capacity = 16;
+      while (capacity < 2 * (_index_size + 1)) {
+        capacity *= 2;
+      }
+      DASH_LOG_TRACE("UnorderedMap._index_insert", "rehash, capacity:",
+                     capacity);
+      std::vector<index_slot> slots(capacity, index_slot { 0, -1 });
+      for (const auto & slot : _index) {
+        if (slot.lidx >= 0) {
+          _index_place(slots, slot);
+        }
+      }
+      _index.swap(slots);
+      _index_deleted = 0;
+    }
+    _index_place(_index, index_slot { hash, lidx });
+    ++_index_size;
+  }
+
+  /**
+   * Removes the local element at the specified local offset from the
+   * index of local elements, its slot is marked as erased to preserve
+   * the probe sequences of other elements.
+   */
+  void _index_erase(
+    size_type  hash,
+    index_type lidx)
+  {
+    if (_index.empty()) {
+      return;
+    }
+    size_type mask = _index.size() - 1;
+    for (size_type s = hash & mask; _index[s].lidx != -1;
+         s = (s + 1) & mask) {
+      if (_index[s].lidx == lidx) {
+        _index[s].lidx = -2;
+        --_index_size;
+        ++_index_deleted;
+        return;
+      }
+    }
+  }
+
+  /**
+   * Local offset of the local element with the specified key, or -1 if
+   * no local element has this key.
+   */
+  index_type _index_find_local(
+    const key_type & key,
+    size_type        hash) const
+  {
+    if (_index.empty()) {
+      return -1;
+    }
+    size_type mask = _index.size() - 1;
+    for (size_type s = hash & mask; ; s = (s + 1) & mask) {
+      const index_slot & slot = _index[s];
+      if (slot.lidx == -1) {
+        return -1;
+      }
+      if (slot.lidx >= 0 && slot.hash == hash) {
+        const value_type & value = *local_iterator(
+                                      const_cast<self_t *>(this),
+                                      slot.lidx);
+        if (_key_equal(value.first, key)) {
+          return slot.lidx;
+        }
+      }
+    }
+  }
+
+  /**
+   * Local offset of the element with the specified key at a remote unit,
+   * or -1 if the unit has no element with this key.
+   * Probes the index of the unit published in the last \c barrier() in
+   * one-sided reads of consecutive slots.
+   */
+  index_type _index_find_remote(
+    team_unit_t      unit,
+    const key_type & key,
+    size_type        hash) const
+  {
+    // Number of slots read in a single operation:
+    const size_type probe_slots = 8;
+    size_type capacity = _index_capacities[unit];
+    if (capacity == 0) {
+      return -1;
+    }
+    size_type  mask = capacity - 1;
+    size_type  s    = hash & mask;
+    index_slot slots[probe_slots];
+    while (true) {
+      // Slots up to the end of the unit's index:
+      size_type      nslots = std::min(probe_slots, capacity - s);
+      dart_storage_t ds     = dash::dart_storage<index_slot>(nslots);
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(
+          slots,
+          _glob_index->at(unit, s).dart_gptr(),
+          ds.nelem,
+          ds.dtype),
+        DART_OK);
+      for (size_type i = 0; i < nslots; ++i) {
+        if (slots[i].lidx == -1) {
+          return -1;
+        }
+        if (slots[i].lidx >= 0 && slots[i].hash == hash) {
+          value_type value = *iterator(const_cast<self_t *>(this),
+                                       unit, slots[i].lidx);
+          if (_key_equal(value.first, key)) {
+            return slots[i].lidx;
+          }
+        }
+      }
+      s = (s + nslots) & mask;
+    }
+  }
+
+  /**
+   * Iterator to the element with the specified key, probing the index of
+   * the unit the key is mapped to by the hash function.
+   */
+  iterator _find(const key_type & key)
+  {
+    bool        local_hash = dash::internal::is_local_hash<hasher>::value;
+    size_type   nunits     = _team->size();
+    size_type   nprobe     = local_hash ? nunits : 1;
+    team_unit_t unit       = local_hash ? _myid : _key_hash(key);
+    size_type   hash       = _index_hash(key);
+    if (!local_hash && unit != _myid) {
+      // Elements inserted at the unit by the active unit since the last
+      // barrier are not contained in the unit's published index yet:
+      auto pending = _find_remote_insert(key, hash);
+      if (pending != nullptr) {
+        return iterator(this, pending->unit, pending->lidx);
+      }
+    }
+    for (size_type p = 0; p < nprobe; ++p) {
+      team_unit_t u((unit.id + p) % nunits);
+      index_type  lidx = (u == _myid)
+                         ? _index_find_local(key, hash)
+                         : _index_find_remote(u, key, hash);
+      DASH_LOG_TRACE("UnorderedMap._find", "unit:", u, "lidx:", lidx);
+      // Elements at remote units erased by the active unit since the last
+      // barrier are still contained in the unit's published index:
+      if (lidx >= 0 && !_is_erased(u, lidx)) {
+        return iterator(this, u, lidx);
+      }
+    }
+    return _end;
+  }
+
+  /**
+   * Publishes the index of local elements to global memory where it can
+   * be probed by remote units.
+   *
+   * Collective operation.
+   */
+  void _publish_index()
+  {
+    size_type l_capacity = _index.size();
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        &l_capacity,
+        _index_capacities.data(),
+        sizeof(size_type),
+        DART_TYPE_BYTE,
+        _team->dart_id()),
+      DART_OK);
+    size_type max_capacity = *std::max_element(_index_capacities.begin(),
+                                               _index_capacities.end());
+    size_type glob_capacity = 0;
+    if (_glob_index != nullptr) {
+      glob_capacity = _glob_index->lend() - _glob_index->lbegin();
+    }
+    if (max_capacity > glob_capacity) {
+      DASH_LOG_TRACE("UnorderedMap._publish_index",
+                     "reallocate, capacity:", max_capacity);
+      delete _glob_index;
+      _glob_index = new dash::GlobMem<index_slot>(max_capacity, *_team);
+    }
+    if (!_index.empty()) {
+      std::copy(_index.begin(), _index.end(), _glob_index->lbegin());
+    }
+  }
+
+  /**
+   * Global reference to the mapped value of the element at the specified
+   * iterator position.
+   */
+  mapped_type_reference _mapped_at(iterator git_value)
+  {
+    auto          lpos        = git_value.lpos();
+    // Elements written in the next barrier are in the slots of their keys
+    // in the tables of claimed keys:
+    dart_gptr_t   gptr_mapped = _staged_gptr(lpos.unit, lpos.index);
+    value_type  * lptr_value  = nullptr;
+    if (DART_GPTR_ISNULL(gptr_mapped)) {
+      lptr_value = static_cast<value_type *>(git_value.local());
+    }
+    if (lptr_value == nullptr && DART_GPTR_ISNULL(gptr_mapped)) {
+      gptr_mapped = git_value.dart_gptr();
+    }
+    mapped_type * lptr_mapped = nullptr;
+    DASH_LOG_TRACE("UnorderedMap._mapped_at", "gptr to element:",
+                   gptr_mapped);
+    DASH_LOG_TRACE("UnorderedMap._mapped_at", "lptr to element:",
+                   lptr_value);
+    // Byte offset of mapped value in element type:
+    auto          mapped_offs = offsetof(value_type, second);
+    DASH_LOG_TRACE("UnorderedMap._mapped_at",
+                   "byte offset of mapped member:", mapped_offs);
+    // Increment pointers to element by byte offset of mapped value member:
+    if (lptr_value != nullptr) {
+      // Convert to char pointer for byte-wise increment:
+      char * b_lptr_mapped  = reinterpret_cast<char *>(lptr_value);
+      b_lptr_mapped        += mapped_offs;
+      // Convert to mapped type pointer:
+      lptr_mapped           = reinterpret_cast<mapped_type *>(b_lptr_mapped);
+    }
+    if (!DART_GPTR_ISNULL(gptr_mapped)) {
+      DASH_ASSERT_RETURNS(
+        dart_gptr_incaddr(&gptr_mapped, mapped_offs),
+        DART_OK);
+    }
+    DASH_LOG_TRACE("UnorderedMap._mapped_at", "gptr to mapped member:",
+                   gptr_mapped);
+    DASH_LOG_TRACE("UnorderedMap._mapped_at", "lptr to mapped member:",
+                   lptr_mapped);
+    // Create global reference to mapped value member in element:
+    return mapped_type_reference(gptr_mapped, lptr_mapped);
+  }
+
+  /**
+   * Insert value at specified unit.
+   */
+  std::pair<iterator, bool> _insert_at(
+    team_unit_t        unit,
+    /// The element to insert.
+    const value_type & value)
+  {
+    auto key    = value.first;
+    auto mapped = value.second;
+    DASH_LOG_TRACE("UnorderedMap._insert_at()",
+                   "unit:",   unit,
+                   "key:",    key,
+                   "mapped:", mapped);
+    if (unit != _myid) {
+      return _insert_remote(unit, value);
+    }
+    // Claim the key such that remote units inserting an equivalent key
+    // since the last barrier obtain the new element:
+    key_claim claim = _claim_key(unit, value, _index_hash(key));
+    if (claim.state != claim_free && claim.state != claim_busy) {
+      return _claimed_element(unit, claim);
+    }
+    return _insert_local(value, claim);
+  }
+
+  /**
+   * Insert value at the active unit and complete the claim of its key,
+   * see \c _claim_key.
+   */
+  std::pair<iterator, bool> _insert_local(
+    /// The element to insert.
+    const value_type & value,
+    /// Claim of the element's key.
+    const key_claim  & claim)
+  {
+    auto unit   = _myid;
+    auto key    = value.first;
+    auto result = std::make_pair(_end, false);
+    // Increase local size first to reserve storage for the new element.
+    // Use atomic increment to prevent hazard when other units perform
+    // remote insertion at the local unit:
+    size_type old_local_size   = dash::Atomic<size_type>(
+                                    _local_size_gptr
+                                 ).fetch_and_add(1);
+    size_type new_local_size   = old_local_size + 1;
+    size_type local_capacity   = _globmem->local_size();
+    // Remote units cannot access elements beyond the memory attached in
+    // the last barrier:
+    bool      staged           = old_local_size >= _local_attached;
+    DASH_LOG_TRACE_VAR("UnorderedMap._insert_local", local_capacity);
+    DASH_LOG_TRACE_VAR("UnorderedMap._insert_local", _local_buffer_size);
+    DASH_LOG_TRACE_VAR("UnorderedMap._insert_local", old_local_size);
+    DASH_LOG_TRACE_VAR("UnorderedMap._insert_local", new_local_size);
+    DASH_ASSERT_GT(new_local_size, 0, "new local size is 0");
+    // Acquire storage of new element, slots reserved by remote units
+    // since the last barrier may exceed the local capacity by more than
+    // the buffer size:
+    if (new_local_size > local_capacity) {
+      size_type grow_size = std::max(_local_buffer_size,
+                                     new_local_size - local_capacity);
+      DASH_LOG_TRACE("UnorderedMap._insert_local",
+                     "globmem.grow(", grow_size, ")");
+      _globmem->grow(grow_size);
+    }
+    // Pointer to new element:
+    value_type * lptr_insert = static_cast<value_type *>(
+                                 _globmem->lbegin() + old_local_size);
+    // Assign new value to insert position.
+    DASH_LOG_TRACE("UnorderedMap._insert_local", "value target address:",
+                   lptr_insert);
+    DASH_ASSERT(lptr_insert != nullptr);
+    // Using placement new to avoid assignment/copy as value_type is
+    // const:
+    new (lptr_insert) value_type(value);
+    _index_insert(_index_hash(key), old_local_size);
+    _index_own.push_back(old_local_size);
+    if (staged && claim.state == claim_busy) {
+      _claims_staged.insert(
+        std::make_pair(_slot_key(unit, old_local_size), claim.key_gptr));
+    }
+    _complete_claim(claim, old_local_size, staged);
+    _extend_known_size(unit, new_local_size);
+    // Convert local iterator to global iterator:
+    DASH_LOG_TRACE("UnorderedMap._insert_local",
+                   "converting to global iterator",
+                   "unit:", unit, "lidx:", old_local_size);
+    result.first  = iterator(this, unit, old_local_size);
+    result.second = true;
+    _update_end();
+    DASH_LOG_DEBUG("UnorderedMap._insert_local >",
+                   (result.second ? "inserted" : "existing"), ":",
+                   result.first);
+    return result;
+  }
+
+  /**
+   * Insert value at specified remote unit.
+   *
+   * The key is claimed in the unit's tables of keys inserted since the
+   * last barrier, see \c _claim_key. If the key has been claimed by
+   * another unit, no element is inserted.
+   * A slot in the unit's local elements is reserved by an atomic increment
+   * of the unit's local size. If the slot is in the memory the unit
+   * attached in the last barrier, the value is written to it directly.
+   * Otherwise, the element is staged in the slot of its key and written
+   * in the next barrier after the unit attached memory for all reserved
+   * slots.
+   */
+  std::pair<iterator, bool> _insert_remote(
+    team_unit_t        unit,
+    /// The element to insert.
+    const value_type & value)
+  {
+    key_claim claim = _claim_key(unit, value, _index_hash(value.first));
+    DASH_ASSERT(claim.state != claim_free);
+    if (claim.state != claim_busy) {
+      return _claimed_element(unit, claim);
+    }
+    size_type lidx   = dash::Atomic<size_type>(
+                         _local_sizes[unit].dart_gptr()
+                       ).fetch_and_add(1);
+    bool      staged = lidx >= _globmem->local_size(unit);
+    DASH_LOG_TRACE("UnorderedMap._insert_remote", "unit:", unit,
+                   "lidx:", lidx, "staged:", staged);
+    if (!staged) {
+      dart_storage_t ds = dash::dart_storage<value_type>(1);
+      DASH_ASSERT_RETURNS(
+        dart_put_blocking(
+          _globmem->at(unit, lidx).dart_gptr(),
+          &value,
+          ds.nelem,
+          ds.dtype),
+        DART_OK);
+    }
+    _remote_index.insert(
+      std::make_pair(_index_hash(value.first), _remote_inserts.size()));
+    if (staged) {
+      _claims_staged.insert(
+        std::make_pair(_slot_key(unit, lidx), claim.key_gptr));
+    }
+    _remote_inserts.push_back(remote_insert { unit, lidx, staged });
+    _remote_values.push_back(value);
+    _complete_claim(claim, lidx, staged);
+    _extend_known_size(unit, lidx + 1);
+    auto result = std::make_pair(iterator(this, unit, lidx), true);
+    _update_end();
+    DASH_LOG_DEBUG("UnorderedMap._insert_remote >", result.first);
+    return result;
+  }
+
+  /**
+   * Element inserted at a remote unit by the active unit since the last
+   * barrier with the specified key, or \c nullptr if no such element
+   * exists.
+   */
+  const remote_insert * _find_remote_insert(
+    const key_type & key,
+    size_type        hash) const
+  {
+    auto range = _remote_index.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      const remote_insert & pending = _remote_inserts[it->second];
+      if (_key_equal(_remote_values[it->second].first, key) &&
+          !_is_erased(pending.unit, pending.lidx)) {
+        return &pending;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * Claims the key of the specified element in the tables of keys
+   * inserted at the specified unit since the last barrier, such that of
+   * units inserting equivalent keys concurrently only one inserts an
+   * element.
+   *
+   * Slots are probed linearly from the key's hash and claimed in an atomic
+   * compare-and-swap. The claiming unit writes the key and element to the
+   * slot, and stores the local offset of the inserted element in the
+   * slot's state in \c _complete_claim, units probing the slot wait until
+   * then. Claims of elements erased by the active unit are skipped.
+   * If no slot is free in a limited number of probes, the table linked to
+   * the probed table is probed next, see \c _next_claim_table.
+   * Slots and links are not released before the next barrier, so units
+   * probe equivalent keys in the same sequence of slots.
+   */
+  key_claim _claim_key(
+    team_unit_t        unit,
+    const value_type & value,
+    size_type          hash)
+  {
+    key_claim claim { claim_free, DART_GPTR_NULL, DART_GPTR_NULL };
+    if (_claim_states == nullptr) {
+      return claim;
+    }
+    // Maximum number of slots probed in a table:
+    const size_type max_probes = 32;
+    size_type       states[max_probes];
+    claimed_key     keys[max_probes];
+    claim_table     table      = _claim_table(unit);
+    while (true) {
+      size_type mask    = table.capacity - 1;
+      size_type nprobes = std::min(max_probes, table.capacity);
+      for (size_type n = 0; n < nprobes; ) {
+        // Read states and keys of consecutive slots up to the end of the
+        // table at once, states first so keys of completed claims are
+        // written:
+        size_type s      = (hash + n) & mask;
+        size_type nslots = std::min(nprobes - n, table.capacity - s);
+        dart_storage_t states_ds = dash::dart_storage<size_type>(nslots);
+        dart_storage_t keys_ds   = dash::dart_storage<claimed_key>(nslots);
+        DASH_ASSERT_RETURNS(
+          dart_get_blocking(
+            states,
+            _claim_slot_gptr(table.states, s, sizeof(size_type)),
+            states_ds.nelem,
+            states_ds.dtype),
+          DART_OK);
+        DASH_ASSERT_RETURNS(
+          dart_get_blocking(
+            keys,
+            _claim_slot_gptr(table.keys, s, sizeof(claimed_key)),
+            keys_ds.nelem,
+            keys_ds.dtype),
+          DART_OK);
+        for (size_type i = 0; i < nslots; ++i, ++n) {
+          claim.state_gptr = _claim_slot_gptr(
+                               table.states, s + i, sizeof(size_type));
+          claim.key_gptr   = _claim_slot_gptr(
+                               table.keys, s + i, sizeof(claimed_key));
+          claim.state      = states[i];
+          dash::Atomic<size_type> slot_state(claim.state_gptr, *_team);
+          if (claim.state == claim_free) {
+            // Slots are never released before the next barrier, so a key
+            // equivalent to the specified key is not claimed in a slot
+            // after a free slot:
+            claim.state = slot_state.compare_exchange(claim_free, claim_busy);
+            if (claim.state == claim_free) {
+              claimed_key    claimed { hash, value };
+              dart_storage_t ds = dash::dart_storage<claimed_key>(1);
+              DASH_ASSERT_RETURNS(
+                dart_put_blocking(
+                  claim.key_gptr,
+                  &claimed,
+                  ds.nelem,
+                  ds.dtype),
+                DART_OK);
+              claim.state = claim_busy;
+              return claim;
+            }
+          }
+          if (states[i] == claim_free || states[i] == claim_busy) {
+            // Key has not been read from a completed claim:
+            while (claim.state == claim_busy) {
+              // Let the claiming unit complete the claim if units share
+              // processors:
+              std::this_thread::yield();
+              claim.state = slot_state.fetch_and_add(0);
+            }
+            dart_storage_t ds = dash::dart_storage<claimed_key>(1);
+            DASH_ASSERT_RETURNS(
+              dart_get_blocking(
+                &keys[i],
+                claim.key_gptr,
+                ds.nelem,
+                ds.dtype),
+              DART_OK);
+          }
+          if (keys[i].hash == hash &&
+              _key_equal(keys[i].value.first, value.first) &&
+              !_is_erased(unit, _claim_lidx(claim.state))) {
+            return claim;
+          }
+        }
+      }
+      table = _next_claim_table(table);
+    }
+  }
+
+  /**
+   * Global pointer to the slot at the specified offset in a claim table
+   * with slots of the specified size.
+   */
+  static dart_gptr_t _claim_slot_gptr(
+    dart_gptr_t gptr,
+    size_type   slot,
+    size_type   slot_size)
+  {
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr, slot * slot_size),
+      DART_OK);
+    return gptr;
+  }
+
+  /**
+   * Table of keys inserted at the specified unit since the last barrier
+   * that is probed first, allocated in \c _allocate_claims.
+   */
+  claim_table _claim_table(
+    team_unit_t unit)
+  {
+    return claim_table {
+             _claim_capacity,
+             _claim_states->at(unit, 0).dart_gptr(),
+             _claim_keys->at(unit, 0).dart_gptr(),
+             _claim_links->at(unit, 0).dart_gptr() };
+  }
+
+  /**
+   * Table of claimed keys linked to the specified table.
+   * The first unit following the link allocates the linked table with
+   * twice the capacity in its local memory, other units wait until the
+   * link has been written.
+   */
+  claim_table _next_claim_table(
+    const claim_table & table)
+  {
+    dash::Atomic<size_type> link_state(table.link, *_team);
+    dart_gptr_t             gptr_next = table.link;
+    dart_storage_t          ds        = dash::dart_storage<claim_table>(1);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr_next, offsetof(claim_link, next)),
+      DART_OK);
+    claim_table next;
+    size_type   state = link_state.compare_exchange(claim_free, claim_busy);
+    if (state == claim_free) {
+      next = _allocate_claim_table(2 * table.capacity);
+      DASH_ASSERT_RETURNS(
+        dart_put_blocking(
+          gptr_next,
+          &next,
+          ds.nelem,
+          ds.dtype),
+        DART_OK);
+      link_state.compare_exchange(claim_busy, claim_linked);
+      return next;
+    }
+    while (state == claim_busy) {
+      std::this_thread::yield();
+      state = link_state.fetch_and_add(0);
+    }
+    DASH_ASSERT_RETURNS(
+      dart_get_blocking(
+        &next,
+        gptr_next,
+        ds.nelem,
+        ds.dtype),
+      DART_OK);
+    return next;
+  }
+
+  /**
+   * Allocates a table of claimed keys with the specified number of slots
+   * in the local memory of the active unit, released in the next barrier.
+   */
+  claim_table _allocate_claim_table(
+    size_type capacity)
+  {
+    DASH_LOG_TRACE("UnorderedMap._allocate_claim_table", "capacity:",
+                   capacity);
+    claim_table    table;
+    dart_storage_t ds_states = dash::dart_storage<size_type>(capacity);
+    dart_storage_t ds_keys   = dash::dart_storage<claimed_key>(capacity);
+    dart_storage_t ds_link   = dash::dart_storage<claim_link>(1);
+    table.capacity = capacity;
+    DASH_ASSERT_RETURNS(
+      dart_memalloc(ds_states.nelem, ds_states.dtype, &table.states),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_memalloc(ds_keys.nelem, ds_keys.dtype, &table.keys),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_memalloc(ds_link.nelem, ds_link.dtype, &table.link),
+      DART_OK);
+    size_type  * states;
+    claim_link * link;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(table.states, reinterpret_cast<void **>(&states)),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(table.link, reinterpret_cast<void **>(&link)),
+      DART_OK);
+    std::fill(states, states + capacity,
+              static_cast<size_type>(claim_free));
+    link->state = claim_free;
+    _claim_overflow.push_back(table);
+    return table;
+  }
+
+  /**
+   * Releases the tables of claimed keys allocated by the active unit in
+   * \c _allocate_claim_table and returns the number of claimed slots in
+   * them.
+   */
+  size_type _free_claim_overflow()
+  {
+    size_type nclaims = 0;
+    for (const auto & table : _claim_overflow) {
+      size_type * states;
+      DASH_ASSERT_RETURNS(
+        dart_gptr_getaddr(table.states, reinterpret_cast<void **>(&states)),
+        DART_OK);
+      nclaims += std::count_if(
+                   states, states + table.capacity,
+                   [](size_type state) {
+                     return state != claim_free;
+                   });
+      DASH_ASSERT_RETURNS(dart_memfree(table.states), DART_OK);
+      DASH_ASSERT_RETURNS(dart_memfree(table.keys),   DART_OK);
+      DASH_ASSERT_RETURNS(dart_memfree(table.link),   DART_OK);
+    }
+    _claim_overflow.clear();
+    return nclaims;
+  }
+
+  /**
+   * Stores the local offset of the element inserted at the specified unit
+   * in the slot claimed for its key in \c _claim_key.
+   */
+  void _complete_claim(
+    const key_claim & claim,
+    size_type         lidx,
+    bool              staged)
+  {
+    if (claim.state != claim_busy) {
+      return;
+    }
+    dash::Atomic<size_type>(claim.state_gptr, *_team)
+      .compare_exchange(claim_busy, _claim_state(lidx, staged));
+  }
+
+  /**
+   * Iterator to the element inserted at the specified unit by another unit
+   * since the last barrier and \c false.
+   * Elements written in the next barrier are accessed in the slot of their
+   * key until then.
+   */
+  std::pair<iterator, bool> _claimed_element(
+    team_unit_t       unit,
+    const key_claim & claim)
+  {
+    size_type lidx = _claim_lidx(claim.state);
+    if (_claim_staged(claim.state)) {
+      DASH_LOG_DEBUG("UnorderedMap._claimed_element",
+                     "element is written in next barrier");
+      _claims_staged.insert(
+        std::make_pair(_slot_key(unit, lidx), claim.key_gptr));
+    }
+    _extend_known_size(unit, lidx + 1);
+    _update_end();
+    auto result = std::make_pair(iterator(this, unit, lidx), false);
+    DASH_LOG_DEBUG("UnorderedMap._claimed_element >", result.first);
+    return result;
+  }
+
+  /**
+   * State of the slot of a claimed key, encoding the local offset of its
+   * element and whether the element is staged.
+   */
+  static size_type _claim_state(
+    size_type lidx,
+    bool      staged)
+  {
+    return ((lidx + 2) << 1) | (staged ? 1 : 0);
+  }
+
+  static size_type _claim_lidx(
+    size_type state)
+  {
+    return (state >> 1) - 2;
+  }
+
+  static bool _claim_staged(
+    size_type state)
+  {
+    return (state & 1) != 0;
+  }
+
+  /**
+   * Allocates the tables of keys inserted at every unit since the last
+   * barrier that are probed first, with at least the specified number of
+   * slots.
+   *
+   * Collective operation.
+   */
+  void _allocate_claims(
+    size_type capacity)
+  {
+    size_type claim_capacity = 16;
+    while (claim_capacity < capacity) {
+      claim_capacity *= 2;
+    }
+    DASH_LOG_TRACE("UnorderedMap._allocate_claims", "capacity:",
+                   claim_capacity);
+    delete _claim_states;
+    delete _claim_keys;
+    delete _claim_links;
+    _claim_capacity = claim_capacity;
+    _claim_states   = new dash::GlobMem<size_type>(_claim_capacity,
+                                                   *_team);
+    _claim_keys     = new dash::GlobMem<claimed_key>(_claim_capacity,
+                                                     *_team);
+    _claim_links    = new dash::GlobMem<claim_link>(1, *_team);
+    std::fill(_claim_states->lbegin(), _claim_states->lend(),
+              static_cast<size_type>(claim_free));
+    _claim_links->lbegin()->state = claim_free;
+  }
+
+  /**
+   * Clears the local tables of keys inserted since the last barrier.
+   * The tables probed first are reallocated at all units if more than
+   * half as many keys as they have slots have been claimed at any unit.
+   *
+   * Collective operation.
+   */
+  void _reset_claims()
+  {
+    if (_claim_states == nullptr) {
+      return;
+    }
+    // Claims in linked tables are counted, such that the tables probed
+    // first are enlarged:
+    size_type l_claims = std::count_if(
+                           _claim_states->lbegin(),
+                           _claim_states->lend(),
+                           [](size_type state) {
+                             return state != claim_free;
+                           });
+    l_claims += _free_claim_overflow();
+    std::vector<size_type> g_claims(_team->size());
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        &l_claims,
+        g_claims.data(),
+        sizeof(size_type),
+        DART_TYPE_BYTE,
+        _team->dart_id()),
+      DART_OK);
+    size_type max_claims = *std::max_element(g_claims.begin(),
+                                             g_claims.end());
+    _claims_staged.clear();
+    if (2 * max_claims > _claim_capacity) {
+      _allocate_claims(4 * max_claims);
+    } else {
+      std::fill(_claim_states->lbegin(), _claim_states->lend(),
+                static_cast<size_type>(claim_free));
+      _claim_links->lbegin()->state = claim_free;
+    }
+  }
+
+  /**
+   * Key of the slot at the specified unit and local offset in
+   * \c _claims_staged and \c _erased.
+   */
+  size_type _slot_key(
+    team_unit_t unit,
+    size_type   lidx) const
+  {
+    return lidx * _team->size() + unit.id;
+  }
+
+  /**
+   * Global pointer to the element at the specified unit and local offset
+   * in the slot of its key in the tables of claimed keys if the element is
+   * written in the next barrier, otherwise \c DART_GPTR_NULL.
+   */
+  dart_gptr_t _staged_gptr(
+    team_unit_t unit,
+    index_type  lidx) const
+  {
+    if (_claims_staged.empty()) {
+      return DART_GPTR_NULL;
+    }
+    auto staged = _claims_staged.find(_slot_key(unit, lidx));
+    if (staged == _claims_staged.end()) {
+      return DART_GPTR_NULL;
+    }
+    dart_gptr_t gptr_value = staged->second;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr_value, offsetof(claimed_key, value)),
+      DART_OK);
+    return gptr_value;
+  }
+
+  /**
+   * Attaches local memory for all slots reserved at the active unit,
+   * including slots reserved by remote units since the last barrier.
+   * For hash functions distributing keys, memory for an additional
+   * buffer of elements is attached such that subsequent remote insertions
+   * are written to their target unit directly.
+   */
+  void _reserve_local_capacity()
+  {
+    size_type local_size     = _local_sizes.local[0];
+    size_type local_capacity = _globmem->local_size();
+    if (!dash::internal::is_local_hash<hasher>::value) {
+      local_size += _local_buffer_size;
+    }
+    if (local_size > local_capacity) {
+      DASH_LOG_TRACE("UnorderedMap._reserve_local_capacity",
+                     "globmem.grow(", local_size - local_capacity, ")");
+      _globmem->grow(local_size - local_capacity);
+    }
+  }
+
+  /**
+   * Writes staged remote insertions to their target units and clears the
+   * remote insertions of the active unit.
+   * Staged elements are read from the slots of their keys, where units
+   * may have modified them since they have been inserted.
+   */
+  void _flush_remote_inserts()
+  {
+    dart_gptr_t    gptr_last = DART_GPTR_NULL;
+    size_type      nstaged   = 0;
+    dart_storage_t ds        = dash::dart_storage<value_type>(1);
+    for (size_type i = 0; i < _remote_inserts.size(); ++i) {
+      const remote_insert & pending = _remote_inserts[i];
+      if (!pending.staged) {
+        continue;
+      }
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(
+          &_remote_values[i],
+          _staged_gptr(pending.unit, pending.lidx),
+          ds.nelem,
+          ds.dtype),
+        DART_OK);
+      gptr_last = _globmem->at(pending.unit, pending.lidx).dart_gptr();
+      DASH_ASSERT_RETURNS(
+        dart_put(
+          gptr_last,
+          &_remote_values[i],
+          ds.nelem,
+          ds.dtype),
+        DART_OK);
+      ++nstaged;
+    }
+    if (nstaged > 0) {
+      DASH_ASSERT_RETURNS(
+        dart_flush_all(gptr_last),
+        DART_OK);
+    }
+    DASH_LOG_TRACE("UnorderedMap._flush_remote_inserts",
+                   "inserts:", _remote_inserts.size(),
+                   "staged:",  nstaged);
+    _remote_inserts.clear();
+    _remote_values.clear();
+    _remote_index.clear();
+  }
+
+  /**
+   * Writes the local elements inserted by the active unit since the last
+   * barrier that have been staged in the slots of their keys, see
+   * \c _insert_local, to the local memory.
+   */
+  void _unstage_local_inserts()
+  {
+    dart_storage_t ds = dash::dart_storage<value_type>(1);
+    for (size_type lidx : _index_own) {
+      dart_gptr_t gptr_staged = _staged_gptr(_myid, lidx);
+      if (DART_GPTR_ISNULL(gptr_staged)) {
+        continue;
+      }
+      value_type & value = *local_iterator(this, lidx);
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(&value, gptr_staged, ds.nelem, ds.dtype),
+        DART_OK);
+    }
+  }
+
+  /**
+   * Adds the local elements inserted by remote units since the last
+   * barrier to the index of local elements.
+   * Keys claimed in \c _claim_key are unique, elements of remote units
+   * with keys equivalent to indexed elements only remain if the keys have
+   * also been inserted in \c insert_bulk, and are erased.
+   */
+  void _index_remote_inserts()
+  {
+    size_type local_size = _local_sizes.local[0];
+    auto      own        = _index_own.begin();
+    for (size_type lidx = _index_next; lidx < local_size; ++lidx) {
+      if (own != _index_own.end() && *own == lidx) {
+        ++own;
+        continue;
+      }
+      if (_is_erased(_myid, lidx)) {
+        continue;
+      }
+      const value_type & value = *local_iterator(this, lidx);
+      size_type          hash  = _index_hash(value.first);
+      if (_index_find_local(value.first, hash) < 0) {
+        _index_insert(hash, lidx);
+      } else {
+        _erase_local(lidx);
+      }
+    }
+    _index_next = local_size;
+    _index_own.clear();
+  }
+
+  /**
+   * Whether the element at the specified unit and local offset has been
+   * erased.
+   */
+  inline bool _is_erased(
+    team_unit_t unit,
+    index_type  lidx) const
+  {
+    return !_erased.empty() &&
+           _erased.find(_slot_key(unit, lidx)) != _erased.end();
+  }
+
+  /**
+   * Erases the element at the specified unit and local offset.
+   * Elements at remote units are erased in the next barrier.
+   */
+  void _erase_at(
+    team_unit_t unit,
+    index_type  lidx)
+  {
+    DASH_LOG_TRACE("UnorderedMap._erase_at()", "unit:", unit,
+                   "lidx:", lidx);
+    if (unit == _myid) {
+      _erase_local(lidx);
+    } else if (_erased.insert(_slot_key(unit, lidx)).second) {
+      _erase_requests[unit].push_back(lidx);
+    }
+    _update_end();
+  }
+
+  /**
+   * Marks the local element at the specified local offset as erased and
+   * removes it from the index of local elements.
+   */
+  void _erase_local(
+    index_type lidx)
+  {
+    if (!_erased.insert(_slot_key(_myid, lidx)).second) {
+      return;
+    }
+    _erased_lidx.push_back(lidx);
+    // Elements inserted by remote units since the last barrier are not
+    // indexed yet and may not have been written:
+    if (static_cast<size_type>(lidx) < _index_next ||
+        std::binary_search(_index_own.begin(), _index_own.end(),
+                           static_cast<size_type>(lidx))) {
+      const value_type & value = *local_iterator(this, lidx);
+      _index_erase(_index_hash(value.first), lidx);
+    }
+  }
+
+  /**
+   * Erases local elements erased by remote units since the last barrier
+   * and clears the erasures of the active unit at remote units.
+   *
+   * Collective operation.
+   */
+  void _apply_erase_requests()
+  {
+    size_type nunits     = _team->size();
+    size_type l_requests = 0;
+    for (const auto & u_requests : _erase_requests) {
+      l_requests += u_requests.size();
+    }
+    std::vector<size_type> g_requests(nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        &l_requests,
+        g_requests.data(),
+        sizeof(size_type),
+        DART_TYPE_BYTE,
+        _team->dart_id()),
+      DART_OK);
+    if (std::all_of(g_requests.begin(), g_requests.end(),
+                    [](size_type n) { return n == 0; })) {
+      return;
+    }
+    std::vector<size_type> recv_counts;
+    auto recv_lidx = _exchange_bulk(_erase_requests, recv_counts);
+    for (auto lidx : recv_lidx) {
+      _erase_local(lidx);
+    }
+    DASH_LOG_TRACE("UnorderedMap._apply_erase_requests",
+                   "sent:", l_requests, "received:", recv_lidx.size());
+    for (auto & u_requests : _erase_requests) {
+      u_requests.clear();
+    }
+  }
+
+  /**
+   * Publishes the local elements erased since the last barrier to all
+   * units, such that iterators of all units skip them.
+   *
+   * Collective operation.
+   */
+  void _publish_erased()
+  {
+    size_type nunits = _team->size();
+    size_type l_new  = _erased_lidx.size() - _erased_published;
+    std::vector<size_type> g_new(nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        &l_new,
+        g_new.data(),
+        sizeof(size_type),
+        DART_TYPE_BYTE,
+        _team->dart_id()),
+      DART_OK);
+    std::vector<std::size_t> u_bytes(nunits);
+    std::vector<std::size_t> u_displs(nunits);
+    std::size_t              g_bytes = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      u_bytes[u]  = g_new[u] * sizeof(size_type);
+      u_displs[u] = g_bytes;
+      g_bytes    += u_bytes[u];
+    }
+    if (g_bytes == 0) {
+      return;
+    }
+    std::vector<size_type> g_lidx(g_bytes / sizeof(size_type));
+    DASH_ASSERT_RETURNS(
+      dart_allgatherv(
+        _erased_lidx.data() + _erased_published,
+        l_new * sizeof(size_type),
+        DART_TYPE_BYTE,
+        g_lidx.data(),
+        u_bytes.data(),
+        u_displs.data(),
+        _team->dart_id()),
+      DART_OK);
+    auto lidx = g_lidx.begin();
+    for (size_type u = 0; u < nunits; ++u) {
+      for (size_type e = 0; e < g_new[u]; ++e, ++lidx) {
+        _erased.insert(_slot_key(team_unit_t(u), *lidx));
+      }
+      _erased_sizes[u] += g_new[u];
+    }
+    _erased_published = _erased_lidx.size();
+    DASH_LOG_TRACE("UnorderedMap._publish_erased",
+                   "erased elements:", _erased.size());
+  }
+
+  /**
+   * Extends the number of local elements of a unit known at the active
+   * unit to the specified size, updating the cumulative sizes of the unit
+   * and its successors.
+   */
+  void _extend_known_size(
+    team_unit_t unit,
+    size_type   local_size)
+  {
+    size_type prev_cumul = (unit > 0) ? _local_cumul_sizes[unit - 1] : 0;
+    size_type known_size = _local_cumul_sizes[unit] - prev_cumul;
+    if (local_size <= known_size) {
+      return;
+    }
+    size_type delta = local_size - known_size;
+    for (size_type u = unit.id; u < _local_cumul_sizes.size(); ++u) {
+      _local_cumul_sizes[u] += delta;
+    }
+    if (unit != _myid) {
+      _remote_size += delta;
+    }
+    DASH_LOG_TRACE("UnorderedMap._extend_known_size", "unit:", unit,
+                   "local size:", local_size);
+  }
+
+  /**
+   * Updates the global iterators and the local begin iterator after the
+   * global memory space has been changed by an insertion or erasure.
+   */
+  void _update_end()
+  {
+    auto new_size = size();
+    DASH_LOG_TRACE("UnorderedMap._update_end", "new size:", new_size);
+    _begin  = iterator(this, 0);
+    _end    = iterator(this, _remote_size + _local_sizes.local[0]);
+    // Incrementing by 0 skips erased elements, like in the constructor of
+    // the global iterator:
+    _lbegin = local_iterator(this, 0);
+    _lbegin += 0;
+    DASH_LOG_TRACE_VAR("UnorderedMap._update_end", _begin);
+    DASH_LOG_TRACE_VAR("UnorderedMap._update_end", _end);
+  }
+
+  /**
+   * Counter of asynchronous requests at the specified unit, see
+   * \c _async_counters.
+   */
+  dash::Atomic<size_type> _async_counter(
+    team_unit_t unit,
+    size_type   counter)
+  {
+    return dash::Atomic<size_type>(
+             _async_counters->at(unit, counter).dart_gptr(), *_team);
+  }
+
+  /**
+   * Handle of asynchronous requests that read mapped values.
+   */
+  static constexpr size_type _async_lookup()
+  {
+    return std::numeric_limits<size_type>::max();
+  }
+
+  /**
+   * Unit applying asynchronous requests for the specified key.
+   * With \c dash::HashLocal, this is the unit of the existing element
+   * with the key, or the active unit if no such element exists.
+   */
+  team_unit_t _async_owner(const key_type & key)
+  {
+    if (!dash::internal::is_local_hash<hasher>::value) {
+      return _key_hash(key);
+    }
+    iterator found = _find(key);
+    if (found != _end) {
+      return found.lpos().unit;
+    }
+    return _myid;
+  }
+
+  /**
+   * Applies the request to the local element with the requested key and
+   * returns the reply to the requesting unit.
+   */
+  async_reply _async_apply(const async_request & request)
+  {
+    async_reply reply;
+    reply.value = mapped_type();
+    reply.found = 0;
+    reply.seq   = 0;
+    index_type lidx = _index_find_local(request.key,
+                                        _index_hash(request.key));
+    if (request.handle == _async_lookup()) {
+      if (lidx >= 0) {
+        reply.value = (*local_iterator(this, lidx)).second;
+        reply.found = 1;
+      }
+      return reply;
+    }
+    value_type staged(request.key, mapped_type());
+    if (lidx < 0) {
+      lidx = _insert_at(_myid, staged).first.lpos().index;
+    }
+    // Elements of remote units written in the next barrier are updated
+    // in the slot of their key:
+    dart_gptr_t    gptr_staged = _staged_gptr(_myid, lidx);
+    dart_storage_t ds          = dash::dart_storage<value_type>(1);
+    value_type   * value       = &staged;
+    if (DART_GPTR_ISNULL(gptr_staged)) {
+      value = &(*local_iterator(this, lidx));
+    } else {
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(value, gptr_staged, ds.nelem, ds.dtype),
+        DART_OK);
+    }
+    _async_handlers[request.handle](value->second, request.arg);
+    if (!DART_GPTR_ISNULL(gptr_staged)) {
+      DASH_ASSERT_RETURNS(
+        dart_put_blocking(gptr_staged, value, ds.nelem, ds.dtype),
+        DART_OK);
+    }
+    reply.value = value->second;
+    reply.found = 1;
+    return reply;
+  }
+
+  /**
+   * Issues an asynchronous request and returns the future of its reply.
+   * Requests for keys owned by the active unit are applied immediately.
+   */
+  dash::Future<mapped_type> _async_request(
+    const key_type    & key,
+    size_type           handle,
+    const mapped_type & arg)
+  {
+    DASH_ASSERT(_async_queue != nullptr);
+    progress();
+    async_request request { key, arg, handle, 0,
+                            static_cast<size_type>(_myid.id), 0 };
+    auto                  result  = std::make_shared<async_reply>();
+    team_unit_t           owner   = _async_owner(key);
+    std::function<bool()> collect = []() { return true; };
+    if (owner == _myid) {
+      *result = _async_apply(request);
+    } else {
+      _async_send(owner, request, result);
+      size_type id = request.id;
+      collect      = [this, id]() { return _async_collect(id); };
+    }
+    DASH_LOG_TRACE("UnorderedMap._async_request", "owner:", owner,
+                   "id:", request.id);
+    return dash::Future<mapped_type>(
+             [this, key, result, collect]() {
+               while (!collect()) {
+                 progress();
+               }
+               if (result->found == 0) {
+                 DASH_THROW(
+                   dash::exception::InvalidArgument,
+                   "No element in map for key " << key);
+               }
+               return result->value;
+             },
+             [this, collect]() {
+               progress();
+               return collect();
+             });
+  }
+
+  /**
+   * Writes the request to the queue of its owning unit. The reply is
+   * copied to \c result once it has been received, see
+   * \c _async_collect.
+   */
+  void _async_send(
+    team_unit_t                  owner,
+    async_request              & request,
+    std::shared_ptr<async_reply> result)
+  {
+    request.id = _async_next_id++;
+    // The reply slot of the request has been used by the request issued
+    // one capacity earlier:
+    if (request.id >= _async_capacity) {
+      while (!_async_collect(request.id - _async_capacity)) {
+        progress();
+      }
+    }
+    size_type ticket = _async_counter(owner, 0).fetch_and_add(1);
+    // Wait until the owner released the slot of the ticket, applying
+    // requests of other units in the meantime:
+    while (ticket >= _async_counter(owner, 1).fetch_and_add(0) +
+                     _async_capacity) {
+      progress();
+    }
+    request.seq = ticket + 1;
+    _async_store(
+      _async_queue->at(owner, ticket % _async_capacity).dart_gptr(),
+      request);
+    _async_pending.insert(std::make_pair(request.id, result));
+    ++_async_sent;
+  }
+
+  /**
+   * Copies the reply of the request with the specified id from the local
+   * reply slots if it has been received.
+   * Returns whether the reply of the request has been received.
+   */
+  bool _async_collect(size_type id)
+  {
+    auto pending = _async_pending.find(id);
+    if (pending == _async_pending.end()) {
+      return true;
+    }
+    dart_gptr_t gptr_reply = _async_replies->at(
+                               _myid, id % _async_capacity
+                             ).dart_gptr();
+    if (_async_load_seq<async_reply>(gptr_reply) != id + 1) {
+      return false;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_get_blocking(
+        pending->second.get(),
+        gptr_reply,
+        sizeof(async_reply),
+        DART_TYPE_BYTE),
+      DART_OK);
+    _async_pending.erase(pending);
+    return true;
+  }
+
+  /**
+   * Writes a request or reply to the specified global address, the
+   * sequence number is written after all other members such that a
+   * matching sequence number indicates a complete message.
+   */
+  template<typename MessageType>
+  void _async_store(
+    dart_gptr_t         gptr,
+    const MessageType & message)
+  {
+    auto seq_offs = offsetof(MessageType, seq);
+    DASH_ASSERT_RETURNS(
+      dart_put_blocking(
+        gptr,
+        &message,
+        seq_offs,
+        DART_TYPE_BYTE),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr, seq_offs),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_put_blocking(
+        gptr,
+        &message.seq,
+        sizeof(size_type),
+        DART_TYPE_BYTE),
+      DART_OK);
+  }
+
+  /**
+   * Sequence number of the request or reply at the specified global
+   * address.
+   */
+  template<typename MessageType>
+  size_type _async_load_seq(
+    dart_gptr_t gptr) const
+  {
+    size_type seq;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr, offsetof(MessageType, seq)),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_get_blocking(
+        &seq,
+        gptr,
+        sizeof(size_type),
+        DART_TYPE_BYTE),
+      DART_OK);
+    return seq;
+  }
+
+  /**
+   * Applies asynchronous requests until the requests issued by all units
+   * have been applied.
+   * Units wait for the arrival of all units in a counter at unit 0 while
+   * applying requests, as units that have not arrived may still wait for
+   * replies. Then, the numbers of issued and applied requests are
+   * compared in collective rounds.
+   *
+   * Collective operation.
+   */
+  void _async_drain()
+  {
+    if (_async_queue == nullptr) {
+      return;
+    }
+    size_type nunits  = _team->size();
+    auto      arrived = _async_counter(team_unit_t(0), 2);
+    arrived.add(1);
+    ++_async_epoch;
+    while (arrived.fetch_and_add(0) < _async_epoch * nunits) {
+      progress();
+    }
+    std::vector<size_type> g_counts(2 * nunits);
+    for (;;) {
+      progress();
+      size_type l_counts[2] = { _async_sent, _async_processed };
+      DASH_ASSERT_RETURNS(
+        dart_allgather(
+          l_counts,
+          g_counts.data(),
+          sizeof(l_counts),
+          DART_TYPE_BYTE,
+          _team->dart_id()),
+        DART_OK);
+      size_type sent      = 0;
+      size_type processed = 0;
+      for (size_type u = 0; u < nunits; ++u) {
+        sent      += g_counts[2 * u];
+        processed += g_counts[2 * u + 1];
+      }
+      if (sent == processed) {
+        break;
+      }
+    }
+    DASH_LOG_TRACE("UnorderedMap._async_drain", "sent:", _async_sent,
+                   "applied:", _async_processed);
   }
 
 private:
@@ -793,15 +2922,92 @@ private:
   local_sizes_map        _local_sizes;
   /// Cumulative (postfix sum) local sizes of all units.
   std::vector<size_type> _local_cumul_sizes;
-  /// Iterators to elements in local memory space that are marked for move
-  /// to remote unit in next commit.
-  std::vector<iterator>  _move_elements;
   /// Global pointer to local element in _local_sizes.
   dart_gptr_t            _local_size_gptr = DART_GPTR_NULL;
   /// Hash type for mapping of key to unit and local offset.
   hasher                 _key_hash;
   /// Predicate for key comparison.
   key_equal              _key_equal;
+  /// Open-addressing index of local elements, capacity is a power of two.
+  std::vector<index_slot> _index;
+  /// Number of local elements in the index.
+  size_type              _index_size      = 0;
+  /// Number of slots of erased elements in the index.
+  size_type              _index_deleted   = 0;
+  /// Capacities of the indices of all units published in global memory.
+  std::vector<size_type> _index_capacities;
+  /// Indices of local elements of all units, published in \c barrier().
+  dash::GlobMem<index_slot> * _glob_index = nullptr;
+  /// Local offsets of elements inserted by the active unit since the last
+  /// barrier, in ascending order.
+  std::vector<size_type> _index_own;
+  /// Number of local elements at the last barrier.
+  size_type              _index_next      = 0;
+  /// Elements inserted at remote units by the active unit since the last
+  /// barrier.
+  std::vector<remote_insert> _remote_inserts;
+  /// Copies of the elements in \c _remote_inserts.
+  std::deque<value_type> _remote_values;
+  /// Mapping hashes of keys in \c _remote_inserts to their offsets.
+  std::unordered_multimap<size_type, size_type> _remote_index;
+  /// States of the slots in the tables of keys inserted at every unit
+  /// since the last barrier that are probed first, see \c _claim_key.
+  dash::GlobMem<size_type>      * _claim_states   = nullptr;
+  /// Keys in the slots of \c _claim_states.
+  dash::GlobMem<claimed_key>    * _claim_keys     = nullptr;
+  /// Links of the tables of \c _claim_states, see \c _next_claim_table.
+  dash::GlobMem<claim_link>     * _claim_links    = nullptr;
+  /// Linked tables of claimed keys allocated by the active unit since the
+  /// last barrier.
+  std::vector<claim_table>        _claim_overflow;
+  /// Mapping slots of elements written in the next barrier to the global
+  /// pointers of their keys in the tables of claimed keys, see
+  /// \c _slot_key.
+  std::unordered_map<size_type, dart_gptr_t> _claims_staged;
+  /// Slots of erased elements of all units known at the active unit, see
+  /// \c _slot_key.
+  std::unordered_set<size_type> _erased;
+  /// Local offsets of erased local elements.
+  std::vector<size_type> _erased_lidx;
+  /// Number of elements in \c _erased_lidx published to remote units.
+  size_type              _erased_published = 0;
+  /// Number of erased elements of every unit published in the last
+  /// barrier.
+  std::vector<size_type> _erased_sizes;
+  /// Local offsets of elements at remote units erased by the active unit
+  /// since the last barrier, grouped by unit.
+  std::vector< std::vector<size_type> > _erase_requests;
+  /// Functions applied in asynchronous updates, by handle.
+  std::vector<update_function>    _async_handlers;
+  /// Queues of asynchronous requests of all units.
+  dash::GlobMem<async_request>  * _async_queue    = nullptr;
+  /// Replies to asynchronous requests of all units, by request id.
+  dash::GlobMem<async_reply>    * _async_replies  = nullptr;
+  /// Counters of every unit: next ticket in the request queue, ticket of
+  /// the next request to apply, and at unit 0 the number of arrivals in
+  /// \c _async_drain.
+  dash::GlobMem<size_type>      * _async_counters = nullptr;
+  /// Ticket of the next request to apply in the local queue.
+  size_type              _async_head      = 0;
+  /// Id of the next request issued by the active unit.
+  size_type              _async_next_id   = 0;
+  /// Number of requests sent to remote units.
+  size_type              _async_sent      = 0;
+  /// Number of requests of remote units applied at the active unit.
+  size_type              _async_processed = 0;
+  /// Number of calls of \c _async_drain.
+  size_type              _async_epoch     = 0;
+  /// Replies of issued requests that have not been received, by request
+  /// id.
+  std::unordered_map<size_type, std::shared_ptr<async_reply>>
+                         _async_pending;
+  /// Number of slots in the request queue and replies of every unit.
+  size_type              _async_capacity  = 1024;
+  /// Number of slots in the table of keys inserted at every unit since the
+  /// last barrier, a power of two.
+  size_type              _claim_capacity  = 1024;
+  /// Number of local elements in the memory attached in the last barrier.
+  size_type              _local_attached  = 0;
   /// Capacity of local buffer containing locally added node elements that
   /// have not been committed to global memory yet.
   /// Default is 4 KB.
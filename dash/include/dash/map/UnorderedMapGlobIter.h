@@ -15,6 +15,7 @@
 #include <dash/internal/Logging.h>
 
 #include <type_traits>
+#include <algorithm>
 #include <list>
 #include <vector>
 #include <iterator>
@@ -238,6 +239,12 @@ public:
    */
   reference operator*()
   {
+    // Elements inserted at remote units are staged in the map's tables of
+    // claimed keys until the next barrier of the map:
+    dart_gptr_t staged = _map->_staged_gptr(_idx_unit_id, _idx_local_idx);
+    if (!DART_GPTR_ISNULL(staged)) {
+      return reference(staged);
+    }
     if (is_local()) {
       // To local map iterator:
       auto l_map_it = local();
@@ -246,9 +253,8 @@ public:
                       "local iterator failed");
       // To native pointer via conversion:
       return reference(static_cast<raw_pointer>(l_map_it));
-    } else {
-      return reference(dart_gptr());
     }
+    return reference(dart_gptr());
   }
 
   /**
@@ -258,6 +264,12 @@ public:
    */
   const_reference operator*() const
   {
+    // Elements inserted at remote units are staged in the map's tables of
+    // claimed keys until the next barrier of the map:
+    dart_gptr_t staged = _map->_staged_gptr(_idx_unit_id, _idx_local_idx);
+    if (!DART_GPTR_ISNULL(staged)) {
+      return reference(staged);
+    }
     if (is_local()) {
       // To local map iterator:
       auto l_map_it = local();
@@ -266,9 +278,8 @@ public:
                       "local iterator failed");
       // To native pointer via conversion:
       return reference(static_cast<raw_pointer>(l_map_it));
-    } else {
-      return reference(dart_gptr());
     }
+    return reference(dart_gptr());
   }
 
 #if 0
@@ -299,7 +310,7 @@ public:
       // Iterator position does not point to local element
       return local_iterator(nullptr);
     }
-    return (_map->lbegin() + _idx_local_idx);
+    return local_iterator(_map, _idx_local_idx);
   }
 
 #if 0
@@ -500,23 +511,44 @@ private:
       //   --> UnorderedMapGlobIter(map, 0) -> (gidx:0, unit:2, lidx:0)
       //
       _idx           += offset;
-      _idx_local_idx = _idx;
+      locate_unit();
+      // Skip erased elements:
       auto & l_cumul_sizes = _map->_local_cumul_sizes;
-      // Find unit at global offset:
-      while (_idx >= l_cumul_sizes[_idx_unit_id] &&
-             _idx_unit_id < l_cumul_sizes.size() - 1) {
-        DASH_LOG_TRACE("UnorderedMapGlobIter.increment",
-                       "local cumulative size of unit", _idx_unit_id, ":",
-                       l_cumul_sizes[_idx_unit_id]);
-        _idx_unit_id++;
-      }
-      if (_idx_unit_id > 0) {
-        _idx_local_idx = _idx - l_cumul_sizes[_idx_unit_id-1];
+      while (_idx < static_cast<index_type>(l_cumul_sizes.back()) &&
+             _map->_is_erased(_idx_unit_id, _idx_local_idx)) {
+        ++_idx;
+        locate_unit();
       }
     }
     DASH_LOG_TRACE("UnorderedMapGlobIter.increment >", *this);
   }
 
+  /**
+   * Resolves the unit and local offset at the iterator's global position
+   * in a binary search on the cumulative local sizes of units.
+   */
+  void locate_unit()
+  {
+    auto & l_cumul_sizes = _map->_local_cumul_sizes;
+    // First unit with cumulative local size greater than the global offset,
+    // positions past the final element are resolved at the last unit:
+    auto unit_it = std::upper_bound(l_cumul_sizes.begin(),
+                                    l_cumul_sizes.end(),
+                                    static_cast<size_type>(_idx));
+    if (unit_it == l_cumul_sizes.end()) {
+      --unit_it;
+    }
+    _idx_unit_id   = team_unit_t(std::distance(l_cumul_sizes.begin(),
+                                               unit_it));
+    _idx_local_idx = _idx - (_idx_unit_id > 0
+                             ? l_cumul_sizes[_idx_unit_id - 1]
+                             : 0);
+    DASH_LOG_TRACE("UnorderedMapGlobIter.locate_unit",
+                   "gidx:", _idx,
+                   "unit:", _idx_unit_id,
+                   "lidx:", _idx_local_idx);
+  }
+
   /**
    * Decrement pointer by specified position offset.
    */
@@ -530,9 +562,8 @@ private:
     if (offset < 0) {
       increment(-offset);
     } else if (offset > 0) {
-      // TODO
-      _idx           -= offset;
-      _idx_local_idx  = _idx;
+      _idx -= offset;
+      locate_unit();
     }
     DASH_LOG_TRACE("UnorderedMapGlobIter.decrement >", *this);
   }
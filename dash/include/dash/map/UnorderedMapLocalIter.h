@@ -361,6 +361,11 @@ private:
                    "lidx:",   _idx,
                    "offset:", offset);
     _idx += offset;
+    // Skip erased elements:
+    while (_idx < static_cast<index_type>(_map->_local_sizes.local[0]) &&
+           _map->_is_erased(_map->_myid, _idx)) {
+      ++_idx;
+    }
     DASH_LOG_TRACE("UnorderedMapLocalIter.increment >");
   }
 
@@ -282,18 +282,9 @@ public:
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    iterator found = std::find_if(
-                       first, last,
-                       [&](const value_type & v) {
-                         DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                        v.first, "==?", key);
-                         return pred(v.first, key);
-                       });
+    // Probe index of local elements:
+    auto     lidx  = _map->_index_find_local(key, _map->_index_hash(key));
+    iterator found = (lidx < 0) ? end() : iterator(_map, lidx);
     DASH_LOG_TRACE("UnorderedMapLocalRef.find >", found);
     return found;
   }
@@ -301,18 +292,10 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find() const", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    const_iterator found = std::find_if(
-                             first, last,
-                             [&](const value_type & v) {
-                               DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                              v.first, "==?", key);
-                               return pred(v.first, key);
-                             });
+    // Probe index of local elements:
+    auto           lidx  = _map->_index_find_local(
+                             key, _map->_index_hash(key));
+    const_iterator found = (lidx < 0) ? end() : const_iterator(_map, lidx);
     DASH_LOG_TRACE("UnorderedMapLocalRef.find const >", found);
     return found;
   }
@@ -361,7 +344,7 @@ public:
       result.first  = inserted.first.local();
       result.second = inserted.second;
       // Updated local end iterator of the referenced map:
-      _map->_lend   = _map->_lbegin + _map->lsize();
+      _map->_lend   = iterator(_map, _map->_local_sizes.local[0]);
       DASH_LOG_TRACE("UnorderedMapLocalRef.insert", "updated map.lend:",
                      _map->_lend);
     }
@@ -391,8 +374,11 @@ public:
     const_iterator it)
   {
     DASH_LOG_DEBUG("UnorderedMapLocalRef.erase()", "iterator:", it);
-    erase(*it.first);
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >");
+    _map->_erase_at(_map->_myid, it.pos());
+    iterator next = it;
+    ++next;
+    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >", next);
+    return next;
   }
 
   size_type erase(
@@ -400,16 +386,14 @@ public:
     const key_type & key)
   {
     DASH_LOG_DEBUG("UnorderedMapLocalRef.erase()", "key:", key);
-    auto b_idx  = bucket(key);
-    auto b_size = bucket_size(b_idx);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase", b_idx);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase", b_size);
-
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMapLocalRef.erase is not implemented.");
-
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >");
+    iterator found = find(key);
+    if (found == end()) {
+      DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >", "key not found");
+      return 0;
+    }
+    erase(found);
+    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >", "erased");
+    return 1;
   }
 
   iterator erase(
@@ -421,10 +405,11 @@ public:
     DASH_LOG_DEBUG("UnorderedMapLocalRef.erase(first,last)");
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase()", first);
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase()", last);
-    for (auto it = first; it != last; ++it) {
-      erase(*it.first);
+    while (first < last) {
+      first = erase(first);
     }
     DASH_LOG_DEBUG("UnorderedMapLocalRef.erase(first,last) >");
+    return first;
   }
 
   //////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,8 @@ namespace dash {
 #include <dash/GlobPtr.h>
 #include <dash/GlobRef.h>
 #include <dash/GlobAsyncRef.h>
+#include <dash/GlobReadCache.h>
+#include <dash/UpdateBuffer.h>
 
 #include <dash/iterator/GlobIter.h>
 #include <dash/iterator/GlobViewIter.h>
@@ -36,6 +38,7 @@ namespace dash {
 #include <dash/Shared.h>
 #include <dash/SharedCounter.h>
 #include <dash/Exception.h>
+#include <dash/Execution.h>
 #include <dash/Algorithm.h>
 #include <dash/Allocator.h>
 #include <dash/Atomic.h>
@@ -51,3 +51,156 @@ TEST_F(AccumulateTest, StringConcatOperaton) {
     ASSERT_STREQ("1-2-3-4", result.c_str());
   }
 }
+
+TEST_F(AccumulateTest, ResultAtAllUnits) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<long> target(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < target.lsize(); ++li) {
+    target.local[li] = target.pattern().global(li);
+  }
+  target.barrier();
+
+  long expected = static_cast<long>(num_elem_total * (num_elem_total - 1))
+                  / 2;
+  // Initial value is applied once:
+  long result = dash::accumulate(target.begin(), target.end(), 10L);
+  EXPECT_EQ_U(expected + 10, result);
+
+  long result_std = dash::accumulate(target.begin(), target.end(), 0L,
+                                     std::plus<long>());
+  EXPECT_EQ_U(expected, result_std);
+
+  // Range not covering all units:
+  long result_part = dash::accumulate(target.begin(),
+                                      target.begin() + num_elem_local / 2,
+                                      0L);
+  long expected_part = static_cast<long>((num_elem_local / 2) *
+                                         (num_elem_local / 2 - 1)) / 2;
+  EXPECT_EQ_U(expected_part, result_part);
+}
+
+TEST_F(AccumulateTest, CustomOperation) {
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+  dash::fill(target.begin(), target.end(), 1);
+  target.barrier();
+
+  // Operation without DART equivalent, local results are gathered and
+  // reduced in order of units:
+  auto sum = [](int a, int b) { return a + b; };
+  int result = dash::accumulate(target.begin(), target.end(), 5, sum);
+  EXPECT_EQ_U(static_cast<int>(num_elem_total) + 5, result);
+}
+
+TEST_F(AccumulateTest, TransformReduce) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < target.lsize(); ++li) {
+    target.local[li] = static_cast<int>(target.pattern().global(li));
+  }
+  target.barrier();
+
+  // Sum of squares:
+  long expected = 0;
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected += static_cast<long>(g * g);
+  }
+  long result = dash::transform_reduce(
+                  target.begin(), target.end(), 3L,
+                  dash::plus<long>(),
+                  [](int v) { return static_cast<long>(v) * v; });
+  EXPECT_EQ_U(expected + 3, result);
+
+  // Maximum distance from the range center with custom reduce operation:
+  long center = static_cast<long>(num_elem_total / 2);
+  long max_distance = dash::transform_reduce(
+                        target.begin(), target.end(), 0L,
+                        [](long a, long b) { return std::max(a, b); },
+                        [=](int v) { return std::abs(v - center); });
+  EXPECT_EQ_U(center, max_distance);
+}
+
+TEST_F(AccumulateTest, ExecutionPolicies) {
+  const size_t num_elem_local = 1000;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < target.lsize(); ++li) {
+    target.local[li] = static_cast<int>(target.pattern().global(li));
+  }
+  target.barrier();
+
+  long expected = static_cast<long>(num_elem_total) *
+                  (num_elem_total - 1) / 2;
+  EXPECT_EQ_U(expected,
+              dash::accumulate(dash::execution::seq,
+                               target.begin(), target.end(), 0L));
+  EXPECT_EQ_U(expected + 5,
+              dash::accumulate(dash::execution::par,
+                               target.begin(), target.end(), 5L,
+                               dash::plus<long>()));
+  EXPECT_EQ_U(static_cast<int>(num_elem_total - 1),
+              dash::accumulate(dash::execution::par_unseq,
+                               target.begin(), target.end(), 0,
+                               [](int a, int b) { return std::max(a, b); }));
+  EXPECT_EQ_U(2 * expected,
+              dash::transform_reduce(dash::execution::par,
+                                     target.begin(), target.end(), 0L,
+                                     dash::plus<long>(),
+                                     [](int v) { return 2L * v; }));
+}
+
+TEST_F(AccumulateTest, TransformReduceBinary) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local + 3;
+
+  dash::Array<int>  a(num_elem_total, dash::BLOCKED);
+  dash::Array<int>  b_aligned(num_elem_total, dash::BLOCKED);
+  dash::Array<long> b_cyclic(num_elem_total, dash::BLOCKCYCLIC(7));
+  for (size_t li = 0; li < a.lsize(); ++li) {
+    a.local[li]         = static_cast<int>(a.pattern().global(li));
+    b_aligned.local[li] = 2;
+  }
+  for (size_t li = 0; li < b_cyclic.lsize(); ++li) {
+    b_cyclic.local[li] = static_cast<long>(b_cyclic.pattern().global(li));
+  }
+  a.barrier();
+  b_cyclic.barrier();
+
+  long n = static_cast<long>(num_elem_total);
+  auto product = [](int x, long y) { return x * y; };
+
+  // Aligned ranges, values of second range read in place:
+  EXPECT_EQ_U(n * (n - 1) + 1,
+              dash::transform_reduce(a.begin(), a.end(), b_aligned.begin(),
+                                     1L, dash::plus<long>(), product));
+
+  // Different distribution, values of second range fetched:
+  long expected = 0;
+  for (long g = 0; g < n; ++g) {
+    expected += g * g;
+  }
+  EXPECT_EQ_U(expected,
+              dash::transform_reduce(dash::execution::par,
+                                     a.begin(), a.end(), b_cyclic.begin(),
+                                     0L, dash::plus<long>(), product));
+
+  // Shifted subranges:
+  long expected_shifted = 0;
+  for (long g = 5; g < n - 1; ++g) {
+    expected_shifted += g * (g + 1);
+  }
+  EXPECT_EQ_U(expected_shifted,
+              dash::transform_reduce(dash::execution::seq,
+                                     a.begin() + 5, a.end() - 1,
+                                     b_cyclic.begin() + 6,
+                                     0L,
+                                     [](long x, long y) { return x + y; },
+                                     product));
+}
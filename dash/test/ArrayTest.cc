@@ -222,3 +222,85 @@ TEST_F(ArrayTest, TeamSplit)
   team_all.barrier();
 }
 
+
+TEST_F(ArrayTest, GatherIndexed)
+{
+  const size_t nelem_local = 37;
+  dash::Array<int> array(nelem_local * _dash_size, dash::BLOCKCYCLIC(5));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l) * 10;
+  }
+  array.barrier();
+
+  // Pseudo-random indices including duplicates and local elements:
+  std::vector<long> indices;
+  for (size_t i = 0; i < 3 * array.size(); ++i) {
+    indices.push_back(((i + 1) * 7919 * (_dash_id + 3)) % array.size());
+  }
+  std::vector<int> values(indices.size(), -1);
+  auto fut = array.gather(indices, values.data());
+  EXPECT_EQ_U(values.data() + values.size(), fut.get());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    EXPECT_EQ_U(indices[i] * 10, values[i]);
+  }
+  array.barrier();
+}
+
+TEST_F(ArrayTest, ScatterIndexed)
+{
+  const size_t nelem_local = 23;
+  dash::Array<int> array(nelem_local * _dash_size, dash::CYCLIC);
+  dash::fill(array.begin(), array.end(), -1);
+  array.barrier();
+
+  // Every unit writes the elements of its right neighbor in reverse order,
+  // duplicate indices with lower value precede the final value:
+  auto right = (_dash_id + 1) % _dash_size;
+  std::vector<size_t> indices;
+  std::vector<int>    values;
+  for (size_t l = nelem_local; l > 0; --l) {
+    typedef dash::Array<int>::index_type index_t;
+    size_t g_index = array.pattern().global(
+                       dash::team_unit_t(right),
+                       std::array<index_t, 1> {{ index_t(l - 1) }})[0];
+    indices.push_back(g_index);
+    values.push_back(0);
+    indices.push_back(g_index);
+    values.push_back(g_index + 1000);
+  }
+  array.scatter(indices, values.data()).wait();
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(array.pattern().global(l) + 1000, array.local[l]);
+  }
+  array.barrier();
+}
+
+TEST_F(ArrayTest, ScatterIndexedAccumulate)
+{
+  const size_t nelem_local = 16;
+  dash::Array<int> array(nelem_local * _dash_size, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  // Every unit increments every element by 1 and element i by additional
+  // i, as duplicate indices:
+  std::vector<int> indices;
+  std::vector<int> values;
+  for (int i = array.size() - 1; i >= 0; --i) {
+    indices.push_back(i);
+    values.push_back(1);
+    indices.push_back(i);
+    values.push_back(i);
+  }
+  array.scatter(indices, values.data(), dash::plus<int>()).wait();
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    int g_index = array.pattern().global(l);
+    EXPECT_EQ_U(static_cast<int>((g_index + 1) * _dash_size),
+                static_cast<int>(array.local[l]));
+  }
+  array.barrier();
+}
@@ -104,3 +104,52 @@ TEST_F(AtomicTest, ArrayElements)
     delete[] l_copy;
   }
 }
+
+TEST_F(AtomicTest, CompareExchange)
+{
+  typedef long value_t;
+
+  dash::team_unit_t     owner(dash::size() - 1);
+  dash::Shared<value_t> shared(owner);
+
+  if (dash::myid() == 0) {
+    shared.set(-1);
+  }
+  dash::barrier();
+
+  dash::Atomic<value_t> atomic(shared);
+
+  // Only one unit succeeds to replace the initial value:
+  value_t prev    = atomic.compare_exchange(-1, dash::myid());
+  value_t success = (prev == -1) ? 1 : 0;
+  dash::Array<value_t> successes(dash::size());
+  successes.local[0] = success;
+  successes.barrier();
+
+  value_t winner = atomic.get();
+  EXPECT_GE_U(winner, 0);
+  EXPECT_LT_U(winner, static_cast<value_t>(dash::size()));
+  if (dash::myid() == 0) {
+    value_t nsuccess = 0;
+    for (size_t u = 0; u < dash::size(); ++u) {
+      nsuccess += successes[u];
+    }
+    EXPECT_EQ_U(1, nsuccess);
+    EXPECT_EQ_U(1, static_cast<value_t>(successes[winner]));
+  }
+  dash::barrier();
+
+  // Serialize increments in compare-and-swap loops:
+  for (int i = 0; i < 10; ++i) {
+    value_t expected = atomic.get();
+    value_t actual;
+    while ((actual = atomic.compare_exchange(expected, expected + 1))
+           != expected) {
+      expected = actual;
+    }
+  }
+  dash::barrier();
+  EXPECT_EQ_U(winner + 10 * static_cast<value_t>(dash::size()),
+              static_cast<value_t>(atomic.get()));
+  dash::barrier();
+}
@@ -0,0 +1,123 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include "TestBase.h"
+#include "DequeTest.h"
+
+#include <vector>
+#include <algorithm>
+
+
+TEST_F(DequeTest, PushPopLocal)
+{
+  typedef long value_t;
+
+  dash::Deque<value_t> deque(64, 8);
+  const value_t nelem = 1000;
+
+  EXPECT_TRUE_U(deque.empty());
+  for (value_t i = 0; i < nelem; ++i) {
+    deque.push_back(i);
+  }
+  EXPECT_EQ_U(static_cast<size_t>(nelem), deque.local_size());
+
+  // Elements are popped in LIFO order, including elements moved to the
+  // shared part of the segment:
+  value_t value;
+  for (value_t i = nelem - 1; i >= 0; --i) {
+    ASSERT_TRUE_U(deque.pop_back(value));
+    EXPECT_EQ_U(i, value);
+  }
+  EXPECT_FALSE_U(deque.pop_back(value));
+  EXPECT_TRUE_U(deque.empty());
+  deque.barrier();
+}
+
+TEST_F(DequeTest, StealFromProducer)
+{
+  typedef long value_t;
+
+  dash::Deque<value_t> deque(256, 16);
+  dash::Array<long>    counts(2 * _dash_size, dash::BLOCKED);
+  const value_t        nelem = 5000;
+
+  for (int round = 0; round < 2; ++round) {
+    if (_dash_id == 0) {
+      for (value_t i = 0; i < nelem; ++i) {
+        deque.push_back(i);
+      }
+    }
+    dash::barrier();
+
+    long    nprocessed = 0;
+    long    sum        = 0;
+    value_t value;
+    while (deque.next(value)) {
+      ++nprocessed;
+      sum += value;
+    }
+    deque.barrier();
+    EXPECT_TRUE_U(deque.empty());
+
+    counts.local[0] = nprocessed;
+    counts.local[1] = sum;
+    counts.barrier();
+    if (_dash_id == 0) {
+      long total = 0;
+      long total_sum = 0;
+      for (size_t u = 0; u < _dash_size; ++u) {
+        total     += counts[2 * u];
+        total_sum += counts[2 * u + 1];
+      }
+      EXPECT_EQ_U(nelem, total);
+      EXPECT_EQ_U(nelem * (nelem - 1) / 2, total_sum);
+    }
+    counts.barrier();
+  }
+}
+
+TEST_F(DequeTest, TreeTraversal)
+{
+  typedef struct node_t {
+    int  depth;
+    long id;
+  } node;
+
+  const int max_depth = 12;
+  const int nchildren = 2;
+
+  dash::Deque<node>    deque(128, 8);
+  dash::Array<long>    counts(_dash_size, dash::BLOCKED);
+
+  if (_dash_id == 0) {
+    deque.push_back(node { 0, 0 });
+  }
+  dash::barrier();
+
+  long nvisited = 0;
+  node task;
+  while (deque.next(task)) {
+    ++nvisited;
+    if (task.depth < max_depth) {
+      for (int c = 0; c < nchildren; ++c) {
+        deque.push_back(node { task.depth + 1,
+                               task.id * nchildren + c + 1 });
+      }
+    }
+  }
+  deque.barrier();
+  DASH_LOG_DEBUG("DequeTest.TreeTraversal",
+                 "visited:", nvisited, "steals:", deque.num_steals());
+
+  counts.local[0] = nvisited;
+  counts.barrier();
+  if (_dash_id == 0) {
+    long total  = 0;
+    for (size_t u = 0; u < _dash_size; ++u) {
+      total += counts[u];
+    }
+    long expect = (1L << (max_depth + 1)) - 1;
+    EXPECT_EQ_U(expect, total);
+  }
+  counts.barrier();
+}
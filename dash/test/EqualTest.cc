@@ -0,0 +1,49 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "EqualTest.h"
+
+TEST_F(EqualTest, EqualDistribution) {
+  const size_t num_elem_local = 50;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_b(num_elem_total, dash::BLOCKED);
+  dash::fill(array_a.begin(), array_a.end(), 3);
+  dash::fill(array_b.begin(), array_b.end(), 3);
+  array_a.barrier();
+
+  EXPECT_TRUE_U(dash::equal(array_a.begin(), array_a.end(),
+                            array_b.begin()));
+
+  // Modify an element at the last unit, result must be consistent at
+  // all units:
+  if (_dash_id == _dash_size - 1) {
+    array_b.local[num_elem_local - 1] = 4;
+  }
+  array_b.barrier();
+  EXPECT_FALSE_U(dash::equal(array_a.begin(), array_a.end(),
+                             array_b.begin()));
+  EXPECT_TRUE_U(dash::equal(array_a.begin(), array_a.end() - 1,
+                            array_b.begin()));
+  EXPECT_TRUE_U(dash::equal(array_a.begin(), array_a.end(),
+                            array_b.begin(),
+                            [](int a, int b) { return b - a <= 1; }));
+}
+
+TEST_F(EqualTest, ShiftedRange) {
+  const size_t num_elem_local = 20;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = array.pattern().global(li) % 2;
+  }
+  array.barrier();
+
+  // Compares elements with remote elements of the second range:
+  EXPECT_TRUE_U(dash::equal(array.begin(), array.end() - 2,
+                            array.begin() + 2));
+  EXPECT_FALSE_U(dash::equal(array.begin(), array.end() - 1,
+                             array.begin() + 1));
+}
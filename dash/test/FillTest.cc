@@ -39,3 +39,27 @@ TEST_F(FillTest, TestAllItemsFilled)
     EXPECT_EQ_U(17, static_cast<value_t>(*lbegin));
   }
 }
+
+TEST_F(FillTest, ExecutionPolicies)
+{
+  dash::Array<int> array(dash::size() * 1000 + 11, dash::BLOCKED);
+  dash::fill(dash::execution::seq, array.begin(), array.end(), 1);
+  array.barrier();
+
+  // Fill subrange with parallel policies:
+  dash::fill(dash::execution::par, array.begin() + 7, array.end() - 7, 2);
+  dash::fill(dash::execution::par_unseq,
+             array.begin() + 9, array.begin() + 12, 3);
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    size_t g = array.pattern().global(l);
+    int expected = 1;
+    if (g >= 9 && g < 12) {
+      expected = 3;
+    } else if (g >= 7 && g < array.size() - 7) {
+      expected = 2;
+    }
+    EXPECT_EQ_U(expected, array.local[l]);
+  }
+}
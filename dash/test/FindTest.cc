@@ -319,3 +319,119 @@ TEST_F(FindTest, LessElementsThanUnits)
   array.barrier();
 }
 
+
+TEST_F(FindTest, AllAnyNoneOf)
+{
+  Array_t array(_num_elem);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = array.pattern().global(li);
+  }
+  array.barrier();
+
+  auto is_positive  = [](Element_t v) { return v > 0; };
+  auto is_negative  = [](Element_t v) { return v < 0; };
+  auto is_last      = [&](Element_t v) {
+                        return v == static_cast<Element_t>(_num_elem - 1);
+                      };
+
+  EXPECT_FALSE_U(dash::all_of(array.begin(), array.end(), is_positive));
+  EXPECT_TRUE_U(dash::all_of(array.begin() + 1, array.end(), is_positive));
+  EXPECT_TRUE_U(dash::any_of(array.begin(), array.end(), is_last));
+  EXPECT_FALSE_U(dash::any_of(array.begin(), array.end() - 1, is_last));
+  EXPECT_TRUE_U(dash::none_of(array.begin(), array.end(), is_negative));
+  EXPECT_FALSE_U(dash::none_of(array.begin(), array.end(), is_last));
+}
+
+TEST_F(FindTest, ExecutionPolicies)
+{
+  Array_t array(dash::size() * 1000, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    // Values repeat in every unit's local range:
+    array.local[li] = array.pattern().global(li) % 700;
+  }
+  array.barrier();
+
+  auto found_seq = dash::find(dash::execution::seq,
+                              array.begin(), array.end(), 650);
+  auto found_par = dash::find(dash::execution::par,
+                              array.begin(), array.end(), 650);
+  EXPECT_EQ_U(650, found_seq.pos());
+  EXPECT_EQ_U(650, found_par.pos());
+
+  // First match behind the start of the range:
+  auto found_sub = dash::find(dash::execution::par_unseq,
+                              array.begin() + 651, array.end(), 650);
+  if (dash::size() > 1) {
+    EXPECT_EQ_U(1350, found_sub.pos());
+  } else {
+    EXPECT_EQ_U(array.end(), found_sub);
+  }
+
+  auto not_found = dash::find(dash::execution::par,
+                              array.begin(), array.end(), 700);
+  EXPECT_EQ_U(array.end(), not_found);
+
+  auto found_if  = dash::find_if(dash::execution::par,
+                                 array.begin(), array.end(),
+                                 [](Element_t v) { return v > 600; });
+  EXPECT_EQ_U(601, found_if.pos());
+
+  auto found_if_not = dash::find_if_not(dash::execution::par,
+                                        array.begin(), array.end(),
+                                        [](Element_t v) { return v < 10; });
+  EXPECT_EQ_U(10, found_if_not.pos());
+}
+
+TEST_F(FindTest, EarlyExit)
+{
+  // Several chunks searched between polls in every unit:
+  size_t num_local_elem = 3 * dash::internal::find_poll_elements_per_thread
+                          + 17;
+  size_t num_elem       = dash::size() * num_local_elem;
+  Array_t array(num_elem, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  // Match in the last chunk of every unit, and in the first element of
+  // the second half of the range:
+  std::vector<index_t> matches;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    matches.push_back((u + 1) * num_local_elem - 3);
+  }
+  matches.push_back(num_elem / 2);
+  if (dash::myid() == 0) {
+    for (auto g : matches) {
+      array[g] = 1;
+    }
+  }
+  array.barrier();
+
+  auto found = dash::find(array.begin(), array.end(), 1);
+  EXPECT_EQ_U(std::min<index_t>(matches[0], num_elem / 2), found.pos());
+
+  // First match in a subrange behind a match:
+  auto found_sub = dash::find(dash::execution::par,
+                              array.begin() + num_elem / 2 + 1, array.end(),
+                              1);
+  auto expected  = std::upper_bound(matches.begin(), matches.end() - 1,
+                                    static_cast<index_t>(num_elem / 2));
+  EXPECT_EQ_U(*expected, found_sub.pos());
+
+  auto found_if = dash::find_if(array.begin() + 1, array.end(),
+                                [](Element_t v) { return v > 0; });
+  EXPECT_EQ_U(std::min<index_t>(matches[0], num_elem / 2), found_if.pos());
+
+  auto not_found = dash::find(array.begin(), array.end(), 2);
+  EXPECT_EQ_U(array.end(), not_found);
+  array.barrier();
+
+  // Match in the first and in the last element:
+  if (dash::myid() == 0) {
+    array[0]            = 2;
+    array[num_elem - 1] = 2;
+  }
+  array.barrier();
+  EXPECT_EQ_U(0, dash::find(array.begin(), array.end(), 2).pos());
+  EXPECT_EQ_U(num_elem - 1,
+              dash::find(array.begin() + 1, array.end(), 2).pos());
+}
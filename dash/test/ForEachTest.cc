@@ -127,3 +127,74 @@ TEST_F(ForEachTest, ModifyValues)
   // Verify
   dash::for_each(array.begin(), array.end(), verify);
 }
+
+TEST_F(ForEachTest, ExecutionPolicies)
+{
+  // Enough local elements to distribute the local range to threads:
+  size_t num_elem_local = 3 * dash::internal::parallel_min_elements_per_thread
+                          + 17;
+  dash::Array<int> array(num_elem_local * dash::size(), dash::BLOCKED);
+  dash::fill(dash::execution::par, array.begin(), array.end(), 0);
+  array.barrier();
+
+  auto incr = [](int & el) { el += 1; };
+  dash::for_each(dash::execution::seq,       array.begin(), array.end(),
+                 incr);
+  dash::for_each(dash::execution::par,       array.begin(), array.end(),
+                 incr);
+  dash::for_each(dash::execution::par_unseq, array.begin(), array.end(),
+                 incr);
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(3, array.local[l]);
+  }
+}
+
+TEST_F(ForEachTest, ForEachWithIndexPolicy)
+{
+  dash::Array<long> array(dash::size() * 1000 + 3, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  // Assign global index to every element in a subrange:
+  size_t g_begin = 5;
+  size_t g_end   = array.size() - 9;
+  dash::for_each_with_index(
+    dash::execution::par,
+    array.begin() + g_begin,
+    array.begin() + g_end,
+    [](long & el, index_t gidx) {
+      el = gidx;
+    });
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    size_t g = array.pattern().global(l);
+    long expected = (g >= g_begin && g < g_end) ? static_cast<long>(g) : 0;
+    EXPECT_EQ_U(expected, array.local[l]);
+  }
+}
+
+TEST_F(ForEachTest, LocalChunks)
+{
+  // Chunks must cover the local range exactly once, also if the number
+  // of threads exceeds the number of cores:
+  for (int n_threads : { 1, 3, 4, 7 }) {
+    for (size_t l_size : { 0, 1, 5, 100, 1001 }) {
+      std::vector<int> visits(l_size, 0);
+      dash::internal::local_parallel_chunks(
+        n_threads,
+        l_size,
+        [&](int t_id, std::size_t begin, std::size_t end) {
+          auto chunk = dash::internal::local_chunk(t_id, n_threads, l_size);
+          EXPECT_EQ_U(chunk.begin, begin);
+          EXPECT_EQ_U(chunk.end,   end);
+          for (auto i = begin; i < end; ++i) {
+            visits[i] += 1;
+          }
+        });
+      for (size_t i = 0; i < l_size; ++i) {
+        EXPECT_EQ_U(1, visits[i]);
+      }
+    }
+  }
+}
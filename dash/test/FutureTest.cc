@@ -0,0 +1,179 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "FutureTest.h"
+
+#include <numeric>
+#include <vector>
+
+
+TEST_F(FutureTest, DeferredAndReady)
+{
+  int evaluated = 0;
+  dash::Future<int> fut_deferred([&]() { ++evaluated; return 42; });
+  EXPECT_TRUE_U(fut_deferred.valid());
+  EXPECT_TRUE_U(fut_deferred.is_deferred());
+  EXPECT_FALSE_U(fut_deferred.test());
+  EXPECT_EQ_U(0, evaluated);
+
+  // Copies share the state of the future:
+  auto fut_copy = fut_deferred;
+  EXPECT_EQ_U(42, fut_copy.get());
+  EXPECT_TRUE_U(fut_deferred.test());
+  EXPECT_EQ_U(42, fut_deferred.get());
+  EXPECT_EQ_U(1,  evaluated);
+
+  auto fut_ready = dash::make_ready_future(23);
+  EXPECT_TRUE_U(fut_ready.test());
+  EXPECT_FALSE_U(fut_ready.is_deferred());
+  EXPECT_EQ_U(23, fut_ready.get());
+
+  dash::Future<int> fut_empty;
+  EXPECT_FALSE_U(fut_empty.valid());
+}
+
+TEST_F(FutureTest, TestProgress)
+{
+  int num_tests = 0;
+  dash::Future<int> fut([]()           { return 7; },
+                        [&num_tests]() { return ++num_tests >= 3; });
+  EXPECT_FALSE_U(fut.is_deferred());
+  EXPECT_FALSE_U(fut.test());
+  EXPECT_FALSE_U(fut.test());
+  EXPECT_TRUE_U(fut.test());
+  // Completed futures do not invoke the test function:
+  EXPECT_TRUE_U(fut.test());
+  EXPECT_EQ_U(3, num_tests);
+  EXPECT_EQ_U(7, fut.get());
+}
+
+TEST_F(FutureTest, Continuation)
+{
+  int num_tests = 0;
+  dash::Future<int> fut([]()           { return 10; },
+                        [&num_tests]() { return ++num_tests >= 2; });
+  auto fut_cont = fut.then([](int & value) { return value * 0.5; })
+                     .then([](double & value) {
+                             return static_cast<int>(value) + 1;
+                           });
+  EXPECT_FALSE_U(fut_cont.test());
+  EXPECT_TRUE_U(fut_cont.test());
+  EXPECT_TRUE_U(fut.test());
+  EXPECT_EQ_U(6, fut_cont.get());
+
+  int  side_effect = 0;
+  auto fut_void    = dash::make_ready_future(3).then(
+                       [&](int & value) { side_effect = value; });
+  auto fut_after   = fut_void.then([&]() { return side_effect * 2; });
+  EXPECT_EQ_U(6, fut_after.get());
+  EXPECT_EQ_U(3, side_effect);
+}
+
+TEST_F(FutureTest, WhenAllWhenAny)
+{
+  std::vector<int> num_tests(3, 0);
+  std::vector< dash::Future<int> > futures;
+  for (int f = 0; f < 3; ++f) {
+    futures.push_back(
+      dash::Future<int>([f]()         { return f * 10; },
+                        [&num_tests, f]() { return ++num_tests[f] > f; }));
+  }
+  auto fut_any = dash::when_any(futures);
+  auto fut_all = dash::when_all(futures);
+  EXPECT_EQ_U(0, fut_any.get());
+  // Future f completes in its (f+1)-th test:
+  EXPECT_FALSE_U(fut_all.test());
+  EXPECT_FALSE_U(fut_all.test());
+  EXPECT_TRUE_U(fut_all.test());
+
+  auto results = fut_all.get();
+  EXPECT_EQ_U(3, results.size());
+  for (int f = 0; f < 3; ++f) {
+    EXPECT_EQ_U(f * 10, results[f]);
+  }
+
+  // Deferred futures are completed in wait:
+  std::vector< dash::Future<void> > deferred;
+  int num_evaluated = 0;
+  deferred.push_back(dash::Future<void>([&]() { ++num_evaluated; }));
+  deferred.push_back(dash::Future<void>([&]() { ++num_evaluated; }));
+  auto fut_any_deferred = dash::when_any(deferred);
+  EXPECT_EQ_U(0, fut_any_deferred.get());
+  EXPECT_EQ_U(1, num_evaluated);
+  dash::when_all(deferred).wait();
+  EXPECT_EQ_U(2, num_evaluated);
+
+  // No future in an empty range can complete:
+  std::vector< dash::Future<int> > empty;
+  EXPECT_THROW(dash::when_any(empty), dash::exception::InvalidArgument);
+}
+
+TEST_F(FutureTest, CopyAsyncPipeline)
+{
+  const int num_elem_per_unit = 100;
+  dash::Array<int> array(_dash_size * num_elem_per_unit, dash::BLOCKED);
+
+  for (auto l = 0; l < num_elem_per_unit; ++l) {
+    array.local[l] = (_dash_id * 1000) + l;
+  }
+  array.barrier();
+
+  // Copy blocks of all other units and sum them in continuations:
+  std::vector<int> local_copy(array.size());
+  std::vector< dash::Future<long> > sums;
+  for (size_t u = 0; u < _dash_size; ++u) {
+    int * block_dest = local_copy.data() + (u * num_elem_per_unit);
+    sums.push_back(
+      dash::copy_async(array.begin() + (u * num_elem_per_unit),
+                       array.begin() + ((u + 1) * num_elem_per_unit),
+                       block_dest)
+        .then([=](int * dest_end) {
+                return std::accumulate(block_dest, dest_end, 0L);
+              }));
+  }
+  auto fut_total = dash::when_all(sums).then(
+                     [](std::vector<long> & block_sums) {
+                       return std::accumulate(block_sums.begin(),
+                                              block_sums.end(), 0L);
+                     });
+  while (!fut_total.test()) { }
+
+  long exp_total = 0;
+  for (size_t u = 0; u < _dash_size; ++u) {
+    for (auto l = 0; l < num_elem_per_unit; ++l) {
+      exp_total += (u * 1000) + l;
+      EXPECT_EQ_U((u * 1000) + l,
+                  local_copy[(u * num_elem_per_unit) + l]);
+    }
+  }
+  EXPECT_EQ_U(exp_total, fut_total.get());
+
+  array.barrier();
+}
+
+TEST_F(FutureTest, AsyncLocalToGlobal)
+{
+  const int num_elem_per_unit = 50;
+  dash::Array<int> array(_dash_size * num_elem_per_unit, dash::BLOCKED);
+
+  // Every unit writes its values to the block of its right neighbor:
+  std::vector<int> values(num_elem_per_unit);
+  for (auto l = 0; l < num_elem_per_unit; ++l) {
+    values[l] = (_dash_id * 1000) + l;
+  }
+  auto right   = (_dash_id + 1) % _dash_size;
+  auto fut_put = dash::copy_async(values.data(),
+                                  values.data() + num_elem_per_unit,
+                                  array.begin() + (right *
+                                                   num_elem_per_unit));
+  while (!fut_put.test()) { }
+  EXPECT_EQ_U(array.begin() + ((right + 1) * num_elem_per_unit),
+              fut_put.get());
+  array.barrier();
+
+  auto left = (_dash_id + _dash_size - 1) % _dash_size;
+  for (auto l = 0; l < num_elem_per_unit; ++l) {
+    EXPECT_EQ_U(static_cast<int>((left * 1000) + l),
+                static_cast<int>(array.local[l]));
+  }
+}
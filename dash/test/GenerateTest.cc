@@ -31,3 +31,25 @@ TEST_F(GenerateTest, TestAllItemsGenerated)
     ASSERT_EQ_U(17, static_cast<value_t>(*lbegin));
   }
 }
+
+TEST_F(GenerateTest, ExecutionPolicies)
+{
+  Array_t array(_num_elem);
+  dash::generate(dash::execution::par, array.begin(), array.end(),
+                 []() { return 23.0; });
+  array.barrier();
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(23.0, static_cast<Element_t>(array.local[l]));
+  }
+  array.barrier();
+
+  // Stateful generator is invoked in order in sequenced policy:
+  Element_t next = 0;
+  dash::generate(dash::execution::seq, array.begin(), array.end(),
+                 [&next]() { return next++; });
+  array.barrier();
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(static_cast<Element_t>(l),
+                static_cast<Element_t>(array.local[l]));
+  }
+}
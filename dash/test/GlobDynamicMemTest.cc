@@ -579,3 +579,171 @@ TEST_F(GlobDynamicMemTest, RemoteAccess)
     }
   }
 }
+
+TEST_F(GlobDynamicMemTest, CoalescedAttach)
+{
+  typedef int value_t;
+
+  dash::GlobDynamicMem<value_t> gdmem(0);
+
+  // Grow in many small steps between commits, unit u grows by u+1
+  // elements in every step:
+  int num_grow   = 64;
+  int grow_size  = dash::myid() + 1;
+  for (int round = 0; round < 2; ++round) {
+    size_t nlocal_old = gdmem.local_size();
+    for (int g = 0; g < num_grow; ++g) {
+      auto lit = gdmem.grow(grow_size);
+      for (int i = 0; i < grow_size; ++i) {
+        *(lit + i) = 1000 * dash::myid() + nlocal_old + g * grow_size + i;
+      }
+    }
+    // Buckets grown between commits are allocated in slabs, the number of
+    // buckets is logarithmic in the number of grow operations:
+    size_t max_buckets = (round + 1) * 8;
+    EXPECT_LE_U(gdmem.local_buckets().size(), max_buckets);
+    gdmem.commit();
+
+    size_t nlocal_expect = (round + 1) * num_grow * grow_size;
+    EXPECT_EQ_U(nlocal_expect, gdmem.local_size());
+    EXPECT_EQ_U(nlocal_expect, std::distance(gdmem.lbegin(), gdmem.lend()));
+
+    // Validate values at the next unit:
+    dash::team_unit_t next((dash::myid() + 1) % dash::size());
+    size_t nlocal_next = gdmem.local_size(next);
+    EXPECT_EQ_U((round + 1) * num_grow * (next.id + 1), nlocal_next);
+    for (size_t lidx = 0; lidx < nlocal_next; ++lidx) {
+      value_t expected = 1000 * next.id + lidx;
+      value_t actual;
+      dash::get_value(&actual, gdmem.at(next, lidx));
+      EXPECT_EQ_U(expected, actual);
+    }
+    EXPECT_EQ_U(dash::size() * (dash::size() + 1) / 2 * num_grow *
+                (round + 1),
+                gdmem.size());
+    dash::barrier();
+  }
+}
+
+TEST_F(GlobDynamicMemTest, ReserveGrow)
+{
+  typedef int value_t;
+
+  dash::GlobDynamicMem<value_t> gdmem(4);
+  for (int i = 0; i < 4; ++i) {
+    gdmem.lbegin()[i] = 1000 * dash::myid() + i;
+  }
+  // Unit u grows by u+1 elements in every step:
+  int    num_grow   = 16;
+  int    grow_size  = dash::myid() + 1;
+  size_t capacity   = num_grow * grow_size;
+  gdmem.reserve(capacity);
+  EXPECT_EQ_U(4, gdmem.local_size());
+
+  dash::team_unit_t next((dash::myid() + 1) % dash::size());
+  for (int g = 0; g < num_grow; ++g) {
+    size_t nlocal_old = gdmem.local_size();
+    auto   lit        = gdmem.grow(grow_size);
+    for (int i = 0; i < grow_size; ++i) {
+      *(lit + i) = 1000 * dash::myid() + nlocal_old + i;
+    }
+    // Synchronize values written to grown memory:
+    gdmem.barrier();
+
+    // Local size of the next unit is visible without commit:
+    size_t nlocal_next = gdmem.refresh(next);
+    EXPECT_EQ_U(4 + (g + 1) * (next.id + 1), nlocal_next);
+    for (size_t lidx = 0; lidx < nlocal_next; ++lidx) {
+      value_t expected = 1000 * next.id + lidx;
+      value_t actual;
+      dash::get_value(&actual, gdmem.at(next, lidx));
+      EXPECT_EQ_U(expected, actual);
+    }
+    gdmem.barrier();
+  }
+  EXPECT_EQ_U(dash::size() * 4 +
+              dash::size() * (dash::size() + 1) / 2 * num_grow,
+              gdmem.refresh());
+
+  // Growing beyond the reserved capacity requires a commit:
+  auto lit = gdmem.grow(grow_size);
+  for (int i = 0; i < grow_size; ++i) {
+    *(lit + i) = 1000 * dash::myid() + 4 + capacity + i;
+  }
+  gdmem.commit();
+  size_t nlocal_next = gdmem.local_size(next);
+  EXPECT_EQ_U(4 + (num_grow + 1) * (next.id + 1), nlocal_next);
+  for (size_t lidx = 0; lidx < nlocal_next; ++lidx) {
+    value_t expected = 1000 * next.id + lidx;
+    value_t actual;
+    dash::get_value(&actual, gdmem.at(next, lidx));
+    EXPECT_EQ_U(expected, actual);
+  }
+  EXPECT_EQ_U(dash::size() * 4 +
+              dash::size() * (dash::size() + 1) / 2 * (num_grow + 1),
+              gdmem.size());
+  dash::barrier();
+}
+
+TEST_F(GlobDynamicMemTest, GlobalPosition)
+{
+  typedef int value_t;
+
+  dash::GlobDynamicMem<value_t> gdmem(0);
+
+  // Allocate buckets of different size at every unit, unit 1 does not
+  // allocate local memory:
+  int num_commits = 8;
+  for (int c = 0; c < num_commits; ++c) {
+    size_t nlocal_old = gdmem.local_size();
+    size_t grow_size  = (dash::myid() == 1) ? 0 : dash::myid() + c + 1;
+    auto   lit        = gdmem.grow(grow_size);
+    for (size_t i = 0; i < grow_size; ++i) {
+      *(lit + i) = 1000 * dash::myid() + nlocal_old + i;
+    }
+    gdmem.commit();
+  }
+  gdmem.barrier();
+
+  // Unit and local offset of every global position:
+  std::vector<std::pair<int, size_t> > expected_lpos;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    size_t nlocal_u = gdmem.local_size(dash::team_unit_t(u));
+    for (size_t lidx = 0; lidx < nlocal_u; ++lidx) {
+      expected_lpos.push_back(std::make_pair(u, lidx));
+    }
+  }
+  size_t size = gdmem.size();
+  ASSERT_EQ_U(expected_lpos.size(), size);
+
+  // Random access from the first position and in both directions from
+  // the final position:
+  for (size_t gidx = 0; gidx < size; gidx += 3) {
+    auto git  = gdmem.begin() + gidx;
+    auto lpos = git.lpos();
+    EXPECT_EQ_U(gidx, git.pos());
+    EXPECT_EQ_U(expected_lpos[gidx].first,  lpos.unit);
+    EXPECT_EQ_U(expected_lpos[gidx].second, lpos.index);
+    value_t actual;
+    dash::get_value(&actual, git);
+    EXPECT_EQ_U(1000 * lpos.unit + lpos.index, actual);
+
+    auto git_rev = gdmem.begin() + (size - 1);
+    git_rev     -= (size - 1 - gidx);
+    EXPECT_EQ_U(gidx, git_rev.pos());
+    EXPECT_EQ_U(expected_lpos[gidx].first,  git_rev.lpos().unit);
+    EXPECT_EQ_U(expected_lpos[gidx].second, git_rev.lpos().index);
+
+    auto git_at = gdmem.at(dash::team_unit_t(expected_lpos[gidx].first),
+                           expected_lpos[gidx].second);
+    EXPECT_EQ_U(gidx, git_at.pos());
+  }
+  // Incrementing by single positions crosses buckets and units:
+  auto git = gdmem.begin();
+  for (size_t gidx = 0; gidx < size; ++gidx, ++git) {
+    EXPECT_EQ_U(expected_lpos[gidx].first,  git.lpos().unit);
+    EXPECT_EQ_U(expected_lpos[gidx].second, git.lpos().index);
+  }
+  EXPECT_EQ_U(size, git.pos());
+  gdmem.barrier();
+}
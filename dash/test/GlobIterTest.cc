@@ -0,0 +1,118 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "GlobIterTest.h"
+
+namespace {
+
+/**
+ * Validates local positions and global pointers resolved by global
+ * iterators against the mapping of the pattern.
+ */
+template<class GlobIterType>
+void test_glob_iter_positions(
+  GlobIterType first,
+  GlobIterType last)
+{
+  typedef typename GlobIterType::index_type index_t;
+  auto & pattern = first.pattern();
+  auto & globmem = first.globmem();
+  auto   nelem   = dash::distance(first, last);
+
+  // Forward traversal:
+  index_t gi = 0;
+  for (auto it = first; it != last; ++it, ++gi) {
+    auto exp_lpos = pattern.local(gi);
+    auto it_lpos  = it.lpos();
+    ASSERT_EQ_U(exp_lpos.unit,  it_lpos.unit);
+    ASSERT_EQ_U(exp_lpos.index, it_lpos.index);
+    ASSERT_EQ_U(globmem.at(exp_lpos.unit, exp_lpos.index).dart_gptr(),
+                it.dart_gptr());
+  }
+  ASSERT_EQ_U(nelem, gi);
+
+  // Backward traversal:
+  auto it = last;
+  while (it != first) {
+    --it;
+    --gi;
+    auto exp_lpos = pattern.local(gi);
+    ASSERT_EQ_U(exp_lpos.unit,  it.lpos().unit);
+    ASSERT_EQ_U(exp_lpos.index, it.lpos().index);
+  }
+
+  // Random access with strides, reusing a single iterator:
+  for (index_t stride : { 3, 7, 13 }) {
+    auto sit = first;
+    for (gi = 0; gi < nelem; gi += stride, sit += stride) {
+      auto exp_lpos = pattern.local(gi);
+      ASSERT_EQ_U(exp_lpos.unit,  sit.lpos().unit);
+      ASSERT_EQ_U(exp_lpos.index, sit.lpos().index);
+      ASSERT_EQ_U(globmem.at(exp_lpos.unit, exp_lpos.index).dart_gptr(),
+                  first[gi].dart_gptr());
+    }
+  }
+}
+
+} // namespace
+
+TEST_F(GlobIterTest, Blocked1Dim)
+{
+  dash::Array<int> array(_dash_size * 23, dash::BLOCKED);
+  test_glob_iter_positions(array.begin(), array.end());
+}
+
+TEST_F(GlobIterTest, BlockCyclic1Dim)
+{
+  dash::Array<int> array(_dash_size * 23 + 5, dash::BLOCKCYCLIC(4));
+  test_glob_iter_positions(array.begin(), array.end());
+}
+
+TEST_F(GlobIterTest, Cyclic1Dim)
+{
+  dash::Array<int> array(_dash_size * 7, dash::CYCLIC);
+  test_glob_iter_positions(array.begin(), array.end());
+}
+
+TEST_F(GlobIterTest, Irregular1Dim)
+{
+  typedef dash::CSRPattern<1> pattern_t;
+  std::vector<pattern_t::size_type> local_sizes;
+  for (size_t u = 0; u < _dash_size; ++u) {
+    local_sizes.push_back(5 + (u * 3) % 11);
+  }
+  pattern_t pattern(local_sizes);
+  dash::Array<int, pattern_t::index_type, pattern_t> array(pattern);
+  test_glob_iter_positions(array.begin(), array.end());
+}
+
+TEST_F(GlobIterTest, Tiled2Dim)
+{
+  typedef dash::TilePattern<2, dash::ROW_MAJOR> pattern_t;
+  pattern_t pattern(
+    dash::SizeSpec<2>(_dash_size * 6, 10),
+    dash::DistributionSpec<2>(dash::TILE(3), dash::TILE(5)));
+  dash::Matrix<int, 2, pattern_t::index_type, pattern_t> matrix(pattern);
+  test_glob_iter_positions(matrix.begin(), matrix.end());
+}
+
+TEST_F(GlobIterTest, TiledColMajor2Dim)
+{
+  typedef dash::TilePattern<2, dash::COL_MAJOR> pattern_t;
+  pattern_t pattern(
+    dash::SizeSpec<2>(_dash_size * 4, 9),
+    dash::DistributionSpec<2>(dash::TILE(4), dash::TILE(3)));
+  dash::Matrix<int, 2, pattern_t::index_type, pattern_t> matrix(pattern);
+  test_glob_iter_positions(matrix.begin(), matrix.end());
+}
+
+TEST_F(GlobIterTest, Blocked2Dim)
+{
+  typedef dash::Pattern<2> pattern_t;
+  pattern_t pattern(
+    dash::SizeSpec<2>(_dash_size * 3, 11),
+    dash::DistributionSpec<2>(dash::BLOCKCYCLIC(2), dash::NONE),
+    dash::TeamSpec<2>(dash::Team::All()));
+  dash::Matrix<int, 2, pattern_t::index_type, pattern_t> matrix(pattern);
+  test_glob_iter_positions(matrix.begin(), matrix.end());
+}
@@ -0,0 +1,55 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "GlobReadCacheTest.h"
+
+TEST_F(GlobReadCacheTest, CachedArrayRead) {
+  const size_t num_elem_per_unit = 100;
+  dash::Array<int> array(_dash_size * num_elem_per_unit);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = array.pattern().global(li);
+  }
+  array.barrier();
+
+  auto carray = dash::cached(array, 16, 8);
+  // Read all elements twice, second pass is served from cache for units
+  // with at most 8 remote lines:
+  for (int pass = 0; pass < 2; ++pass) {
+    for (size_t gi = 0; gi < array.size(); ++gi) {
+      ASSERT_EQ_U(static_cast<int>(gi), carray[gi]);
+    }
+  }
+  auto stats = carray.stats();
+  LOG_MESSAGE("cache stats: hits:%zu misses:%zu evictions:%zu",
+              stats.hits, stats.misses, stats.evictions);
+  if (_dash_size > 1) {
+    EXPECT_GT_U(stats.hits, stats.misses);
+  }
+  EXPECT_EQ_U(0, stats.epochs);
+}
+
+TEST_F(GlobReadCacheTest, InvalidateOnBarrier) {
+  const size_t num_elem_per_unit = 32;
+  dash::Array<int> array(_dash_size * num_elem_per_unit);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = _dash_id;
+  }
+  array.barrier();
+
+  auto carray  = dash::cached(array, 8);
+  auto next_gi = ((_dash_id + 1) % _dash_size) * num_elem_per_unit;
+  int  next_id = (_dash_id + 1) % _dash_size;
+  ASSERT_EQ_U(next_id, carray[next_gi]);
+  ASSERT_EQ_U(next_id, carray[next_gi + 1]);
+  array.barrier();
+
+  // Modify values at all units:
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = _dash_id + 100;
+  }
+  carray.barrier();
+  EXPECT_EQ_U(1, carray.stats().epochs);
+  // Cached lines must not be used after barrier:
+  ASSERT_EQ_U(next_id + 100, carray[next_gi]);
+  ASSERT_EQ_U(next_id + 100, carray[next_gi + 1]);
+}
@@ -0,0 +1,125 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "HistogramTest.h"
+
+#include <vector>
+
+namespace {
+
+/**
+ * Pseudo-random key of the element at the given global index, identical
+ * at all units.
+ */
+int key_at(size_t g_index, int max_key)
+{
+  return static_cast<int>((g_index * 2654435761ul) % max_key);
+}
+
+template<class ArrayType>
+void fill_keys(ArrayType & array, int max_key)
+{
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = key_at(array.pattern().global(li), max_key);
+  }
+  array.barrier();
+}
+
+/**
+ * Checks the bin counts of keys at global indices [0, num_keys), keys
+ * at or above the number of bins are ignored.
+ */
+template<class ArrayType>
+void expect_histogram(
+  ArrayType & bins,
+  size_t      num_keys,
+  int         max_key)
+{
+  std::vector<int> expected(bins.size(), 0);
+  for (size_t g = 0; g < num_keys; ++g) {
+    auto key = key_at(g, max_key);
+    if (key < static_cast<int>(bins.size())) {
+      ++expected[key];
+    }
+  }
+  for (size_t lb = 0; lb < bins.lsize(); ++lb) {
+    EXPECT_EQ_U(expected[bins.pattern().global(lb)], bins.local[lb]);
+  }
+}
+
+} // namespace
+
+TEST_F(HistogramTest, DenseBins) {
+  size_t num_keys = _dash_size * 1000 + 3;
+  int    max_key  = 100;
+
+  dash::Array<int> keys(num_keys, dash::BLOCKED);
+  dash::Array<int> bins(max_key, dash::BLOCKED);
+  fill_keys(keys, max_key);
+
+  for (auto strategy : { dash::HistogramStrategy::automatic,
+                         dash::HistogramStrategy::dense,
+                         dash::HistogramStrategy::sparse }) {
+    dash::histogram(keys.begin(), keys.end(), bins,
+                    [](int key) { return key; },
+                    strategy);
+    expect_histogram(bins, num_keys, max_key);
+    bins.barrier();
+  }
+}
+
+TEST_F(HistogramTest, SparseBins) {
+  size_t num_keys = _dash_size * 100;
+  int    max_key  = 1 << 16;
+
+  // Any distribution of keys and bins:
+  dash::Array<int>  keys(num_keys, dash::CYCLIC);
+  dash::Array<long> bins(max_key, dash::BLOCKCYCLIC(1000));
+  fill_keys(keys, max_key);
+
+  for (auto strategy : { dash::HistogramStrategy::automatic,
+                         dash::HistogramStrategy::dense,
+                         dash::HistogramStrategy::sparse }) {
+    dash::histogram(dash::execution::seq, keys.begin(), keys.end(), bins,
+                    [](int key) { return key; },
+                    strategy);
+    std::vector<long> expected(max_key, 0);
+    for (size_t g = 0; g < num_keys; ++g) {
+      ++expected[key_at(g, max_key)];
+    }
+    for (size_t lb = 0; lb < bins.lsize(); ++lb) {
+      EXPECT_EQ_U(expected[bins.pattern().global(lb)], bins.local[lb]);
+    }
+    bins.barrier();
+  }
+}
+
+TEST_F(HistogramTest, KeysOutOfRange) {
+  size_t num_keys = _dash_size * 1000;
+  int    max_key  = 200;
+
+  dash::Array<int> keys(num_keys, dash::BLOCKED);
+  dash::Array<int> bins(max_key / 2, dash::BLOCKED);
+  fill_keys(keys, max_key);
+  dash::fill(bins.begin(), bins.end(), 42);
+  bins.barrier();
+
+  // Previous counts are overwritten, keys without bin are ignored:
+  dash::histogram(keys.begin(), keys.end(), bins,
+                  [](int key) { return key; });
+  expect_histogram(bins, num_keys, max_key);
+  bins.barrier();
+
+  dash::histogram(keys.begin(), keys.end(), bins,
+                  [](int key) { return key - 50; });
+  std::vector<int> expected(bins.size(), 0);
+  for (size_t g = 0; g < num_keys; ++g) {
+    auto bin = key_at(g, max_key) - 50;
+    if (bin >= 0 && bin < static_cast<int>(bins.size())) {
+      ++expected[bin];
+    }
+  }
+  for (size_t lb = 0; lb < bins.lsize(); ++lb) {
+    EXPECT_EQ_U(expected[bins.pattern().global(lb)], bins.local[lb]);
+  }
+}
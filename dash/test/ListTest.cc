@@ -98,3 +98,87 @@ TEST_F(ListTest, Initialization)
   }
 }
 
+
+TEST_F(ListTest, PushPop)
+{
+  typedef int value_t;
+
+  int nunits = dash::size();
+  int npush  = 10;
+  // Small buffer size to force re-allocation in barrier:
+  dash::List<value_t> list(0, 2);
+
+  // Every unit pushes at both ends and adds a local element:
+  for (int i = 0; i < npush; ++i) {
+    list.push_back(1000 * (_dash_id + 1) + i);
+    list.push_front(-1000 * (_dash_id + 1) - i);
+  }
+  list.local.push_back(_dash_id);
+  EXPECT_EQ_U(2 * npush + 1, list.size());
+
+  list.barrier();
+  EXPECT_EQ_U(nunits * (2 * npush + 1), list.size());
+  if (_dash_id == 0) {
+    // Elements pushed at the front and local element, and elements
+    // pushed at the back if the first unit is also the last unit:
+    EXPECT_EQ_U(nunits * npush + 1 + ((nunits > 1) ? 0 : npush),
+                list.lsize());
+  }
+  value_t front = list.front();
+  value_t back  = list.back();
+  EXPECT_LT_U(front, 0);
+  EXPECT_GT_U(back,  999);
+  dash::barrier();
+
+  // Pop all elements concurrently at both ends:
+  dash::Array<int> popped(nunits);
+  dash::Array<int> psum(nunits);
+  int     npopped = 0;
+  int     sum     = 0;
+  value_t value;
+  while (list.pop_front(value)) {
+    ++npopped;
+    sum += value;
+    if (list.pop_back(value)) {
+      ++npopped;
+      sum += value;
+    }
+  }
+  popped.local[0] = npopped;
+  psum.local[0]   = sum;
+  list.barrier();
+  EXPECT_EQ_U(0, list.size());
+  EXPECT_EQ_U(0, list.lsize());
+
+  if (_dash_id == 0) {
+    int total_popped = 0;
+    int total_sum    = 0;
+    int expect_sum   = 0;
+    for (int u = 0; u < nunits; ++u) {
+      total_popped += popped[u];
+      total_sum    += psum[u];
+      expect_sum   += u;
+    }
+    EXPECT_EQ_U(nunits * (2 * npush + 1), total_popped);
+    EXPECT_EQ_U(expect_sum, total_sum);
+  }
+
+  // Order of elements pushed by a single unit:
+  if (_dash_id == 0) {
+    for (int i = 0; i < npush; ++i) {
+      list.push_back(i);
+      list.push_front(-i - 1);
+    }
+  }
+  list.barrier();
+  EXPECT_EQ_U(2 * npush, list.size());
+  if (_dash_id == nunits - 1) {
+    for (int i = -npush; i < npush; ++i) {
+      EXPECT_TRUE_U(list.pop_front(value));
+      EXPECT_EQ_U(i, value);
+    }
+    EXPECT_FALSE_U(list.pop_back(value));
+  }
+  list.barrier();
+  EXPECT_TRUE_U(list.empty());
+}
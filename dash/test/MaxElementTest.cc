@@ -106,3 +106,21 @@ TEST_F(MaxElementTest, TestFindArrayUnderfilled)
               max_value, found_max);
   EXPECT_EQ(max_value, found_max);
 }
+
+TEST_F(MaxElementTest, FirstOccurrence)
+{
+  dash::Array<long> array(dash::size() * 100 + 3, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    auto g = array.pattern().global(li);
+    array.local[li] = (g % 40 == 39) ? 1000 : static_cast<long>(g);
+  }
+  array.barrier();
+
+  auto max_git = dash::max_element(array.begin(), array.end());
+  EXPECT_EQ_U(39, max_git.pos());
+  auto max_git_cmp = dash::max_element(
+                       array.begin(), array.end(),
+                       [](long a, long b) { return a > b; });
+  EXPECT_EQ_U(39, max_git_cmp.pos());
+  EXPECT_EQ_U(1000, static_cast<long>(*max_git));
+}
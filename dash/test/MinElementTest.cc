@@ -1,6 +1,8 @@
 #include <libdash.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <functional>
 #include <limits>
 
 #include "TestBase.h"
@@ -253,3 +255,98 @@ TEST_F(MinElementTest, TestFindMatrixDefault)
   EXPECT_EQ(min_value, found_min);
 }
 
+
+TEST_F(MinElementTest, FirstOccurrence)
+{
+  // Minimum values at the first global index and in every unit:
+  dash::Array<double> array(dash::size() * 100, dash::BLOCKCYCLIC(7));
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    auto g = array.pattern().global(li);
+    array.local[li] = (g % 50 == 0) ? -1.5 : static_cast<double>(g);
+  }
+  array.barrier();
+
+  // Vectorized local search and reduction in dart_allreduce:
+  auto min_git = dash::min_element(array.begin(), array.end());
+  EXPECT_EQ_U(0, min_git.pos());
+  // Comparison function without DART equivalent:
+  auto min_git_cmp = dash::min_element(
+                       array.begin(), array.end(),
+                       [](double a, double b) { return a < b; });
+  EXPECT_EQ_U(0, min_git_cmp.pos());
+
+  // Subrange starting behind the first minimum:
+  auto min_git_sub = dash::min_element(array.begin() + 1, array.end());
+  EXPECT_EQ_U(50, min_git_sub.pos());
+  auto min_git_sub_cmp = dash::min_element(
+                           array.begin() + 1, array.end(),
+                           [](double a, double b) { return a < b; });
+  EXPECT_EQ_U(50, min_git_sub_cmp.pos());
+}
+
+TEST_F(MinElementTest, CustomComparator)
+{
+  struct point_t {
+    int x;
+    int y;
+  };
+  dash::Array<point_t> array(dash::size() * 20);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    int g = array.pattern().global(li);
+    array.local[li] = point_t { g, static_cast<int>(array.size()) - g };
+  }
+  array.barrier();
+
+  auto by_y = [](const point_t & a, const point_t & b) { return a.y < b.y; };
+  auto min_git = dash::min_element(array.begin(), array.end(), by_y);
+  EXPECT_EQ_U(array.size() - 1, min_git.pos());
+  auto max_git = dash::max_element(
+                   array.begin(), array.end(),
+                   [](const point_t & a, const point_t & b) {
+                     return a.y > b.y;
+                   });
+  EXPECT_EQ_U(0, max_git.pos());
+}
+
+TEST_F(MinElementTest, InfiniteValues)
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  dash::Array<double> array(dash::size() * 10);
+  std::fill(array.lbegin(), array.lend(), inf);
+  array.barrier();
+
+  // Units without elements in the range must not exceed the infinity:
+  auto first = array.begin();
+  auto last  = array.begin() + 5;
+  EXPECT_EQ_U(0, dash::min_element(first, last).pos());
+  EXPECT_EQ_U(0, dash::min_element(array.begin(), array.end()).pos());
+  array.barrier();
+
+  std::fill(array.lbegin(), array.lend(), -inf);
+  array.barrier();
+
+  EXPECT_EQ_U(0, dash::max_element(first, last).pos());
+  EXPECT_EQ_U(0, dash::min_element(
+                   first, last, std::greater<double>()).pos());
+  EXPECT_EQ_U(0, dash::max_element(array.begin(), array.end()).pos());
+}
+
+TEST_F(MinElementTest, LocalRange)
+{
+  std::vector<int> values(
+    3 * dash::internal::parallel_min_elements_per_thread + 11);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = (i * 7919) % 1000 + 10;
+  }
+  values[values.size() - 3] = 1;
+  values[values.size() - 2] = 1;
+  values[5] = 2000;
+
+  const int * first = values.data();
+  const int * last  = values.data() + values.size();
+  EXPECT_EQ_U(last - 3, dash::min_element(first, last));
+  EXPECT_EQ_U(first + 5, dash::max_element(first, last));
+  EXPECT_EQ_U(std::min_element(first, last, std::greater<int>()),
+              dash::min_element(first, last, std::greater<int>()));
+  EXPECT_EQ_U(last, dash::min_element(last, last));
+}
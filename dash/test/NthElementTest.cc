@@ -0,0 +1,111 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "NthElementTest.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace {
+
+/**
+ * Pseudo-random key of the element at the given global index, identical
+ * at all units.
+ */
+int key_at(size_t g_index, int max_key)
+{
+  return static_cast<int>((g_index * 2654435761ul) % max_key);
+}
+
+template<class ArrayType>
+void fill_keys(ArrayType & array, int max_key)
+{
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = key_at(array.pattern().global(li), max_key);
+  }
+  array.barrier();
+}
+
+template<class Compare>
+void expect_nth_element(
+  const std::vector<int> & values,
+  size_t                   nth,
+  int                      nth_value,
+  Compare                  comp)
+{
+  EXPECT_EQ_U(nth_value, values[nth]);
+  for (size_t g = 0; g < nth; ++g) {
+    EXPECT_FALSE_U(comp(nth_value, values[g]));
+  }
+  for (size_t g = nth + 1; g < values.size(); ++g) {
+    EXPECT_FALSE_U(comp(values[g], nth_value));
+  }
+}
+
+} // namespace
+
+TEST_F(NthElementTest, Median) {
+  // Unbalanced distribution of elements to units:
+  size_t num_elem_total = _dash_size * 1000 + 3;
+  int    max_key        = 1 << 20;
+  size_t nth            = num_elem_total / 2;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  fill_keys(array, max_key);
+
+  dash::nth_element(array.begin(), array.begin() + nth, array.end());
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = key_at(g, max_key);
+  }
+  std::nth_element(expected.begin(), expected.begin() + nth,
+                   expected.end());
+  auto values = dash::test::copy_to_vector(array);
+  expect_nth_element(values, nth, expected[nth], std::less<int>());
+  // Elements are permuted:
+  std::sort(values.begin(), values.end());
+  std::sort(expected.begin(), expected.end());
+  EXPECT_TRUE_U(expected == values);
+}
+
+TEST_F(NthElementTest, DuplicateKeys) {
+  size_t num_elem_total = _dash_size * 1000;
+  int    max_key        = 5;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = key_at(g, max_key);
+  }
+  std::sort(expected.begin(), expected.end());
+
+  for (size_t nth : { size_t(0), num_elem_total / 3, num_elem_total - 1 }) {
+    fill_keys(array, max_key);
+    dash::nth_element(array.begin(), array.begin() + nth, array.end());
+    expect_nth_element(dash::test::copy_to_vector(array), nth, expected[nth],
+                       std::less<int>());
+    array.barrier();
+  }
+}
+
+TEST_F(NthElementTest, CustomComparator) {
+  size_t num_elem_total = _dash_size * 500;
+  int    max_key        = 1000;
+  size_t nth            = 7;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  fill_keys(array, max_key);
+
+  dash::nth_element(array.begin(), array.begin() + nth, array.end(),
+                    std::greater<int>());
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = key_at(g, max_key);
+  }
+  std::sort(expected.begin(), expected.end(), std::greater<int>());
+  expect_nth_element(dash::test::copy_to_vector(array), nth, expected[nth],
+                     std::greater<int>());
+}
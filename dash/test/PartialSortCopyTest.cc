@@ -0,0 +1,100 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "PartialSortCopyTest.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace {
+
+/**
+ * Pseudo-random key of the element at the given global index, identical
+ * at all units.
+ */
+int key_at(size_t g_index, int max_key)
+{
+  return static_cast<int>((g_index * 2654435761ul) % max_key);
+}
+
+template<class ArrayType>
+void fill_keys(ArrayType & array, int max_key)
+{
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = key_at(array.pattern().global(li), max_key);
+  }
+  array.barrier();
+}
+
+} // namespace
+
+TEST_F(PartialSortCopyTest, TopK) {
+  // Unbalanced distribution of elements to units:
+  size_t num_elem_total = _dash_size * 1000 + 3;
+  int    max_key        = 1 << 20;
+  size_t k              = 100;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  fill_keys(array, max_key);
+
+  std::vector<int> top_k(k);
+  auto top_k_end = dash::partial_sort_copy(array.begin(), array.end(),
+                                           top_k.begin(), top_k.end(),
+                                           std::greater<int>());
+  EXPECT_EQ_U(top_k.end(), top_k_end);
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = key_at(g, max_key);
+  }
+  std::partial_sort(expected.begin(), expected.begin() + k, expected.end(),
+                    std::greater<int>());
+  expected.resize(k);
+  EXPECT_TRUE_U(expected == top_k);
+
+  // Range is not modified:
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    EXPECT_EQ_U(key_at(array.pattern().global(li), max_key),
+                array.local[li]);
+  }
+}
+
+TEST_F(PartialSortCopyTest, DuplicateKeys) {
+  size_t num_elem_total = _dash_size * 1000;
+  int    max_key        = 3;
+
+  // Any distribution, local elements need not be contiguous:
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(7));
+  fill_keys(array, max_key);
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = key_at(g, max_key);
+  }
+  std::sort(expected.begin(), expected.end());
+
+  for (size_t k : { size_t(1), num_elem_total / 2 + 1 }) {
+    std::vector<int> smallest(k);
+    dash::partial_sort_copy(array.begin(), array.end(),
+                            smallest.begin(), smallest.end());
+    EXPECT_TRUE_U(std::equal(smallest.begin(), smallest.end(),
+                             expected.begin()));
+  }
+}
+
+TEST_F(PartialSortCopyTest, LargerDestination) {
+  size_t num_elem_total = _dash_size * 10;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  fill_keys(array, 100);
+
+  std::vector<int> values(num_elem_total + 5, -1);
+  auto values_end = dash::partial_sort_copy(array.begin(), array.end(),
+                                            values.data(),
+                                            values.data() + values.size());
+  EXPECT_EQ_U(values.data() + num_elem_total, values_end);
+  EXPECT_TRUE_U(std::is_sorted(values.begin(),
+                               values.begin() + num_elem_total));
+  EXPECT_EQ_U(-1, values[num_elem_total]);
+}
@@ -0,0 +1,37 @@
+#ifndef DASH__TEST__PARTIAL_SORT_COPY_TEST_H_
+#define DASH__TEST__PARTIAL_SORT_COPY_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+#include "TestBase.h"
+
+/**
+ * Test fixture for algorithm dash::partial_sort_copy
+ */
+class PartialSortCopyTest : public dash::test::TestBase {
+protected:
+  size_t _dash_id;
+  size_t _dash_size;
+
+  PartialSortCopyTest() 
+  : _dash_id(0),
+    _dash_size(0) {
+    LOG_MESSAGE(">>> Test suite: PartialSortCopyTest");
+  }
+
+  virtual ~PartialSortCopyTest() {
+    LOG_MESSAGE("<<< Closing test suite: PartialSortCopyTest");
+  }
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    _dash_id   = dash::myid();
+    _dash_size = dash::size();
+  }
+
+  virtual void TearDown() {
+    dash::test::TestBase::TearDown();
+  }
+};
+
+#endif // DASH__TEST__PARTIAL_SORT_COPY_TEST_H_
@@ -0,0 +1,50 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "PartitionTest.h"
+
+#include <algorithm>
+#include <vector>
+
+TEST_F(PartitionTest, StablePartition) {
+  // Unbalanced distribution of elements to units:
+  size_t num_elem_total = _dash_size * 1000 + 3;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<int>(array.pattern().global(li));
+  }
+  array.barrier();
+
+  auto is_even = [](int v) { return v % 2 == 0; };
+  auto pivot   = dash::partition(array.begin(), array.end(), is_even);
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = static_cast<int>(g);
+  }
+  auto expected_pivot = std::stable_partition(expected.begin(),
+                                              expected.end(),
+                                              is_even);
+  ASSERT_EQ_U(expected_pivot - expected.begin(),
+              dash::distance(array.begin(), pivot));
+  EXPECT_TRUE_U(expected == dash::test::copy_to_vector(array));
+}
+
+TEST_F(PartitionTest, SingleGroup) {
+  size_t num_elem_total = _dash_size * 10;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 1);
+  array.barrier();
+
+  auto pivot = dash::partition(dash::execution::seq,
+                               array.begin(), array.end(),
+                               [](int v) { return v > 0; });
+  EXPECT_EQ_U(array.end(), pivot);
+
+  array.barrier();
+  pivot = dash::partition(array.begin(), array.end(),
+                          [](int v) { return v < 0; });
+  EXPECT_EQ_U(array.begin(), pivot);
+}
@@ -0,0 +1,119 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "RemoveTest.h"
+
+#include <algorithm>
+#include <vector>
+
+TEST_F(RemoveTest, RemoveIf) {
+  // Unbalanced distribution of elements to units:
+  size_t num_elem_total = _dash_size * 1000 + 3;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<int>(array.pattern().global(li));
+  }
+  array.barrier();
+
+  auto is_multiple_of_3 = [](int v) { return v % 3 == 0; };
+  auto new_end = dash::remove_if(array.begin(), array.end(),
+                                 is_multiple_of_3);
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = static_cast<int>(g);
+  }
+  expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                is_multiple_of_3),
+                 expected.end());
+  ASSERT_EQ_U(expected.size(),
+              static_cast<size_t>(dash::distance(array.begin(), new_end)));
+  auto values = dash::test::copy_to_vector(array);
+  values.resize(expected.size());
+  EXPECT_TRUE_U(expected == values);
+}
+
+TEST_F(RemoveTest, RemoveValue) {
+  size_t num_elem_total = _dash_size * 100;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<int>(array.pattern().global(li) % 4);
+  }
+  array.barrier();
+
+  auto new_end = dash::remove(dash::execution::seq,
+                              array.begin(), array.end(), 1);
+
+  std::vector<int> expected;
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    if (g % 4 != 1) {
+      expected.push_back(static_cast<int>(g % 4));
+    }
+  }
+  ASSERT_EQ_U(expected.size(),
+              static_cast<size_t>(dash::distance(array.begin(), new_end)));
+  auto values = dash::test::copy_to_vector(array);
+  values.resize(expected.size());
+  EXPECT_TRUE_U(expected == values);
+}
+
+TEST_F(RemoveTest, RemoveAll) {
+  size_t num_elem_total = _dash_size * 10;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 5);
+  array.barrier();
+
+  auto new_end = dash::remove(array.begin(), array.end(), 5);
+  EXPECT_EQ_U(array.begin(), new_end);
+}
+
+TEST_F(RemoveTest, Subrange) {
+  size_t num_elem_total = _dash_size * 100;
+  size_t g_begin        = 5;
+  size_t g_end          = num_elem_total - 7;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<int>(array.pattern().global(li));
+  }
+  array.barrier();
+
+  auto is_odd  = [](int v) { return v % 2 != 0; };
+  auto new_end = dash::remove_if(array.begin() + g_begin,
+                                 array.begin() + g_end,
+                                 is_odd);
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = static_cast<int>(g);
+  }
+  auto expected_end = std::remove_if(expected.begin() + g_begin,
+                                     expected.begin() + g_end,
+                                     is_odd);
+  ASSERT_EQ_U(expected_end - expected.begin(),
+              dash::distance(array.begin(), new_end));
+  auto values = dash::test::copy_to_vector(array);
+  // Elements preceding the subrange are unchanged:
+  EXPECT_TRUE_U(std::equal(expected.begin(), expected_end, values.begin()));
+  // Elements following the subrange are unchanged:
+  EXPECT_TRUE_U(std::equal(expected.begin() + g_end, expected.end(),
+                           values.begin() + g_end));
+}
+
+TEST_F(RemoveTest, NonContiguousLocalRange) {
+  if (_dash_size < 2) {
+    SKIP_TEST();
+  }
+  size_t num_elem_total = _dash_size * 20;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(2));
+  dash::fill(array.begin(), array.end(), 1);
+  array.barrier();
+
+  EXPECT_THROW(
+    dash::remove(array.begin(), array.end(), 1),
+    dash::exception::InvalidArgument);
+}
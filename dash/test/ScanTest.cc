@@ -0,0 +1,155 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "ScanTest.h"
+
+#include <algorithm>
+#include <vector>
+
+TEST_F(ScanTest, InclusiveInPlace) {
+  // Unbalanced distribution of elements to units:
+  size_t num_elem_total = _dash_size * 100 + 7;
+
+  dash::Array<long> array(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = array.pattern().global(li);
+  }
+  array.barrier();
+
+  auto d_last = dash::inclusive_scan(array.begin(), array.end(),
+                                     array.begin());
+  EXPECT_EQ_U(array.end(), d_last);
+
+  auto values = dash::test::copy_to_vector(array);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    EXPECT_EQ_U(static_cast<long>(g * (g + 1) / 2), values[g]);
+  }
+}
+
+TEST_F(ScanTest, ExclusiveInPlace) {
+  size_t num_elem_total = _dash_size * 100;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 2);
+  array.barrier();
+
+  dash::exclusive_scan(array.begin(), array.end(), array.begin(), 10);
+
+  auto values = dash::test::copy_to_vector(array);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    EXPECT_EQ_U(10 + 2 * static_cast<int>(g), values[g]);
+  }
+}
+
+TEST_F(ScanTest, OtherDistribution) {
+  size_t num_elem_total = _dash_size * 50;
+
+  dash::Array<int> in(num_elem_total, dash::BLOCKED);
+  dash::Array<int> out(num_elem_total, dash::BLOCKCYCLIC(3));
+  dash::fill(in.begin(), in.end(), 1);
+  in.barrier();
+
+  dash::inclusive_scan(in.begin(), in.end(), out.begin(),
+                       dash::plus<int>(), 5);
+
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    EXPECT_EQ_U(5 + static_cast<int>(g) + 1, static_cast<int>(out[g]));
+  }
+}
+
+TEST_F(ScanTest, ShiftedOutput) {
+  size_t num_elem_total = _dash_size * 20;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 1);
+  array.barrier();
+
+  // Output range overlaps input elements of succeeding units:
+  dash::inclusive_scan(array.begin(), array.end() - 1, array.begin() + 1);
+
+  auto values = dash::test::copy_to_vector(array);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    EXPECT_EQ_U(std::max<int>(1, g), values[g]);
+  }
+}
+
+TEST_F(ScanTest, Subrange) {
+  size_t num_elem_total = _dash_size * 10;
+  size_t g_begin        = 3;
+  size_t g_end          = num_elem_total - 4;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 1);
+  array.barrier();
+
+  dash::exclusive_scan(array.begin() + g_begin, array.begin() + g_end,
+                       array.begin() + g_begin, 0);
+
+  auto values = dash::test::copy_to_vector(array);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    int expected = (g >= g_begin && g < g_end) ? g - g_begin : 1;
+    EXPECT_EQ_U(expected, values[g]);
+  }
+}
+
+TEST_F(ScanTest, CustomOperation) {
+  size_t num_elem_total = _dash_size * 30;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  dash::Array<int> out_dart(num_elem_total, dash::BLOCKED);
+  dash::Array<int> out_custom(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    auto g = array.pattern().global(li);
+    array.local[li] = (g % 7 == 0) ? static_cast<int>(g) : -1;
+  }
+  array.barrier();
+
+  // Running maximum, in a dart_exscan and with an operation without
+  // DART equivalent:
+  dash::inclusive_scan(array.begin(), array.end(), out_dart.begin(),
+                       dash::max<int>());
+  dash::inclusive_scan(array.begin(), array.end(), out_custom.begin(),
+                       [](int a, int b) { return std::max(a, b); });
+
+  auto values_dart   = dash::test::copy_to_vector(out_dart);
+  auto values_custom = dash::test::copy_to_vector(out_custom);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    int expected = static_cast<int>(g - g % 7);
+    EXPECT_EQ_U(expected, values_dart[g]);
+    EXPECT_EQ_U(expected, values_custom[g]);
+  }
+}
+
+TEST_F(ScanTest, FewElements) {
+  // Less elements than units:
+  size_t num_elem_total = std::max<size_t>(1, _dash_size - 1);
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 3);
+  array.barrier();
+
+  dash::inclusive_scan(array.begin(), array.end(), array.begin(),
+                       [](int a, int b) { return a + b; });
+
+  auto values = dash::test::copy_to_vector(array);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    EXPECT_EQ_U(3 * static_cast<int>(g + 1), values[g]);
+  }
+}
+
+TEST_F(ScanTest, NonContiguousLocalRange) {
+  if (_dash_size < 2) {
+    SKIP_TEST();
+  }
+  // The last unit owns a single contiguous block, all other units own
+  // two blocks:
+  size_t num_elem_total = (2 * _dash_size - 1) * 10;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(10));
+  dash::fill(array.begin(), array.end(), 1);
+  array.barrier();
+
+  EXPECT_THROW(
+    dash::inclusive_scan(array.begin(), array.end(), array.begin()),
+    dash::exception::InvalidArgument);
+}
@@ -0,0 +1,174 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "SortTest.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace {
+
+/**
+ * Pseudo-random key of the element at the given global index, identical
+ * at all units.
+ */
+int key_at(size_t g_index, int max_key)
+{
+  return static_cast<int>((g_index * 2654435761ul) % max_key);
+}
+
+template<class ArrayType>
+void fill_keys(ArrayType & array, int max_key)
+{
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = key_at(array.pattern().global(li), max_key);
+  }
+  array.barrier();
+}
+
+} // namespace
+
+TEST_F(SortTest, RandomKeys) {
+  // Unbalanced distribution of elements to units:
+  size_t num_elem_total = _dash_size * 1000 + 3;
+  int    max_key        = 1 << 20;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  fill_keys(array, max_key);
+
+  dash::sort(array.begin(), array.end());
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = key_at(g, max_key);
+  }
+  std::sort(expected.begin(), expected.end());
+  EXPECT_TRUE_U(expected == dash::test::copy_to_vector(array));
+}
+
+TEST_F(SortTest, DuplicateKeys) {
+  size_t num_elem_total = _dash_size * 1000;
+  int    max_key        = 3;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  fill_keys(array, max_key);
+
+  dash::sort(array.begin(), array.end());
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = key_at(g, max_key);
+  }
+  std::sort(expected.begin(), expected.end());
+  EXPECT_TRUE_U(expected == dash::test::copy_to_vector(array));
+
+  // All elements equal:
+  array.barrier();
+  dash::fill(array.begin(), array.end(), 7);
+  array.barrier();
+  dash::sort(array.begin(), array.end());
+  auto values = dash::test::copy_to_vector(array);
+  EXPECT_EQ_U(num_elem_total,
+              static_cast<size_t>(std::count(values.begin(), values.end(),
+                                             7)));
+}
+
+TEST_F(SortTest, CustomComparator) {
+  size_t num_elem_total = _dash_size * 500;
+  int    max_key        = 1000;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  fill_keys(array, max_key);
+
+  dash::sort(array.begin(), array.end(), std::greater<int>());
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = key_at(g, max_key);
+  }
+  std::sort(expected.begin(), expected.end(), std::greater<int>());
+  EXPECT_TRUE_U(expected == dash::test::copy_to_vector(array));
+}
+
+TEST_F(SortTest, Subrange) {
+  size_t num_elem_total = _dash_size * 100;
+  size_t g_begin        = 5;
+  size_t g_end          = num_elem_total - 7;
+  int    max_key        = 100;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  fill_keys(array, max_key);
+
+  dash::sort(array.begin() + g_begin, array.begin() + g_end);
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = key_at(g, max_key);
+  }
+  std::sort(expected.begin() + g_begin, expected.begin() + g_end);
+  EXPECT_TRUE_U(expected == dash::test::copy_to_vector(array));
+}
+
+TEST_F(SortTest, FewElements) {
+  // Less elements than units:
+  size_t num_elem_total = std::max<size_t>(1, _dash_size - 1);
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = -static_cast<int>(array.pattern().global(li));
+  }
+  array.barrier();
+
+  dash::sort(array.begin(), array.end());
+
+  auto values = dash::test::copy_to_vector(array);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    EXPECT_EQ_U(static_cast<int>(g) - static_cast<int>(num_elem_total - 1),
+                values[g]);
+  }
+}
+
+TEST_F(SortTest, StructElements) {
+  struct point_t {
+    int    key;
+    double value;
+  };
+  size_t num_elem_total = _dash_size * 200;
+  int    max_key        = 50;
+
+  dash::Array<point_t> array(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    int key = key_at(array.pattern().global(li), max_key);
+    array.local[li] = point_t { key, 0.5 * key };
+  }
+  array.barrier();
+
+  dash::sort(array.begin(), array.end(),
+             [](const point_t & a, const point_t & b) {
+               return a.key < b.key;
+             });
+
+  auto values = dash::test::copy_to_vector(array);
+  EXPECT_TRUE_U(std::is_sorted(values.begin(), values.end(),
+                               [](const point_t & a, const point_t & b) {
+                                 return a.key < b.key;
+                               }));
+  for (const auto & p : values) {
+    EXPECT_EQ_U(0.5 * p.key, p.value);
+  }
+}
+
+TEST_F(SortTest, NonContiguousLocalRange) {
+  if (_dash_size < 2) {
+    SKIP_TEST();
+  }
+  size_t num_elem_total = _dash_size * 20;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(2));
+  fill_keys(array, 100);
+
+  EXPECT_THROW(
+    dash::sort(array.begin(), array.end()),
+    dash::exception::InvalidArgument);
+}
@@ -0,0 +1,37 @@
+#ifndef DASH__TEST__SORT_TEST_H_
+#define DASH__TEST__SORT_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+#include "TestBase.h"
+
+/**
+ * Test fixture for algorithm dash::sort
+ */
+class SortTest : public dash::test::TestBase {
+protected:
+  size_t _dash_id;
+  size_t _dash_size;
+
+  SortTest() 
+  : _dash_id(0),
+    _dash_size(0) {
+    LOG_MESSAGE(">>> Test suite: SortTest");
+  }
+
+  virtual ~SortTest() {
+    LOG_MESSAGE("<<< Closing test suite: SortTest");
+  }
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    _dash_id   = dash::myid();
+    _dash_size = dash::size();
+  }
+
+  virtual void TearDown() {
+    dash::test::TestBase::TearDown();
+  }
+};
+
+#endif // DASH__TEST__SORT_TEST_H_
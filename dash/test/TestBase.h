@@ -8,6 +8,8 @@
 #include "TestPrinter.h"
 #include "TestLogHelpers.h"
 
+#include <vector>
+
 
 namespace testing {
 namespace internal {
@@ -124,6 +126,19 @@ class TestBase : public ::testing::Test {
   }
 };
 
+/**
+ * Copies all elements of a global container to a local vector, in global
+ * canonical order.
+ */
+template<class ContainerType>
+std::vector<typename ContainerType::value_type> copy_to_vector(
+  ContainerType & container)
+{
+  std::vector<typename ContainerType::value_type> values(container.size());
+  dash::copy(container.begin(), container.end(), values.data());
+  return values;
+}
+
 } // namespace test
 } // namespace dash
 
@@ -207,3 +207,147 @@ TEST_F(TransformTest, MatrixGlobalPlusGlobalBlocking)
   EXPECT_EQ_U(first_l_block_a_begin,
               first_l_block_a_offsets);
 }
+
+TEST_F(TransformTest, ExecutionPolicies)
+{
+  size_t num_elem_total = _dash_size * 1000 + 13;
+  dash::Array<int> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_b(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_c(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array_a.lsize(); ++l) {
+    array_a.local[l] = array_a.pattern().global(l);
+    array_b.local[l] = 2;
+  }
+  dash::fill(array_c.begin(), array_c.end(), -1);
+  dash::barrier();
+
+  // Owner-computes transform with arbitrary binary operation in subrange:
+  size_t g_begin = 3;
+  size_t g_end   = num_elem_total - 5;
+  auto out_last = dash::transform(
+                    dash::execution::par,
+                    array_a.begin() + g_begin, array_a.begin() + g_end,
+                    array_b.begin() + g_begin,
+                    array_c.begin() + g_begin,
+                    [](int a, int b) { return a * b + 1; });
+  EXPECT_EQ_U(array_c.begin() + g_end, out_last);
+
+  dash::barrier();
+
+  for (size_t l = 0; l < array_c.lsize(); ++l) {
+    size_t g = array_c.pattern().global(l);
+    int expected = (g >= g_begin && g < g_end) ? 2 * g + 1 : -1;
+    EXPECT_EQ_U(expected, array_c.local[l]);
+  }
+}
+
+TEST_F(TransformTest, OwnerComputesUnary)
+{
+  size_t num_elem_total = _dash_size * 100 + 7;
+  dash::Array<int> array_in(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_out(num_elem_total, dash::BLOCKCYCLIC(3));
+  for (size_t l = 0; l < array_in.lsize(); ++l) {
+    array_in.local[l] = array_in.pattern().global(l);
+  }
+  dash::fill(array_out.begin(), array_out.end(), -1);
+  dash::barrier();
+
+  // Output distribution differs from input distribution:
+  auto out_last = dash::transform(dash::execution::par,
+                                  array_in.begin() + 2, array_in.end(),
+                                  array_out.begin(),
+                                  [](int v) { return v * v; });
+  EXPECT_EQ_U(array_out.begin() + (num_elem_total - 2), out_last);
+
+  dash::barrier();
+
+  for (size_t l = 0; l < array_out.lsize(); ++l) {
+    int g        = array_out.pattern().global(l);
+    int expected = (g < static_cast<int>(num_elem_total) - 2)
+                   ? (g + 2) * (g + 2)
+                   : -1;
+    EXPECT_EQ_U(expected, array_out.local[l]);
+  }
+}
+
+TEST_F(TransformTest, OwnerComputesBinary)
+{
+  size_t num_elem_total = _dash_size * 100;
+  dash::Array<int> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_b(num_elem_total, dash::BLOCKCYCLIC(5));
+  dash::Array<int> array_c(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array_a.lsize(); ++l) {
+    array_a.local[l] = array_a.pattern().global(l);
+  }
+  for (size_t l = 0; l < array_b.lsize(); ++l) {
+    array_b.local[l] = 1000 * array_b.pattern().global(l);
+  }
+  dash::fill(array_c.begin(), array_c.end(), -1);
+  dash::barrier();
+
+  // Output range different from rhs input range and operation without
+  // DART equivalent, rhs range shifted:
+  dash::transform(array_a.begin(), array_a.end() - 1,
+                  array_b.begin() + 1,
+                  array_c.begin(),
+                  [](int a, int b) { return b - a; });
+
+  dash::barrier();
+
+  for (size_t l = 0; l < array_c.lsize(); ++l) {
+    int g        = array_c.pattern().global(l);
+    int expected = (g < static_cast<int>(num_elem_total) - 1)
+                   ? 1000 * (g + 1) - g
+                   : -1;
+    EXPECT_EQ_U(expected, array_c.local[l]);
+  }
+
+  dash::barrier();
+
+  // Output range at the same position as the rhs input range in a
+  // different array is not accumulated:
+  dash::Array<int> array_d(num_elem_total, dash::BLOCKED);
+  dash::fill(array_d.begin(), array_d.end(), 1);
+  dash::barrier();
+  dash::transform(array_a.begin(), array_a.end(),
+                  array_d.begin(),
+                  array_c.begin(),
+                  dash::plus<int>());
+  dash::barrier();
+
+  for (size_t l = 0; l < array_c.lsize(); ++l) {
+    int g = array_c.pattern().global(l);
+    EXPECT_EQ_U(g + 1, array_c.local[l]);
+  }
+}
+
+TEST_F(TransformTest, ZipTransform)
+{
+  size_t num_elem_total = _dash_size * 100 + 3;
+  dash::Array<double> array_x(num_elem_total, dash::BLOCKED);
+  dash::Array<int>    array_y(num_elem_total, dash::CYCLIC);
+  dash::Array<int>    array_z(num_elem_total, dash::BLOCKED);
+  dash::Array<double> array_out(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array_x.lsize(); ++l) {
+    array_x.local[l] = 0.5 * array_x.pattern().global(l);
+    array_z.local[l] = 3;
+  }
+  for (size_t l = 0; l < array_y.lsize(); ++l) {
+    array_y.local[l] = 2 * array_y.pattern().global(l);
+  }
+  dash::barrier();
+
+  auto out_last = dash::zip_transform(
+                    dash::execution::par_unseq,
+                    array_out.begin(), array_out.end(),
+                    [](double x, int y, int z) { return x * y + z; },
+                    array_x.begin(), array_y.begin(), array_z.begin());
+  EXPECT_EQ_U(array_out.end(), out_last);
+
+  dash::barrier();
+
+  for (size_t l = 0; l < array_out.lsize(); ++l) {
+    double g = array_out.pattern().global(l);
+    EXPECT_EQ_U(g * g + 3, array_out.local[l]);
+  }
+}
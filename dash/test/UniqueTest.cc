@@ -0,0 +1,67 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "UniqueTest.h"
+
+#include <algorithm>
+#include <vector>
+
+TEST_F(UniqueTest, ConsecutiveDuplicates) {
+  // Groups of equal elements span unit boundaries:
+  size_t num_elem_total = _dash_size * 1000 + 3;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<int>(array.pattern().global(li) / 7);
+  }
+  array.barrier();
+
+  auto new_end = dash::unique(array.begin(), array.end());
+
+  size_t num_unique = (num_elem_total + 6) / 7;
+  ASSERT_EQ_U(num_unique,
+              static_cast<size_t>(dash::distance(array.begin(), new_end)));
+  auto values = dash::test::copy_to_vector(array);
+  for (size_t g = 0; g < num_unique; ++g) {
+    EXPECT_EQ_U(static_cast<int>(g), values[g]);
+  }
+}
+
+TEST_F(UniqueTest, AllEqual) {
+  size_t num_elem_total = _dash_size * 10;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 3);
+  array.barrier();
+
+  auto new_end = dash::unique(dash::execution::seq,
+                              array.begin(), array.end());
+  ASSERT_EQ_U(1, dash::distance(array.begin(), new_end));
+  EXPECT_EQ_U(3, static_cast<int>(array[0]));
+}
+
+TEST_F(UniqueTest, CustomPredicate) {
+  size_t num_elem_total = _dash_size * 100;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<int>(array.pattern().global(li));
+  }
+  array.barrier();
+
+  // Elements are equivalent if they are in the same group of 10:
+  auto same_group = [](int a, int b) { return a / 10 == b / 10; };
+  auto new_end    = dash::unique(array.begin() + 5, array.end(),
+                                 same_group);
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = static_cast<int>(g);
+  }
+  auto expected_end = std::unique(expected.begin() + 5, expected.end(),
+                                  same_group);
+  ASSERT_EQ_U(expected_end - expected.begin(),
+              dash::distance(array.begin(), new_end));
+  auto values = dash::test::copy_to_vector(array);
+  EXPECT_TRUE_U(std::equal(expected.begin(), expected_end, values.begin()));
+}
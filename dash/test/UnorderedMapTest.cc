@@ -10,11 +10,12 @@
 
 TEST_F(UnorderedMapTest, Initialization)
 {
-  typedef int                                  key_t;
-  typedef double                               mapped_t;
-  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
-  typedef typename map_t::iterator             map_iterator;
-  typedef typename map_t::value_type           map_value;
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::HashLocal<key_t>                        hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::iterator                      map_iterator;
+  typedef typename map_t::value_type                    map_value;
 
   auto nunits    = dash::size();
   auto myid      = dash::myid();
@@ -75,11 +76,12 @@ TEST_F(UnorderedMapTest, Initialization)
 
 TEST_F(UnorderedMapTest, BalancedGlobalInsert)
 {
-  typedef int                                  key_t;
-  typedef double                               mapped_t;
-  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
-  typedef typename map_t::iterator             map_iterator;
-  typedef typename map_t::value_type           map_value;
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::HashLocal<key_t>                        hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::iterator                      map_iterator;
+  typedef typename map_t::value_type                    map_value;
 
   map_t map;
   EXPECT_EQ_U(0, map.size());
@@ -176,12 +178,13 @@ TEST_F(UnorderedMapTest, BalancedGlobalInsert)
 
 TEST_F(UnorderedMapTest, UnbalancedGlobalInsert)
 {
-  typedef int                                  key_t;
-  typedef double                               mapped_t;
-  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
-  typedef typename map_t::iterator             map_iterator;
-  typedef typename map_t::value_type           map_value;
-  typedef typename map_t::size_type            size_type;
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::HashLocal<key_t>                        hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::iterator                      map_iterator;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
 
   if (dash::size() < 2) {
     LOG_MESSAGE(
@@ -452,3 +455,500 @@ TEST_F(UnorderedMapTest, Local)
     }
   }
 }
+
+TEST_F(UnorderedMapTest, HashedLookup)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+
+  int nunits         = dash::size();
+  // Exceeds initial capacity of local buffer and local index:
+  int local_elements = 1000;
+
+  map_t map;
+  // Every unit inserts the keys mapped to it:
+  for (int li = 0; li < local_elements; ++li) {
+    key_t     key    = (nunits * li) + _dash_id;
+    mapped_t  mapped = 0.5 * key;
+    auto insertion = map.local.insert(map_value({ key, mapped }));
+    EXPECT_TRUE_U(insertion.second);
+  }
+  // Local lookups before commit:
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + _dash_id;
+    EXPECT_EQ_U(1, map.count(key));
+    EXPECT_EQ_U(1, map.local.count(key));
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+
+  // Look up keys of all units, starting at the next unit:
+  for (int li = 0; li < local_elements; ++li) {
+    key_t    key    = (nunits * li) + ((_dash_id + 1) % nunits);
+    mapped_t mapped = 0.5 * key;
+    auto found = map.find(key);
+    EXPECT_NE_U(map.end(), found);
+    map_value found_value = *found;
+    EXPECT_EQ_U(key,    found_value.first);
+    EXPECT_EQ_U(mapped, found_value.second);
+    EXPECT_EQ_U(1, map.count(key));
+    mapped_t mapped_at = map.at(key);
+    EXPECT_EQ_U(mapped, mapped_at);
+  }
+  // Keys not contained in the map:
+  for (int li = local_elements; li < local_elements + 10; ++li) {
+    key_t key = (nunits * li) + ((_dash_id + 1) % nunits);
+    EXPECT_EQ_U(map.end(), map.find(key));
+    EXPECT_EQ_U(0, map.count(key));
+    EXPECT_THROW(map.at(key), dash::exception::InvalidArgument);
+  }
+  dash::barrier();
+
+  // Update mapped values of remote elements:
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + ((_dash_id + 1) % nunits);
+    map[key]  = -1.0 * key;
+  }
+  dash::barrier();
+
+  for (int li = 0; li < local_elements; ++li) {
+    key_t     key   = (nunits * li) + _dash_id;
+    map_value value = *map.local.find(key);
+    EXPECT_EQ_U(-1.0 * key, value.second);
+  }
+}
+
+TEST_F(UnorderedMapTest, DistributedInsert)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>           map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  int nunits         = dash::size();
+  int local_elements = 200;
+  // Small local buffer such that most remote insertions exceed the
+  // capacity of their target unit and are written in the next barrier:
+  size_type local_buffer_size = 4;
+
+  map_t map(0, local_buffer_size);
+  // Every unit inserts keys distributed to all units by the default hash:
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key       = (nunits * li) + _dash_id;
+    auto  insertion = map.insert(map_value({ key, 0.0 }));
+    EXPECT_TRUE_U(insertion.second);
+    auto  existing  = map.insert(map_value({ key, 1.0 }));
+    EXPECT_FALSE_U(existing.second);
+    EXPECT_EQ_U(insertion.first, existing.first);
+    // Access of elements before commit:
+    map[key] = 0.5 * key;
+    mapped_t mapped = map.at(key);
+    EXPECT_EQ_U(0.5 * key, mapped);
+    EXPECT_EQ_U(1, map.count(key));
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+  // Keys are distributed to the units:
+  if (nunits > 1) {
+    EXPECT_LT_U(map.lsize(), map.size());
+  }
+  EXPECT_GT_U(map.lsize(), 0);
+
+  // Look up keys inserted by all units:
+  for (int li = 0; li < local_elements; ++li) {
+    for (int u = 0; u < nunits; ++u) {
+      key_t key   = (nunits * li) + u;
+      auto  found = map.find(key);
+      EXPECT_NE_U(map.end(), found);
+      map_value found_value = *found;
+      EXPECT_EQ_U(key,       found_value.first);
+      EXPECT_EQ_U(0.5 * key, found_value.second);
+      EXPECT_EQ_U(map.bucket(key),
+                  static_cast<size_type>(found.lpos().unit.id));
+      EXPECT_FALSE_U(map.insert(map_value({ key, 1.0 })).second);
+    }
+  }
+  // Local elements are the keys mapped to the unit:
+  for (auto lit = map.local.begin(); lit != map.local.end(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(static_cast<size_type>(_dash_id),
+                map.bucket(value.first));
+    EXPECT_EQ_U(lit, map.local.find(value.first));
+  }
+  dash::barrier();
+
+  // Remote insertions after commit are written to their target units
+  // directly:
+  for (int li = local_elements; li < local_elements + 10; ++li) {
+    key_t key = (nunits * li) + _dash_id;
+    map[key]  = -1.0 * key;
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * (local_elements + 10), map.size());
+  for (int li = local_elements; li < local_elements + 10; ++li) {
+    key_t    key    = (nunits * li) + ((_dash_id + 1) % nunits);
+    mapped_t mapped = map.at(key);
+    EXPECT_EQ_U(-1.0 * key, mapped);
+  }
+}
+
+TEST_F(UnorderedMapTest, BulkInsert)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>           map_t;
+  typedef typename map_t::iterator                      map_iterator;
+  typedef typename map_t::value_type                    map_value;
+
+  int nunits         = dash::size();
+  int local_elements = 1000;
+
+  map_t map;
+  // Single element inserted before bulk insertion:
+  map.insert(map_value({ -1 - _dash_id, 1.0 }));
+  // Every unit inserts its keys and the first half of the keys of the
+  // next unit:
+  std::vector<map_value> values;
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + _dash_id;
+    values.push_back(map_value({ key, 0.5 * key }));
+  }
+  for (int li = 0; li < local_elements / 2; ++li) {
+    key_t key = (nunits * li) + ((_dash_id + 1) % nunits);
+    values.push_back(map_value({ key, 0.5 * key }));
+  }
+  map.insert_bulk(values.begin(), values.end());
+
+  EXPECT_EQ_U(nunits * (local_elements + 1), map.size());
+  for (auto lit = map.local.begin(); lit != map.local.end(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(lit, map.local.find(value.first));
+  }
+
+  // Look up keys of the next unit and keys not contained in the map:
+  std::vector<key_t> keys;
+  for (int li = 0; li < local_elements + 10; ++li) {
+    keys.push_back((nunits * li) + ((_dash_id + 1) % nunits));
+  }
+  keys.push_back(-1 - _dash_id);
+  std::vector<map_iterator> found(keys.size());
+  auto found_end = map.find_bulk(keys.begin(), keys.end(), found.begin());
+  EXPECT_EQ_U(found.end(), found_end);
+  for (size_t k = 0; k < keys.size(); ++k) {
+    key_t key = keys[k];
+    EXPECT_EQ_U(map.find(key), found[k]);
+    if (k < static_cast<size_t>(local_elements)) {
+      map_value value = *found[k];
+      EXPECT_EQ_U(key,       value.first);
+      EXPECT_EQ_U(0.5 * key, value.second);
+    } else if (k < keys.size() - 1) {
+      EXPECT_EQ_U(map.end(), found[k]);
+    }
+  }
+  map_value single_value = *found.back();
+  EXPECT_EQ_U(1.0, single_value.second);
+}
+
+TEST_F(UnorderedMapTest, BulkInsertLocalHash)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::HashLocal<key_t>                        hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::iterator                      map_iterator;
+  typedef typename map_t::value_type                    map_value;
+
+  int nunits         = dash::size();
+  int local_elements = 100;
+
+  map_t map;
+  std::vector<map_value> values;
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + _dash_id;
+    values.push_back(map_value({ key, 0.5 * key }));
+  }
+  map.insert_bulk(values.begin(), values.end());
+
+  EXPECT_EQ_U(local_elements, map.lsize());
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+
+  std::vector<key_t> keys;
+  for (int li = 0; li < local_elements + 10; ++li) {
+    keys.push_back((nunits * li) + ((_dash_id + 1) % nunits));
+  }
+  std::vector<map_iterator> found(keys.size());
+  map.find_bulk(keys.begin(), keys.end(), found.begin());
+  for (size_t k = 0; k < keys.size(); ++k) {
+    EXPECT_EQ_U(map.find(keys[k]), found[k]);
+    if (k < static_cast<size_t>(local_elements)) {
+      EXPECT_EQ_U((_dash_id + 1) % nunits, found[k].lpos().unit);
+    }
+  }
+}
+
+TEST_F(UnorderedMapTest, Erase)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>           map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  int nunits         = dash::size();
+  int next_unit      = (_dash_id + 1) % nunits;
+  int local_elements = 100;
+
+  map_t map(0, 4);
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + _dash_id;
+    map.insert(map_value({ key, 0.5 * key }));
+  }
+  map.barrier();
+  size_type capacity = map.capacity();
+
+  // Every unit erases every second key inserted by the next unit, the
+  // erasure is visible to the erasing unit before the next barrier:
+  for (int li = 0; li < local_elements; li += 2) {
+    key_t key = (nunits * li) + next_unit;
+    EXPECT_EQ_U(1, map.erase(key));
+    EXPECT_EQ_U(map.end(), map.find(key));
+    EXPECT_EQ_U(0, map.erase(key));
+  }
+  EXPECT_EQ_U(nunits * local_elements - local_elements / 2, map.size());
+  dash::barrier();
+  // Erased keys can be inserted again before the next barrier:
+  key_t reinserted = next_unit;
+  EXPECT_TRUE_U(map.insert(map_value({ reinserted, -1.0 })).second);
+  EXPECT_FALSE_U(map.insert(map_value({ reinserted, -2.0 })).second);
+  map.barrier();
+
+  size_type num_elements = nunits * (local_elements / 2 + 1);
+  EXPECT_EQ_U(num_elements, map.size());
+  for (int li = 0; li < local_elements; ++li) {
+    for (int u = 0; u < nunits; ++u) {
+      key_t key   = (nunits * li) + u;
+      auto  found = map.find(key);
+      if (li == 0) {
+        EXPECT_NE_U(map.end(), found);
+        mapped_t mapped = map.at(key);
+        EXPECT_EQ_U(-1.0, mapped);
+      } else if (li % 2 == 0) {
+        EXPECT_EQ_U(map.end(), found);
+      } else {
+        EXPECT_NE_U(map.end(), found);
+      }
+    }
+  }
+  // Iterators skip erased elements:
+  size_type num_visited = 0;
+  for (auto git = map.begin(); git != map.end(); ++git) {
+    map_value value = *git;
+    EXPECT_TRUE_U(value.first < nunits || (value.first / nunits) % 2 == 1);
+    ++num_visited;
+  }
+  EXPECT_EQ_U(num_elements, num_visited);
+  size_type num_local = 0;
+  for (auto lit = map.local.begin(); lit != map.local.end(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(lit, map.local.find(value.first));
+    ++num_local;
+  }
+  EXPECT_EQ_U(map.lsize(), num_local);
+
+  // Local erasure of all remaining local elements with odd keys:
+  for (auto lit = map.local.begin(); lit != map.local.end(); ) {
+    map_value value = *lit;
+    if (value.first % 2 == 1) {
+      lit = map.local.erase(lit);
+    } else {
+      ++lit;
+    }
+  }
+  map.barrier();
+  size_type num_even = 0;
+  for (auto git = map.begin(); git != map.end(); ++git) {
+    map_value value = *git;
+    EXPECT_EQ_U(0, value.first % 2);
+    ++num_even;
+  }
+  EXPECT_EQ_U(num_even, map.size());
+
+  // Compaction releases memory of erased elements:
+  map.compact();
+  EXPECT_EQ_U(num_even, map.size());
+  EXPECT_LT_U(map.capacity(), capacity);
+  for (auto git = map.begin(); git != map.end(); ++git) {
+    map_value value = *git;
+    EXPECT_EQ_U(git, map.find(value.first));
+    mapped_t mapped = map.at(value.first);
+    EXPECT_EQ_U(value.second, mapped);
+  }
+  // Insertion after compaction:
+  key_t key = nunits * (local_elements + 1) + _dash_id;
+  map[key]  = 0.5 * key;
+  map.barrier();
+  EXPECT_EQ_U(num_even + nunits, map.size());
+  mapped_t mapped = map.at(key);
+  EXPECT_EQ_U(0.5 * key, mapped);
+}
+
+TEST_F(UnorderedMapTest, AsyncUpdate)
+{
+  typedef int                                           key_t;
+  typedef int                                           mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>           map_t;
+
+  int nunits   = dash::size();
+  int nkeys    = 100;
+  int nupdates = 3000;
+  int expected = nunits * (nupdates / nkeys);
+
+  map_t map;
+  auto  add = map.register_update(
+                [](mapped_t & value, const mapped_t & arg) {
+                  value += arg;
+                });
+  // All units increment the same keys concurrently, issuing more
+  // requests than the capacity of request queues:
+  std::vector< dash::Future<mapped_t> > updated;
+  for (int u = 0; u < nupdates; ++u) {
+    updated.push_back(map.async_update(u % nkeys, add, 1));
+  }
+  for (auto & fut : updated) {
+    mapped_t value = fut.get();
+    EXPECT_GT_U(value, 0);
+    EXPECT_LE_U(value, expected);
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nkeys, map.size());
+  for (key_t key = 0; key < nkeys; ++key) {
+    mapped_t value = map.at(key);
+    EXPECT_EQ_U(expected, value);
+    EXPECT_EQ_U(expected, map.async_get(key).get());
+  }
+  auto missing = map.async_get(-1);
+  EXPECT_THROW(missing.get(), dash::exception::InvalidArgument);
+}
+
+TEST_F(UnorderedMapTest, ConcurrentInsert)
+{
+  typedef int                                           key_t;
+  typedef int                                           mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>           map_t;
+  typedef typename map_t::value_type                    map_value;
+
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  int nunits = dash::size();
+  int nkeys  = 20;
+
+  map_t            map;
+  dash::Array<int> ninserted(nunits);
+  // All units insert the same keys concurrently, only one unit inserts
+  // an element for every key and the others obtain an iterator to it:
+  int l_inserted = 0;
+  for (key_t key = 0; key < nkeys; ++key) {
+    auto insertion = map.insert(map_value({ key, 0 }));
+    EXPECT_NE_U(map.end(), insertion.first);
+    map_value value = *insertion.first;
+    EXPECT_EQ_U(key, value.first);
+    if (insertion.second) {
+      ++l_inserted;
+    }
+  }
+  ninserted.local[0] = l_inserted;
+  dash::barrier();
+
+  // Units write to the elements in turns before commit, no write is lost:
+  for (int u = 0; u < nunits; ++u) {
+    if (u == static_cast<int>(_dash_id)) {
+      for (key_t key = 0; key < nkeys; ++key) {
+        mapped_t mapped = map[key];
+        map[key] = mapped + 1;
+      }
+    }
+    dash::barrier();
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nkeys, map.size());
+  int g_inserted = 0;
+  for (int u = 0; u < nunits; ++u) {
+    g_inserted += ninserted[u];
+  }
+  EXPECT_EQ_U(nkeys, g_inserted);
+  for (key_t key = 0; key < nkeys; ++key) {
+    mapped_t mapped = map.at(key);
+    EXPECT_EQ_U(nunits, mapped);
+  }
+}
+
+TEST_F(UnorderedMapTest, ConcurrentInsertOverflow)
+{
+  typedef int                                           key_t;
+  typedef int                                           mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>           map_t;
+  typedef typename map_t::value_type                    map_value;
+
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  int nunits = dash::size();
+  // More keys at every unit than slots in its table of claimed keys:
+  int nkeys  = 1536 * nunits;
+
+  // Small local buffers, such that most elements inserted by remote
+  // units are written in the next barrier:
+  map_t            map(0, 16);
+  dash::Array<int> ninserted(nunits);
+  int l_inserted = 0;
+  for (key_t key = 0; key < nkeys; ++key) {
+    auto insertion = map.insert(map_value({ key, 0 }));
+    EXPECT_NE_U(map.end(), insertion.first);
+    map_value value = *insertion.first;
+    EXPECT_EQ_U(key, value.first);
+    if (insertion.second) {
+      ++l_inserted;
+    }
+  }
+  ninserted.local[0] = l_inserted;
+  dash::barrier();
+
+  for (int u = 0; u < nunits; ++u) {
+    if (u == static_cast<int>(_dash_id)) {
+      for (key_t key = 0; key < nkeys; ++key) {
+        mapped_t mapped = map[key];
+        map[key] = mapped + 1;
+      }
+    }
+    dash::barrier();
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nkeys, map.size());
+  int g_inserted = 0;
+  for (int u = 0; u < nunits; ++u) {
+    g_inserted += ninserted[u];
+  }
+  EXPECT_EQ_U(nkeys, g_inserted);
+  for (key_t key = 0; key < nkeys; ++key) {
+    mapped_t mapped = map.at(key);
+    EXPECT_EQ_U(nunits, mapped);
+  }
+
+  // Tables of claimed keys are cleared in the barrier:
+  for (key_t key = nkeys; key < 2 * nkeys; ++key) {
+    EXPECT_NE_U(map.end(), map.insert(map_value({ key, key })).first);
+  }
+  map.barrier();
+  EXPECT_EQ_U(2 * nkeys, map.size());
+}
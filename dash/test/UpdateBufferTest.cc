@@ -0,0 +1,136 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "UpdateBufferTest.h"
+
+TEST_F(UpdateBufferTest, Histogram) {
+  const size_t num_bins_per_unit = 64;
+  const size_t num_keys          = 1000;
+  dash::Array<int> histo(_dash_size * num_bins_per_unit);
+  dash::fill(histo.begin(), histo.end(), 0);
+  histo.barrier();
+
+  {
+    dash::UpdateBuffer<dash::Array<int>, dash::plus<int>> updates(
+      histo, 100);
+    for (size_t k = 0; k < num_keys; ++k) {
+      updates.update((k * 7) % histo.size(), 1);
+    }
+    EXPECT_LT_U(updates.size(), _dash_size * updates.capacity());
+    updates.flush();
+    EXPECT_EQ_U(0, updates.size());
+
+    auto stats = updates.stats();
+    LOG_MESSAGE("update buffer stats: updates:%zu combined:%zu "
+                "transfers:%zu flushes:%zu",
+                stats.updates, stats.combined, stats.transfers,
+                stats.flushes);
+    EXPECT_EQ_U(num_keys, stats.updates);
+    EXPECT_LT_U(stats.transfers, stats.updates);
+    EXPECT_GT_U(stats.aggregation_factor(), 1.0);
+  }
+  histo.barrier();
+
+  std::vector<int> expected(histo.size(), 0);
+  for (size_t k = 0; k < num_keys; ++k) {
+    expected[(k * 7) % histo.size()] += _dash_size;
+  }
+  for (size_t li = 0; li < histo.lsize(); ++li) {
+    EXPECT_EQ_U(expected[histo.pattern().global(li)], histo.local[li]);
+  }
+}
+
+TEST_F(UpdateBufferTest, FlushOnCapacity) {
+  const size_t num_elem_per_unit = 10;
+  dash::Array<long> array(_dash_size * num_elem_per_unit);
+  dash::fill(array.begin(), array.end(), 0L);
+  array.barrier();
+
+  // Every unit updates the first element of its successor:
+  auto target = ((_dash_id + 1) % _dash_size) * num_elem_per_unit;
+  dash::UpdateBuffer<dash::Array<long>, dash::plus<long>> updates(
+    array, 4);
+  for (int i = 0; i < 3; ++i) {
+    updates.update(target, 1);
+  }
+  EXPECT_EQ_U(3, updates.size());
+  EXPECT_EQ_U(0, updates.stats().flushes);
+  // Fourth update reaches capacity, buffered updates are combined into a
+  // single element update:
+  updates.update(target, 1);
+  EXPECT_EQ_U(0, updates.size());
+  EXPECT_EQ_U(1, updates.stats().flushes);
+  EXPECT_EQ_U(1, updates.stats().transfers);
+  EXPECT_EQ_U(3, updates.stats().combined);
+  updates.flush();
+  array.barrier();
+
+  EXPECT_EQ_U(4, static_cast<long>(array.local[0]));
+  for (size_t li = 1; li < array.lsize(); ++li) {
+    EXPECT_EQ_U(0, static_cast<long>(array.local[li]));
+  }
+}
+
+TEST_F(UpdateBufferTest, FlushOnDelay) {
+  dash::Array<int> array(_dash_size);
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  dash::UpdateBuffer<dash::Array<int>, dash::max<int>> updates(
+    array, 1000, 1000);
+  updates.update(0, _dash_id + 1);
+  EXPECT_EQ_U(1, updates.size());
+  // Wait until the buffered update exceeds the maximum delay:
+  auto ts_start = std::chrono::steady_clock::now();
+  while (std::chrono::steady_clock::now() - ts_start
+         < std::chrono::milliseconds(2)) { }
+  updates.update(0, 0);
+  EXPECT_EQ_U(0, updates.size());
+  updates.flush();
+  array.barrier();
+
+  if (_dash_id == 0) {
+    EXPECT_EQ_U(static_cast<int>(_dash_size),
+                static_cast<int>(array.local[0]));
+  }
+}
+
+TEST_F(UpdateBufferTest, DelayAfterCapacityFlush) {
+  if (_dash_size < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  dash::Array<int> array(_dash_size);
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  auto busy_wait = [](long ms) {
+    auto ts_start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - ts_start
+           < std::chrono::milliseconds(ms)) { }
+  };
+  // Updates sent before the final flush target the calling unit, so
+  // sending them does not depend on progress at other units:
+  auto target_own  = _dash_id;
+  auto target_next = (_dash_id + 1) % _dash_size;
+  // Capacity of 2 updates per unit, maximum delay of 400 ms:
+  dash::UpdateBuffer<dash::Array<int>, dash::plus<int>> updates(
+    array, 2, 400000);
+  updates.update(target_own, 1);
+  busy_wait(300);
+  updates.update(target_next, 1);
+  // Reaches capacity of the buffer of the calling unit, the update of the
+  // next unit is the oldest buffered update:
+  updates.update(target_own, 1);
+  EXPECT_EQ_U(1, updates.size());
+  EXPECT_EQ_U(1, updates.stats().flushes);
+  // Maximum delay is exceeded for the sent update but not for the oldest
+  // buffered update:
+  busy_wait(150);
+  updates.update(target_own, 1);
+  EXPECT_EQ_U(2, updates.size());
+  EXPECT_EQ_U(1, updates.stats().flushes);
+  updates.flush();
+  array.barrier();
+
+  EXPECT_EQ_U(4, static_cast<int>(array.local[0]));
+}